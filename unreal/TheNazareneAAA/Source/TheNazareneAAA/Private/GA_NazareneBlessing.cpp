@@ -1,14 +1,14 @@
 #include "GA_NazareneBlessing.h"
 
 #include "NazareneAttributeSet.h"
+#include "NazareneGameplayTags.h"
 #include "NazarenePlayerCharacter.h"
-#include "GameplayTagsManager.h"
 
 UGA_NazareneBlessing::UGA_NazareneBlessing()
 {
     FaithCost = 22.0f;
     CooldownDuration = 14.0f;
-    CooldownTag = FGameplayTag::RequestGameplayTag(FName(TEXT("Cooldown.Miracle.Blessing")), false);
+    CooldownTag = NazareneGameplayTags::Cooldown_Miracle_Blessing;
 }
 
 void UGA_NazareneBlessing::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
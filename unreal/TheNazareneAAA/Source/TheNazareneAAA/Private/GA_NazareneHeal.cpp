@@ -1,14 +1,14 @@
 #include "GA_NazareneHeal.h"
 
 #include "NazareneAttributeSet.h"
+#include "NazareneGameplayTags.h"
 #include "NazarenePlayerCharacter.h"
-#include "GameplayTagsManager.h"
 
 UGA_NazareneHeal::UGA_NazareneHeal()
 {
     FaithCost = 18.0f;
     CooldownDuration = 6.5f;
-    CooldownTag = FGameplayTag::RequestGameplayTag(FName(TEXT("Cooldown.Miracle.Heal")), false);
+    CooldownTag = NazareneGameplayTags::Cooldown_Miracle_Heal;
 }
 
 void UGA_NazareneHeal::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
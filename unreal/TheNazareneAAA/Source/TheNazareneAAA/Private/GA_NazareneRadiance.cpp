@@ -1,16 +1,19 @@
 #include "GA_NazareneRadiance.h"
 
-#include "EngineUtils.h"
+#include "Abilities/GameplayAbilityTargetTypes.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+#include "GE_NazareneMiracleDamage.h"
 #include "NazareneAttributeSet.h"
 #include "NazareneEnemyCharacter.h"
+#include "NazareneGameplayTags.h"
 #include "NazarenePlayerCharacter.h"
-#include "GameplayTagsManager.h"
 
 UGA_NazareneRadiance::UGA_NazareneRadiance()
 {
     FaithCost = 30.0f;
     CooldownDuration = 12.0f;
-    CooldownTag = FGameplayTag::RequestGameplayTag(FName(TEXT("Cooldown.Miracle.Radiance")), false);
+    CooldownTag = NazareneGameplayTags::Cooldown_Miracle_Radiance;
 }
 
 void UGA_NazareneRadiance::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
@@ -57,22 +60,53 @@ void UGA_NazareneRadiance::ActivateAbility(const FGameplayAbilitySpecHandle Hand
     const float Damage = Player->RadianceDamage;
     const float PoiseDamage = Player->RadiancePoiseDamage;
 
+    // One sphere overlap gathers the targets, so the cost follows the hits rather than the enemy count.
+    TArray<ANazareneEnemyCharacter*> HitEnemies;
     UWorld* World = Player->GetWorld();
     if (World != nullptr)
     {
-        for (TActorIterator<ANazareneEnemyCharacter> It(World); It; ++It)
+        TArray<FOverlapResult> Overlaps;
+        FCollisionQueryParams Params(SCENE_QUERY_STAT(NazareneRadiance), false, Player);
+        World->OverlapMultiByObjectType(
+            Overlaps,
+            Player->GetActorLocation(),
+            FQuat::Identity,
+            FCollisionObjectQueryParams(ECC_Pawn),
+            FCollisionShape::MakeSphere(Radius),
+            Params
+        );
+
+        for (const FOverlapResult& Overlap : Overlaps)
         {
-            ANazareneEnemyCharacter* Enemy = *It;
-            if (Enemy == nullptr || Enemy->IsRedeemed())
+            ANazareneEnemyCharacter* Enemy = Cast<ANazareneEnemyCharacter>(Overlap.GetActor());
+            if (Enemy != nullptr && !Enemy->IsRedeemed())
             {
-                continue;
+                HitEnemies.AddUnique(Enemy);
             }
-            const FVector ToEnemy = Enemy->GetActorLocation() - Player->GetActorLocation();
-            if (ToEnemy.Size() <= Radius)
+        }
+    }
+
+    // One spec, applied to every target in a single batch through actor-array target data.
+    if (HitEnemies.Num() > 0)
+    {
+        FGameplayEffectSpecHandle DamageSpec = MakeOutgoingGameplayEffectSpec(Handle, ActorInfo, ActivationInfo, UGE_NazareneMiracleDamage::StaticClass(), GetAbilityLevel(Handle, ActorInfo));
+        if (DamageSpec.IsValid())
+        {
+            DamageSpec.Data->SetSetByCallerMagnitude(NazareneGameplayTags::Data_Miracle_Damage, Damage);
+            DamageSpec.Data->SetSetByCallerMagnitude(NazareneGameplayTags::Data_Miracle_PoiseDamage, PoiseDamage);
+
+            FGameplayAbilityTargetData_ActorArray* TargetData = new FGameplayAbilityTargetData_ActorArray();
+            TargetData->TargetActorArray.Reserve(HitEnemies.Num());
+            for (ANazareneEnemyCharacter* Enemy : HitEnemies)
             {
-                Enemy->ReceiveCombatHit(Damage, PoiseDamage, Player);
-                Enemy->ApplyKnockback(ToEnemy.GetSafeNormal2D(), 450.0f);
+                TargetData->TargetActorArray.Add(Enemy);
             }
+            ApplyGameplayEffectSpecToTarget(Handle, ActorInfo, ActivationInfo, DamageSpec, FGameplayAbilityTargetDataHandle(TargetData));
+        }
+
+        for (ANazareneEnemyCharacter* Enemy : HitEnemies)
+        {
+            Enemy->ApplyKnockback((Enemy->GetActorLocation() - Player->GetActorLocation()).GetSafeNormal2D(), 450.0f);
         }
     }
 
@@ -1,10 +1,12 @@
 #include "GE_NazareneMiracleCooldown.h"
 
+#include "NazareneGameplayTags.h"
+
 UGE_NazareneMiracleCooldown::UGE_NazareneMiracleCooldown()
 {
     DurationPolicy = EGameplayEffectDurationType::HasDuration;
 
     FSetByCallerFloat CooldownMagnitude;
-    CooldownMagnitude.DataTag = FGameplayTag::RequestGameplayTag(FName(TEXT("Data.Miracle.Cooldown")), false);
+    CooldownMagnitude.DataTag = NazareneGameplayTags::Data_Miracle_Cooldown;
     DurationMagnitude = FGameplayEffectModifierMagnitude(CooldownMagnitude);
 }
@@ -1,6 +1,7 @@
 #include "GE_NazareneMiracleCost.h"
 
 #include "NazareneAttributeSet.h"
+#include "NazareneGameplayTags.h"
 
 UGE_NazareneMiracleCost::UGE_NazareneMiracleCost()
 {
@@ -11,6 +12,6 @@ UGE_NazareneMiracleCost::UGE_NazareneMiracleCost()
     FaithCostModifier.ModifierOp = EGameplayModOp::Additive;
 
     FSetByCallerFloat FaithCostMagnitude;
-    FaithCostMagnitude.DataTag = FGameplayTag::RequestGameplayTag(FName(TEXT("Data.Miracle.FaithCost")), false);
+    FaithCostMagnitude.DataTag = NazareneGameplayTags::Data_Miracle_FaithCost;
     FaithCostModifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FaithCostMagnitude);
 }
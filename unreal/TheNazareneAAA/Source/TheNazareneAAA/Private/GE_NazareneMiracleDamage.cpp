@@ -0,0 +1,18 @@
+#include "GE_NazareneMiracleDamage.h"
+
+#include "NazareneAttributeSet.h"
+#include "NazareneGameplayTags.h"
+
+UGE_NazareneMiracleDamage::UGE_NazareneMiracleDamage()
+{
+    DurationPolicy = EGameplayEffectDurationType::Instant;
+
+    // Damage lands on the IncomingDamage meta attribute; the attribute set hands it to the owner's hit logic.
+    FGameplayModifierInfo& DamageModifier = Modifiers.AddDefaulted_GetRef();
+    DamageModifier.Attribute = UNazareneAttributeSet::GetIncomingDamageAttribute();
+    DamageModifier.ModifierOp = EGameplayModOp::Additive;
+
+    FSetByCallerFloat DamageMagnitude;
+    DamageMagnitude.DataTag = NazareneGameplayTags::Data_Miracle_Damage;
+    DamageModifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(DamageMagnitude);
+}
@@ -0,0 +1,38 @@
+#include "NazareneAnimNotifyState_WeaponTrace.h"
+
+#include "Components/SkeletalMeshComponent.h"
+#include "NazareneWeaponTraceComponent.h"
+
+namespace
+{
+    static UNazareneWeaponTraceComponent* FindWeaponTrace(const USkeletalMeshComponent* MeshComp)
+    {
+        const AActor* Owner = MeshComp != nullptr ? MeshComp->GetOwner() : nullptr;
+        return Owner != nullptr ? Owner->FindComponentByClass<UNazareneWeaponTraceComponent>() : nullptr;
+    }
+}
+
+void UNazareneAnimNotifyState_WeaponTrace::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
+{
+    Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
+
+    if (UNazareneWeaponTraceComponent* WeaponTrace = FindWeaponTrace(MeshComp))
+    {
+        WeaponTrace->SetNotifyWindowActive(true);
+    }
+}
+
+void UNazareneAnimNotifyState_WeaponTrace::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+    Super::NotifyEnd(MeshComp, Animation, EventReference);
+
+    if (UNazareneWeaponTraceComponent* WeaponTrace = FindWeaponTrace(MeshComp))
+    {
+        WeaponTrace->SetNotifyWindowActive(false);
+    }
+}
+
+FString UNazareneAnimNotifyState_WeaponTrace::GetNotifyName_Implementation() const
+{
+    return TEXT("Weapon Trace");
+}
@@ -1,6 +1,7 @@
 #include "NazareneAttributeSet.h"
 
 #include "GameplayEffectExtension.h"
+#include "NazareneGameplayTags.h"
 
 void UNazareneAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue)
 {
@@ -44,4 +45,11 @@ void UNazareneAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCa
     {
         SetFaith(FMath::Max(GetFaith(), 0.0f));
     }
+    else if (Data.EvaluatedData.Attribute == GetIncomingDamageAttribute())
+    {
+        const float Damage = GetIncomingDamage();
+        SetIncomingDamage(0.0f);
+        const float PoiseDamage = Data.EffectSpec.GetSetByCallerMagnitude(NazareneGameplayTags::Data_Miracle_PoiseDamage, false, 0.0f);
+        OnIncomingDamage.Broadcast(Damage, PoiseDamage, Data.EffectSpec.GetContext().GetInstigator());
+    }
 }
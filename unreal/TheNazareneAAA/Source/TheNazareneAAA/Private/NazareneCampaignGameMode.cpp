@@ -1,8 +1,9 @@
 #include "NazareneCampaignGameMode.h"
 
+#include "AnimationSharingManager.h"
+#include "AnimationSharingSetup.h"
 #include "BehaviorTree/BehaviorTree.h"
 #include "Camera/CameraComponent.h"
-#include "Components/AudioComponent.h"
 #include "Components/DirectionalLightComponent.h"
 #include "Components/ExponentialHeightFogComponent.h"
 #include "Components/PointLightComponent.h"
@@ -11,6 +12,7 @@
 #include "Engine/DirectionalLight.h"
 #include "Engine/ExponentialHeightFog.h"
 #include "Engine/LevelStreaming.h"
+#include "Engine/LevelStreamingDynamic.h"
 #include "Engine/PointLight.h"
 #include "Engine/PostProcessVolume.h"
 #include "Engine/SkyLight.h"
@@ -18,15 +20,24 @@
 #include "Engine/Engine.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
 #include "Kismet/GameplayStatics.h"
+#include "Kismet/KismetSystemLibrary.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "NazareneMenuCameraActor.h"
+#include "Misc/CommandLine.h"
 #include "Misc/FileHelper.h"
 #include "Misc/PackageName.h"
+#include "Misc/Parse.h"
 #include "Misc/Paths.h"
 #include "Materials/MaterialInterface.h"
 #include "NazareneEnemyCharacter.h"
+#include "NazareneFlowFieldSubsystem.h"
 #include "NazareneGameInstance.h"
+#include "NazareneInputReplaySubsystem.h"
+#include "NazareneMemoryReportSubsystem.h"
+#include "NazareneMemoryTags.h"
+#include "NazareneMusicSubsystem.h"
 #include "NazareneNPC.h"
 #include "NazareneAssetResolver.h"
 #include "NazareneRegionDataAsset.h"
@@ -35,6 +46,8 @@
 #include "NazarenePlayerCharacter.h"
 #include "NazarenePrayerSite.h"
 #include "NazareneSaveSubsystem.h"
+#include "NazareneStartupProfiler.h"
+#include "NazareneTelemetrySubsystem.h"
 #include "NazareneTravelGate.h"
 #include "Sound/SoundBase.h"
 #include "TimerManager.h"
@@ -80,16 +93,27 @@ ANazareneCampaignGameMode::ANazareneCampaignGameMode()
     BTDemonAsset = TSoftObjectPtr<UBehaviorTree>(FSoftObjectPath(TEXT("/Game/AI/BehaviorTrees/BT_Demon.BT_Demon")));
     BTBossAsset = TSoftObjectPtr<UBehaviorTree>(FSoftObjectPath(TEXT("/Game/AI/BehaviorTrees/BT_Boss.BT_Boss")));
 
+    EnemyAnimationSharingSetup = TSoftObjectPtr<UAnimationSharingSetup>(FSoftObjectPath(NazareneAssetResolver::ResolveObjectPath(
+        TEXT("EnemyAnimSharingSetup"),
+        TEXT("/Game/Art/Animation/AS_BiblicalEnemyCrowd.AS_BiblicalEnemyCrowd"),
+        {})));
+
     NativityQuestRequiredSlugs = { FName(TEXT("mary")), FName(TEXT("joseph")), FName(TEXT("shepherd")) };
 }
 
 void ANazareneCampaignGameMode::BeginPlay()
 {
+    FNazareneStartupScope StartupScope(TEXT("GameMode.BeginPlay"));
     Super::BeginPlay();
 
     Session = Cast<UNazareneGameInstance>(GetGameInstance());
     SaveSubsystem = Session ? Session->GetSubsystem<UNazareneSaveSubsystem>() : nullptr;
-    BuildDefaultRegions();
+    ResolveSimulationSeed();
+    {
+        FNazareneStartupScope RegionsScope(TEXT("GameMode.BuildDefaultRegions"));
+        BuildDefaultRegions();
+    }
+    InitializeEnemyAnimationSharing();
 
     FNazareneSavePayload PendingPayload;
     bool bHasPendingPayload = Session ? Session->ConsumePendingPayload(PendingPayload) : false;
@@ -107,7 +131,16 @@ void ANazareneCampaignGameMode::BeginPlay()
         RegionIndex = FMath::Clamp(Session->GetCampaignState().RegionIndex, 0, Regions.Num() - 1);
     }
 
-    LoadRegion(RegionIndex);
+    // The title diorama streams in while the first region loads; the menu camera frames it afterwards.
+    {
+        FNazareneStartupScope SetpieceScope(TEXT("GameMode.MenuSetpiece"));
+        SpawnMenuSetpiece(GetMenuStageCenter());
+    }
+
+    {
+        FNazareneStartupScope RegionScope(TEXT("GameMode.LoadRegion"));
+        LoadRegion(RegionIndex);
+    }
 
     if (bHasPendingPayload)
     {
@@ -118,13 +151,144 @@ void ANazareneCampaignGameMode::BeginPlay()
     QueueIntroStoryIfNeeded();
 
     // Task 7: Spawn orbiting menu camera while the start menu is visible
-    SpawnMenuCamera();
+    {
+        FNazareneStartupScope MenuCameraScope(TEXT("GameMode.MenuCamera"));
+        SpawnMenuCamera();
+    }
+
+    // The HUD builds its start menu during its own BeginPlay; dismiss it a tick later for replays.
+    GetWorldTimerManager().SetTimerForNextTick(this, &ANazareneCampaignGameMode::StartInputReplayIfArmed);
+    GetWorldTimerManager().SetTimerForNextTick(this, &ANazareneCampaignGameMode::StartSpawnBenchmarkIfArmed);
+}
+
+void ANazareneCampaignGameMode::ResolveSimulationSeed()
+{
+    UNazareneInputReplaySubsystem* InputReplay = Session ? Session->GetSubsystem<UNazareneInputReplaySubsystem>() : nullptr;
+
+    // Replays must reproduce the captured enemy decisions, so their seed wins.
+    int32 Seed = SimulationSeed;
+    const bool bReplaySeed = InputReplay != nullptr && InputReplay->GetReplaySeed(Seed);
+    if (!bReplaySeed && !FParse::Value(FCommandLine::Get(), TEXT("NazareneSeed="), Seed) && Seed == 0)
+    {
+        Seed = static_cast<int32>(FPlatformTime::Cycles() ^ static_cast<uint32>(FMath::Rand()));
+    }
+
+    ResolvedSimulationSeed = Seed;
+    if (InputReplay != nullptr)
+    {
+        InputReplay->SetRecordingSeed(Seed);
+    }
+    if (UNazareneTelemetrySubsystem* Telemetry = Session ? Session->GetSubsystem<UNazareneTelemetrySubsystem>() : nullptr)
+    {
+        Telemetry->SetSessionSeed(Seed);
+    }
+    UE_LOG(LogTemp, Log, TEXT("Campaign simulation seed: %d"), Seed);
 }
 
-void ANazareneCampaignGameMode::Tick(float DeltaSeconds)
+FRandomStream ANazareneCampaignGameMode::MakeEnemyDecisionStream(FName SpawnId) const
 {
-    Super::Tick(DeltaSeconds);
-    TickCrossfade(DeltaSeconds);
+    // String hashes are stable across runs; FName hashes depend on name table order.
+    uint32 StreamSeed = HashCombine(static_cast<uint32>(ResolvedSimulationSeed), GetTypeHash(SpawnId.ToString()));
+    StreamSeed = HashCombine(StreamSeed, static_cast<uint32>(RegionIndex));
+    return FRandomStream(static_cast<int32>(StreamSeed));
+}
+
+void ANazareneCampaignGameMode::StartInputReplayIfArmed()
+{
+    const UNazareneInputReplaySubsystem* InputReplay = Session ? Session->GetSubsystem<UNazareneInputReplaySubsystem>() : nullptr;
+    if (InputReplay == nullptr || !InputReplay->IsReplayActive() || !IsStartMenuVisible())
+    {
+        return;
+    }
+
+    if (APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0))
+    {
+        if (ANazareneHUD* HUD = Cast<ANazareneHUD>(PC->GetHUD()))
+        {
+            HUD->SetStartMenuVisible(false);
+        }
+    }
+    OnMenuDismissed();
+}
+
+void ANazareneCampaignGameMode::StartSpawnBenchmarkIfArmed()
+{
+    if (!FParse::Param(FCommandLine::Get(), TEXT("NazareneSpawnBenchmark")) || PlayerCharacter == nullptr)
+    {
+        return;
+    }
+
+    TWeakObjectPtr<ANazareneCampaignGameMode> WeakThis(this);
+    PlayerCharacter->WhenPresentationReady([WeakThis]()
+    {
+        ANazareneCampaignGameMode* GameMode = WeakThis.Get();
+        if (GameMode == nullptr || GameMode->PlayerCharacter == nullptr)
+        {
+            return;
+        }
+
+        const ANazarenePlayerCharacter* ColdPlayer = GameMode->PlayerCharacter;
+        const float ColdBeginPlayMs = ColdPlayer->GetBeginPlayMilliseconds();
+        const float ColdReadyMs = ColdPlayer->GetPresentationReadyMilliseconds();
+
+        // A respawn: a second, unpossessed pawn finds the input objects and presentation bundle already resident.
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        const double SpawnStartSeconds = FPlatformTime::Seconds();
+        ANazarenePlayerCharacter* WarmPlayer = GameMode->GetWorld()->SpawnActor<ANazarenePlayerCharacter>(
+            ColdPlayer->GetClass(), ColdPlayer->GetActorLocation() + FVector(0.0f, 0.0f, 400.0f), FRotator::ZeroRotator, SpawnParams);
+        const float WarmSpawnMs = static_cast<float>((FPlatformTime::Seconds() - SpawnStartSeconds) * 1000.0);
+
+        const auto Report = [WeakThis, ColdBeginPlayMs, ColdReadyMs, WarmSpawnMs](ANazarenePlayerCharacter* Warm)
+        {
+            UE_LOG(
+                LogTemp,
+                Display,
+                TEXT("SpawnBenchmark: cold_begin_play_ms=%.3f cold_ready_ms=%.3f warm_spawn_ms=%.3f warm_begin_play_ms=%.3f warm_ready_ms=%.3f sync=%d"),
+                ColdBeginPlayMs,
+                ColdReadyMs,
+                WarmSpawnMs,
+                Warm != nullptr ? Warm->GetBeginPlayMilliseconds() : 0.0f,
+                Warm != nullptr ? Warm->GetPresentationReadyMilliseconds() : 0.0f,
+                FParse::Param(FCommandLine::Get(), TEXT("NazareneSyncPlayerPresentation")) ? 1 : 0
+            );
+
+            if (Warm != nullptr)
+            {
+                Warm->Destroy();
+            }
+            if (WeakThis.IsValid())
+            {
+                UKismetSystemLibrary::QuitGame(WeakThis.Get(), UGameplayStatics::GetPlayerController(WeakThis.Get(), 0), EQuitPreference::Quit, false);
+            }
+        };
+
+        if (WarmPlayer == nullptr)
+        {
+            Report(nullptr);
+            return;
+        }
+        TWeakObjectPtr<ANazarenePlayerCharacter> WeakWarm(WarmPlayer);
+        WarmPlayer->WhenPresentationReady([Report, WeakWarm]() { Report(WeakWarm.Get()); });
+    });
+}
+
+void ANazareneCampaignGameMode::InitializeEnemyAnimationSharing()
+{
+    if (!UAnimationSharingManager::AnimationSharingEnabled() || UAnimationSharingManager::GetAnimationSharingManager(this) != nullptr)
+    {
+        return;
+    }
+
+    // Enemies register themselves in BeginPlay, so the manager must exist before the first region spawns.
+    const UAnimationSharingSetup* SharingSetup = EnemyAnimationSharingSetup.LoadSynchronous();
+    if (SharingSetup == nullptr)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Enemy animation sharing setup missing: %s"), *EnemyAnimationSharingSetup.ToString());
+        return;
+    }
+
+    UAnimationSharingManager::CreateAnimationSharingManager(this, SharingSetup);
 }
 
 void ANazareneCampaignGameMode::BuildDefaultRegions()
@@ -466,6 +630,7 @@ void ANazareneCampaignGameMode::LoadRegion(int32 TargetRegionIndex)
     }
 
     UnloadRegionSublevel();
+    CancelPendingWaveTimers();
     ClearRegionActors();
     EnemyBySpawnId.Empty();
     BossEnemy = nullptr;
@@ -488,6 +653,8 @@ void ANazareneCampaignGameMode::LoadRegion(int32 TargetRegionIndex)
         SpawnRegionEnvironment(Region);
     }
     SpawnRegionActors(Region);
+    CaptureRegionBaseline();
+    BuildRegionFlowField(Region);
     ActiveStoryLines.Empty();
     StoryLineIndex = 0;
     GetWorldTimerManager().ClearTimer(StoryLineTimerHandle);
@@ -532,19 +699,58 @@ void ANazareneCampaignGameMode::LoadRegion(int32 TargetRegionIndex)
     SyncCompletionState();
     InitializeNativityQuestState();
     EnsureRetryCounterForCurrentRegion();
+    if (UNazareneTelemetrySubsystem* Telemetry = Session ? Session->GetSubsystem<UNazareneTelemetrySubsystem>() : nullptr)
+    {
+        Telemetry->RecordRegionEnter(RegionIndex, GetCurrentRegionRetryCount());
+    }
+    if (UNazareneMemoryReportSubsystem* MemoryReport = Session ? Session->GetSubsystem<UNazareneMemoryReportSubsystem>() : nullptr)
+    {
+        MemoryReport->ScheduleRegionCapture(Region.RegionId);
+    }
     UpdateChapterStageFromState();
     UpdateHUDForRegion(Region, bRegionCompleted);
     SetMusicState(ENazareneMusicState::Peace, false);
 
-    CrossfadeToMusic(ResolveRegionMusic(Region));
-
-    if (APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0))
+    if (UNazareneMusicSubsystem* Music = GetWorld()->GetSubsystem<UNazareneMusicSubsystem>())
     {
-        if (ANazareneHUD* HUD = Cast<ANazareneHUD>(PC->GetHUD()))
+        Music->PlayRegion(ResolveRegionMusic(Region));
+        if (Regions.IsValidIndex(RegionIndex + 1))
         {
-            HUD->SetLoadingOverlayVisible(false, TEXT(""));
+            Music->PreloadRegion(ResolveRegionMusic(Regions[RegionIndex + 1]));
         }
     }
+
+    // The player's mesh, anim class and sounds stream in behind the loading overlay.
+    if (PlayerCharacter != nullptr && !PlayerCharacter->IsPresentationReady())
+    {
+        TWeakObjectPtr<ANazareneCampaignGameMode> WeakThis(this);
+        PlayerCharacter->OnEndPlay.AddUniqueDynamic(this, &ANazareneCampaignGameMode::HandlePlayerEndPlay);
+        PlayerCharacter->WhenPresentationReady([WeakThis]()
+        {
+            if (WeakThis.IsValid())
+            {
+                WeakThis->HideLoadingOverlay();
+            }
+        });
+    }
+    else
+    {
+        HideLoadingOverlay();
+    }
+}
+
+void ANazareneCampaignGameMode::HideLoadingOverlay() const
+{
+    APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
+    if (ANazareneHUD* HUD = PC != nullptr ? Cast<ANazareneHUD>(PC->GetHUD()) : nullptr)
+    {
+        HUD->SetLoadingOverlayVisible(false, TEXT(""));
+    }
+}
+
+void ANazareneCampaignGameMode::HandlePlayerEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+    HideLoadingOverlay();
 }
 
 void ANazareneCampaignGameMode::ClearRegionActors()
@@ -591,6 +797,7 @@ void ANazareneCampaignGameMode::SetEnemyCombatEnabled(bool bEnabled)
         Enemy->SetActorHiddenInGame(!bEnabled);
         Enemy->SetActorEnableCollision(bEnabled);
         Enemy->SetActorTickEnabled(bEnabled);
+        Enemy->SetCombatSuppressed(!bEnabled);
 
         if (AAIController* AIController = Cast<AAIController>(Enemy->GetController()))
         {
@@ -614,6 +821,7 @@ void ANazareneCampaignGameMode::SetEnemyCombatEnabled(bool bEnabled)
 
 ANazareneEnemyCharacter* ANazareneCampaignGameMode::SpawnConfiguredEnemy(const FNazareneEnemySpawnDefinition& Spec, const FNazareneRegionDefinition& Region, bool bIsWaveEnemy)
 {
+    LLM_SCOPE_BYTAG(Nazarene_Enemies);
     ANazareneEnemyCharacter* Enemy = GetWorld()->SpawnActor<ANazareneEnemyCharacter>(ANazareneEnemyCharacter::StaticClass(), Spec.Location, FRotator::ZeroRotator);
     if (Enemy == nullptr)
     {
@@ -623,6 +831,7 @@ ANazareneEnemyCharacter* ANazareneCampaignGameMode::SpawnConfiguredEnemy(const F
     Enemy->SpawnId = Spec.SpawnId;
     Enemy->EnemyName = Spec.EnemyName;
     Enemy->Archetype = Spec.Archetype;
+    Enemy->SetDecisionStream(MakeEnemyDecisionStream(Spec.SpawnId));
     Enemy->ConfigureFromArchetype();
     ApplyRegionalEnemyTuning(Enemy, Region, bIsWaveEnemy);
     ConfigureEnemyBehaviorTree(Enemy);
@@ -702,6 +911,7 @@ void ANazareneCampaignGameMode::CompleteOpeningIntroSequence()
 
     SpawnIntroDeferredEnemies();
     SetEnemyCombatEnabled(true);
+    CaptureRegionBaseline();
     if (bRegionCompleted)
     {
         EnableTravelGate(true);
@@ -718,6 +928,7 @@ void ANazareneCampaignGameMode::CompleteOpeningIntroSequence()
 
 bool ANazareneCampaignGameMode::TryLoadRegionSublevel(const FNazareneRegionDefinition& Region)
 {
+    LLM_SCOPE_BYTAG(Nazarene_Regions);
     if (Region.StreamedLevelPackage.IsNone())
     {
         return false;
@@ -816,6 +1027,7 @@ void ANazareneCampaignGameMode::UnloadRegionSublevel()
 
 void ANazareneCampaignGameMode::SpawnRegionEnvironment(const FNazareneRegionDefinition& Region)
 {
+    LLM_SCOPE_BYTAG(Nazarene_Regions);
     const FName GalileeId(TEXT("galilee"));
     const FName DecapolisId(TEXT("decapolis"));
     const FName WildernessId(TEXT("wilderness"));
@@ -1750,6 +1962,7 @@ void ANazareneCampaignGameMode::SpawnRegionEnvironment(const FNazareneRegionDefi
 
 void ANazareneCampaignGameMode::SpawnRegionActors(const FNazareneRegionDefinition& Region)
 {
+    LLM_SCOPE_BYTAG(Nazarene_Regions);
     const bool bRunOpeningIntro = ShouldRunOpeningIntro();
     IntroDeferredEnemySpawns.Empty();
 
@@ -1822,6 +2035,34 @@ void ANazareneCampaignGameMode::SpawnRegionActors(const FNazareneRegionDefinitio
     }
 }
 
+void ANazareneCampaignGameMode::BuildRegionFlowField(const FNazareneRegionDefinition& Region) const
+{
+    UNazareneFlowFieldSubsystem* FlowField = GetWorld()->GetSubsystem<UNazareneFlowFieldSubsystem>();
+    if (FlowField == nullptr)
+    {
+        return;
+    }
+
+    // Cover every authored point of interest plus a margin for chase overshoot.
+    FBox Bounds(ForceInit);
+    Bounds += Region.PlayerSpawn;
+    Bounds += Region.PrayerSiteLocation;
+    Bounds += Region.TravelGateLocation;
+    for (const FNazareneEnemySpawnDefinition& Spec : Region.Enemies)
+    {
+        Bounds += Spec.Location;
+    }
+    for (const FNazareneEncounterWave& Wave : Region.EncounterWaves)
+    {
+        for (const FNazareneEnemySpawnDefinition& Spec : Wave.Enemies)
+        {
+            Bounds += Spec.Location;
+        }
+    }
+
+    FlowField->BuildRegionGrid(Bounds.ExpandBy(FVector(1200.0f, 1200.0f, 0.0f)));
+}
+
 void ANazareneCampaignGameMode::RequestTravel(int32 TargetRegionIndex)
 {
     if (!bRegionCompleted)
@@ -2032,6 +2273,10 @@ void ANazareneCampaignGameMode::NotifyPlayerDefeated()
     EnsureRetryCounterForCurrentRegion();
     const int32 NextRetryCount = GetCurrentRegionRetryCount() + 1;
     SetCurrentRegionRetryCount(NextRetryCount);
+    if (UNazareneTelemetrySubsystem* Telemetry = Session ? Session->GetSubsystem<UNazareneTelemetrySubsystem>() : nullptr)
+    {
+        Telemetry->RecordPlayerDefeated(NextRetryCount);
+    }
 
     if (APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0))
     {
@@ -2103,40 +2348,36 @@ void ANazareneCampaignGameMode::ApplySavePayload(const FNazareneSavePayload& Pay
         PlayerCharacter->ApplySnapshot(Payload.Player);
     }
 
-    TMap<FName, FNazareneEnemySnapshot> Snapshots;
-    for (const FNazareneEnemySnapshot& Snapshot : Payload.Enemies)
+    bPrayerSiteConsecrated = false;
+    if (Session && Regions.IsValidIndex(RegionIndex) && !Regions[RegionIndex].PrayerSiteId.IsNone())
     {
-        Snapshots.Add(Snapshot.SpawnId, Snapshot);
+        const FName ConsecratedFlag(*FString::Printf(TEXT("site_%s_consecrated"), *Regions[RegionIndex].PrayerSiteId.ToString()));
+        bPrayerSiteConsecrated = Session->IsFlagSet(ConsecratedFlag);
     }
 
+    // Enemies missing from the payload fall back to the baseline; saved ones are applied only where they differ.
+    RestoreRegionBaseline();
     bSuppressRedeemedCallbacks = true;
-    for (const TPair<FName, TObjectPtr<ANazareneEnemyCharacter>>& Pair : EnemyBySpawnId)
+    for (const FNazareneEnemySnapshot& Snapshot : Payload.Enemies)
     {
-        ANazareneEnemyCharacter* Enemy = Pair.Value;
+        ANazareneEnemyCharacter* Enemy = EnemyBySpawnId.FindRef(Snapshot.SpawnId);
         if (!IsValid(Enemy))
         {
             continue;
         }
-        const FNazareneEnemySnapshot* Snapshot = Snapshots.Find(Pair.Key);
-        if (Snapshot != nullptr)
+        if (Enemy->MatchesSnapshot(Snapshot))
         {
-            Enemy->ApplySnapshot(*Snapshot);
+            Enemy->ResetAwareness();
         }
         else
         {
-            Enemy->ResetToSpawn();
+            Enemy->ApplySnapshot(Snapshot);
         }
     }
     bSuppressRedeemedCallbacks = false;
 
     SyncCompletionState();
     InitializeNativityQuestState();
-    bPrayerSiteConsecrated = false;
-    if (Session && Regions.IsValidIndex(RegionIndex) && !Regions[RegionIndex].PrayerSiteId.IsNone())
-    {
-        const FName ConsecratedFlag(*FString::Printf(TEXT("site_%s_consecrated"), *Regions[RegionIndex].PrayerSiteId.ToString()));
-        bPrayerSiteConsecrated = Session->IsFlagSet(ConsecratedFlag);
-    }
     EnsureRetryCounterForCurrentRegion();
     UpdateChapterStageFromState();
     if (Regions.IsValidIndex(RegionIndex))
@@ -2229,6 +2470,10 @@ void ANazareneCampaignGameMode::OnBossRedeemed()
     }
 
     bRegionCompleted = true;
+    if (UNazareneTelemetrySubsystem* Telemetry = Session ? Session->GetSubsystem<UNazareneTelemetrySubsystem>() : nullptr)
+    {
+        Telemetry->RecordRegionComplete();
+    }
     const FNazareneRegionDefinition& Region = Regions[RegionIndex];
     const bool bRewardApplied = ApplyRegionReward(Region);
     EnableTravelGate(true);
@@ -2516,6 +2761,10 @@ void ANazareneCampaignGameMode::SetMusicState(ENazareneMusicState NewState, bool
     }
 
     MusicState = NewState;
+    if (UNazareneMusicSubsystem* Music = GetWorld()->GetSubsystem<UNazareneMusicSubsystem>())
+    {
+        Music->SetMusicState(MusicState);
+    }
 
     const TCHAR* StateLabel = TEXT("Peace");
     switch (MusicState)
@@ -2555,7 +2804,7 @@ void ANazareneCampaignGameMode::SetMusicState(ENazareneMusicState NewState, bool
     }
 }
 
-USoundBase* ANazareneCampaignGameMode::ResolveRegionMusic(const FNazareneRegionDefinition& Region) const
+TSoftObjectPtr<USoundBase> ANazareneCampaignGameMode::ResolveRegionMusic(const FNazareneRegionDefinition& Region) const
 {
     TSoftObjectPtr<USoundBase> Candidate;
     if (Region.RegionId == FName(TEXT("galilee")))
@@ -2587,108 +2836,8 @@ USoundBase* ANazareneCampaignGameMode::ResolveRegionMusic(const FNazareneRegionD
         Candidate = EmptyTombMusic;
     }
 
-    if (!Candidate.ToSoftObjectPath().IsValid())
-    {
-        return nullptr;
-    }
-
-    const FString ObjectPath = Candidate.ToSoftObjectPath().ToString();
-    FString PackagePath = ObjectPath;
-    if (PackagePath.Contains(TEXT(".")))
-    {
-        PackagePath = FPackageName::ObjectPathToPackageName(PackagePath);
-    }
-
-    if (!FPackageName::DoesPackageExist(PackagePath))
-    {
-        return nullptr;
-    }
-
-    return Candidate.LoadSynchronous();
-}
-
-void ANazareneCampaignGameMode::CrossfadeToMusic(USoundBase* NewMusic)
-{
-    if (NewMusic == nullptr)
-    {
-        // Fade out current music
-        if (RegionMusicComponent != nullptr && RegionMusicComponent->IsPlaying())
-        {
-            RegionMusicComponent->FadeOut(MusicCrossfadeDuration, 0.0f);
-        }
-        bCrossfading = false;
-        return;
-    }
-
-    // Create the primary music component if it does not exist
-    if (RegionMusicComponent == nullptr)
-    {
-        RegionMusicComponent = UGameplayStatics::CreateSound2D(this, NewMusic, 0.75f, 1.0f, 0.0f, nullptr, true);
-        if (RegionMusicComponent != nullptr)
-        {
-            RegionMusicComponent->Play();
-        }
-        return;
-    }
-
-    // If already playing the same sound, do nothing
-    if (RegionMusicComponent->IsPlaying() && RegionMusicComponent->Sound == NewMusic)
-    {
-        return;
-    }
-
-    // Create the crossfade component if it does not exist
-    if (CrossfadeAudioComponent == nullptr)
-    {
-        CrossfadeAudioComponent = UGameplayStatics::CreateSound2D(this, NewMusic, 0.0f, 1.0f, 0.0f, nullptr, true);
-    }
-    else
-    {
-        CrossfadeAudioComponent->Stop();
-        CrossfadeAudioComponent->SetSound(NewMusic);
-        CrossfadeAudioComponent->SetVolumeMultiplier(0.0f);
-    }
-
-    if (CrossfadeAudioComponent != nullptr)
-    {
-        CrossfadeAudioComponent->Play();
-    }
-
-    bCrossfading = true;
-    CrossfadeElapsed = 0.0f;
-    CrossfadeStartVolume = RegionMusicComponent->VolumeMultiplier;
-}
-
-void ANazareneCampaignGameMode::TickCrossfade(float DeltaSeconds)
-{
-    if (!bCrossfading)
-    {
-        return;
-    }
-
-    CrossfadeElapsed += DeltaSeconds;
-    const float Alpha = FMath::Clamp(CrossfadeElapsed / MusicCrossfadeDuration, 0.0f, 1.0f);
-
-    if (RegionMusicComponent != nullptr)
-    {
-        RegionMusicComponent->SetVolumeMultiplier(FMath::Lerp(CrossfadeStartVolume, 0.0f, Alpha));
-    }
-
-    if (CrossfadeAudioComponent != nullptr)
-    {
-        CrossfadeAudioComponent->SetVolumeMultiplier(FMath::Lerp(0.0f, 0.75f, Alpha));
-    }
-
-    if (Alpha >= 1.0f)
-    {
-        if (RegionMusicComponent != nullptr)
-        {
-            RegionMusicComponent->Stop();
-        }
-
-        Swap(RegionMusicComponent, CrossfadeAudioComponent);
-        bCrossfading = false;
-    }
+    // Existence and streaming are the music subsystem's job; nothing loads on the game thread here.
+    return Candidate;
 }
 
 FString ANazareneCampaignGameMode::GetRandomLoreTip() const
@@ -2802,9 +2951,11 @@ void ANazareneCampaignGameMode::ApplyRegionalEnemyTuning(ANazareneEnemyCharacter
     Enemy->MaxPoise = FMath::Max(35.0f, Enemy->MaxPoise * FMath::Lerp(1.0f, HealthScale, 0.65f));
     Enemy->CurrentHealth = Enemy->MaxHealth;
     Enemy->CurrentPoise = Enemy->MaxPoise;
+    Enemy->SyncAttributeVitals();
     Enemy->AttackDamage = FMath::Max(8.0f, Enemy->AttackDamage * DamageScale);
     Enemy->PostureDamage = FMath::Max(8.0f, Enemy->PostureDamage * FMath::Lerp(1.0f, DamageScale, 0.8f));
     Enemy->FaithReward = FMath::Max(4.0f, Enemy->FaithReward * FaithScale);
+    Enemy->RefreshDerivedStats();
 }
 
 int32 ANazareneCampaignGameMode::XPForLevel(int32 LevelValue) const
@@ -2899,7 +3050,9 @@ void ANazareneCampaignGameMode::CheckDeferredWaves(ENazareneSpawnTrigger Trigger
         {
             FNazareneEncounterWave WaveCopy = Wave;
             WaveCopy.DelaySeconds = 0.0f;
-            FTimerHandle TimerHandle;
+            // Fired one-shot timers no longer exist; drop their handles so the list only holds pending spawns.
+            PendingWaveTimers.RemoveAll([this](const FTimerHandle& Handle) { return !GetWorldTimerManager().TimerExists(Handle); });
+            FTimerHandle& TimerHandle = PendingWaveTimers.AddDefaulted_GetRef();
             GetWorldTimerManager().SetTimer(TimerHandle, [this, WaveCopy]() { SpawnWaveEnemies(WaveCopy); }, Wave.DelaySeconds, false);
         }
         else
@@ -2916,6 +3069,104 @@ void ANazareneCampaignGameMode::HandleReinforcementWave(ANazareneEnemyCharacter*
     CheckDeferredWaves(ENazareneSpawnTrigger::OnBossPhaseChange, Phase);
 }
 
+void ANazareneCampaignGameMode::CancelPendingWaveTimers()
+{
+    for (FTimerHandle& TimerHandle : PendingWaveTimers)
+    {
+        GetWorldTimerManager().ClearTimer(TimerHandle);
+    }
+    PendingWaveTimers.Empty();
+}
+
+void ANazareneCampaignGameMode::CaptureRegionBaseline()
+{
+    RegionBaseline.RegionIndex = RegionIndex;
+    RegionBaseline.Enemies.Reset(EnemyBySpawnId.Num());
+    for (const TPair<FName, TObjectPtr<ANazareneEnemyCharacter>>& Pair : EnemyBySpawnId)
+    {
+        if (IsValid(Pair.Value))
+        {
+            RegionBaseline.Enemies.Add(Pair.Value->BuildSnapshot());
+        }
+    }
+    RegionBaseline.DeferredWaves = DeferredWaves;
+}
+
+void ANazareneCampaignGameMode::RestoreRegionBaseline()
+{
+    if (RegionBaseline.RegionIndex != RegionIndex)
+    {
+        for (const TPair<FName, TObjectPtr<ANazareneEnemyCharacter>>& Pair : EnemyBySpawnId)
+        {
+            if (IsValid(Pair.Value))
+            {
+                Pair.Value->ResetToSpawn();
+            }
+        }
+        return;
+    }
+
+    CancelPendingWaveTimers();
+    bSuppressRedeemedCallbacks = true;
+
+    // Baseline enemies are reset only if they drifted from it; anything spawned since (triggered waves) is removed.
+    TSet<FName> BaselineIds;
+    BaselineIds.Reserve(RegionBaseline.Enemies.Num());
+    int32 ResetCount = 0;
+    for (const FNazareneEnemySnapshot& Snapshot : RegionBaseline.Enemies)
+    {
+        BaselineIds.Add(Snapshot.SpawnId);
+        ANazareneEnemyCharacter* Enemy = EnemyBySpawnId.FindRef(Snapshot.SpawnId);
+        if (!IsValid(Enemy))
+        {
+            continue;
+        }
+        if (Enemy->MatchesSnapshot(Snapshot))
+        {
+            Enemy->ResetAwareness();
+        }
+        else
+        {
+            Enemy->ResetToSpawn();
+            ++ResetCount;
+        }
+    }
+
+    int32 RemovedCount = 0;
+    for (auto It = EnemyBySpawnId.CreateIterator(); It; ++It)
+    {
+        if (BaselineIds.Contains(It.Key()))
+        {
+            continue;
+        }
+        if (IsValid(It.Value()))
+        {
+            RegionActors.RemoveSingleSwap(It.Value());
+            It.Value()->Destroy();
+            ++RemovedCount;
+        }
+        It.RemoveCurrent();
+    }
+
+    // Re-arm waves; a site already consecrated keeps its consecration waves standing, spawned at once.
+    DeferredWaves = RegionBaseline.DeferredWaves;
+    if (bPrayerSiteConsecrated && Regions.IsValidIndex(RegionIndex))
+    {
+        for (int32 Index = DeferredWaves.Num() - 1; Index >= 0; --Index)
+        {
+            if (DeferredWaves[Index].Trigger == ENazareneSpawnTrigger::OnPrayerSiteConsecrated)
+            {
+                SpawnWaveEnemies(DeferredWaves[Index]);
+                DeferredWaves.RemoveAt(Index);
+            }
+        }
+    }
+
+    bSuppressRedeemedCallbacks = false;
+    UE_LOG(LogTemp, Log, TEXT("Region baseline restored: %d/%d enemies reset, %d removed, %d waves armed."),
+        ResetCount, RegionBaseline.Enemies.Num(), RemovedCount, DeferredWaves.Num());
+}
+
 // -----------------------------------------------------------------------
 // Task 7: Menu Camera
 // -----------------------------------------------------------------------
@@ -2927,14 +3178,7 @@ void ANazareneCampaignGameMode::SpawnMenuCamera()
         return;
     }
 
-    FVector CameraCenter = FVector::ZeroVector;
-    if (Regions.IsValidIndex(RegionIndex))
-    {
-        CameraCenter = Regions[RegionIndex].PrayerSiteLocation;
-    }
-
-    const FVector MenuStageCenter = CameraCenter + FVector(0.0f, 0.0f, 2400.0f);
-    SpawnMenuSetpiece(MenuStageCenter);
+    const FVector MenuStageCenter = GetMenuStageCenter();
     const FVector TombFocusCenter = MenuStageCenter + FVector(430.0f, 0.0f, 112.0f);
     const FVector PanStartOffset(-180.0f, 0.0f, 96.0f);
 
@@ -2967,6 +3211,16 @@ void ANazareneCampaignGameMode::SpawnMenuCamera()
     }
 }
 
+FVector ANazareneCampaignGameMode::GetMenuStageCenter() const
+{
+    FVector CameraCenter = FVector::ZeroVector;
+    if (Regions.IsValidIndex(RegionIndex))
+    {
+        CameraCenter = Regions[RegionIndex].PrayerSiteLocation;
+    }
+    return CameraCenter + FVector(0.0f, 0.0f, 2400.0f);
+}
+
 void ANazareneCampaignGameMode::DestroyMenuCamera()
 {
     if (MenuCamera == nullptr)
@@ -2998,6 +3252,11 @@ void ANazareneCampaignGameMode::OnMenuDismissed()
     {
         StartOpeningIntroSequence();
     }
+
+    if (UNazareneInputReplaySubsystem* InputReplay = Session ? Session->GetSubsystem<UNazareneInputReplaySubsystem>() : nullptr)
+    {
+        InputReplay->NotifyGameplayStarted(PlayerCharacter);
+    }
 }
 
 void ANazareneCampaignGameMode::SpawnMenuSetpiece(const FVector& CameraCenter)
@@ -3010,6 +3269,69 @@ void ANazareneCampaignGameMode::SpawnMenuSetpiece(const FVector& CameraCenter)
         return;
     }
 
+    // The authored diorama is an instanced sublevel placed at the stage center and loaded asynchronously.
+    const FString ResolvedSetpieceLevelPath = NazareneAssetResolver::ResolveObjectPath(
+        TEXT("MenuSetpieceLevel"),
+        TEXT("/Game/Maps/Menu/L_MenuSetpiece.L_MenuSetpiece"),
+        {});
+    if (!ResolvedSetpieceLevelPath.IsEmpty())
+    {
+        // bPackageFound only says the package exists; the async load itself is watched by CheckMenuSetpieceStreaming.
+        bool bPackageFound = false;
+        MenuSetpieceLevel = ULevelStreamingDynamic::LoadLevelInstance(
+            World,
+            FPackageName::ObjectPathToPackageName(ResolvedSetpieceLevelPath),
+            CameraCenter,
+            FRotator::ZeroRotator,
+            bPackageFound);
+        if (bPackageFound && MenuSetpieceLevel != nullptr)
+        {
+            MenuSetpieceCenter = CameraCenter;
+            GetWorldTimerManager().SetTimer(MenuSetpieceStreamTimer, this, &ANazareneCampaignGameMode::CheckMenuSetpieceStreaming, 0.2f, true);
+            return;
+        }
+
+        UE_LOG(LogTemp, Warning, TEXT("Menu setpiece level not found: %s. Building it at runtime."), *ResolvedSetpieceLevelPath);
+        MenuSetpieceLevel = nullptr;
+    }
+
+    BuildMenuSetpieceActors(CameraCenter);
+}
+
+void ANazareneCampaignGameMode::CheckMenuSetpieceStreaming()
+{
+    if (MenuSetpieceLevel == nullptr)
+    {
+        GetWorldTimerManager().ClearTimer(MenuSetpieceStreamTimer);
+        return;
+    }
+
+    const ELevelStreamingState State = MenuSetpieceLevel->GetLevelStreamingState();
+    if (State == ELevelStreamingState::LoadedVisible)
+    {
+        GetWorldTimerManager().ClearTimer(MenuSetpieceStreamTimer);
+        return;
+    }
+    if (State != ELevelStreamingState::FailedToLoad)
+    {
+        return;
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("Menu setpiece level failed to load: %s. Building it at runtime."), *MenuSetpieceLevel->GetWorldAssetPackageName());
+    GetWorldTimerManager().ClearTimer(MenuSetpieceStreamTimer);
+    MenuSetpieceLevel->SetIsRequestingUnloadAndRemoval(true);
+    MenuSetpieceLevel = nullptr;
+    BuildMenuSetpieceActors(MenuSetpieceCenter);
+}
+
+void ANazareneCampaignGameMode::BuildMenuSetpieceActors(const FVector& CameraCenter)
+{
+    UWorld* World = GetWorld();
+    if (World == nullptr)
+    {
+        return;
+    }
+
     const FString ResolvedBlockMeshPath = NazareneAssetResolver::ResolveObjectPath(
         TEXT("EnvMeshBlock"),
         TEXT("/Game/Art/Environment/Meshes/SM_BiblicalBlock.SM_BiblicalBlock"),
@@ -3178,6 +3500,16 @@ void ANazareneCampaignGameMode::SpawnMenuSetpiece(const FVector& CameraCenter)
 
 void ANazareneCampaignGameMode::DestroyMenuSetpiece()
 {
+    GetWorldTimerManager().ClearTimer(MenuSetpieceStreamTimer);
+    if (MenuSetpieceLevel != nullptr)
+    {
+        // Unloads in the background; the diorama's actors go with the level.
+        MenuSetpieceLevel->SetShouldBeVisible(false);
+        MenuSetpieceLevel->SetShouldBeLoaded(false);
+        MenuSetpieceLevel->SetIsRequestingUnloadAndRemoval(true);
+        MenuSetpieceLevel = nullptr;
+    }
+
     for (AActor* Actor : MenuSetpieceActors)
     {
         if (IsValid(Actor))
@@ -0,0 +1,235 @@
+#include "NazareneCombatAudioSubsystem.h"
+
+#include "Components/AudioComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/WorldSettings.h"
+#include "Sound/SoundBase.h"
+#include "NazareneStats.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Combat Voices Active"), STAT_NazareneCombatVoicesActive, STATGROUP_NazareneCombat);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Combat Sound Requests / Frame"), STAT_NazareneCombatSoundRequests, STATGROUP_NazareneCombat);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Combat Sounds Culled / Frame"), STAT_NazareneCombatSoundsCulled, STATGROUP_NazareneCombat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Combat Voices Stolen"), STAT_NazareneCombatVoicesStolen, STATGROUP_NazareneCombat);
+
+UNazareneCombatAudioSubsystem::UNazareneCombatAudioSubsystem()
+{
+    CategoryVoiceLimits.Add(ENazareneCombatAudioCategory::Attack, 4);
+    CategoryVoiceLimits.Add(ENazareneCombatAudioCategory::Movement, 2);
+    CategoryVoiceLimits.Add(ENazareneCombatAudioCategory::Impact, 4);
+    CategoryVoiceLimits.Add(ENazareneCombatAudioCategory::Hurt, 2);
+    CategoryVoiceLimits.Add(ENazareneCombatAudioCategory::Guard, 2);
+    CategoryVoiceLimits.Add(ENazareneCombatAudioCategory::Redeem, 3);
+    CategoryVoiceLimits.Add(ENazareneCombatAudioCategory::Miracle, 2);
+
+    // Feedback the player must not miss outranks swing whooshes and footwork.
+    CategoryPriorities.Add(ENazareneCombatAudioCategory::Attack, 0.6f);
+    CategoryPriorities.Add(ENazareneCombatAudioCategory::Movement, 0.4f);
+    CategoryPriorities.Add(ENazareneCombatAudioCategory::Impact, 0.8f);
+    CategoryPriorities.Add(ENazareneCombatAudioCategory::Hurt, 1.0f);
+    CategoryPriorities.Add(ENazareneCombatAudioCategory::Guard, 0.9f);
+    CategoryPriorities.Add(ENazareneCombatAudioCategory::Redeem, 0.9f);
+    CategoryPriorities.Add(ENazareneCombatAudioCategory::Miracle, 0.7f);
+}
+
+TStatId UNazareneCombatAudioSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UNazareneCombatAudioSubsystem, STATGROUP_Tickables);
+}
+
+void UNazareneCombatAudioSubsystem::Deinitialize()
+{
+    for (UAudioComponent* Voice : Voices)
+    {
+        if (Voice != nullptr)
+        {
+            Voice->Stop();
+            Voice->DestroyComponent();
+        }
+    }
+    Voices.Reset();
+    VoiceSlots.Reset();
+    PendingRequests.Reset();
+
+    Super::Deinitialize();
+}
+
+void UNazareneCombatAudioSubsystem::Request(const UObject* WorldContextObject, USoundBase* Sound, const FVector& Location, float VolumeMultiplier, ENazareneCombatAudioCategory Category)
+{
+    const UWorld* World = WorldContextObject != nullptr ? WorldContextObject->GetWorld() : nullptr;
+    if (UNazareneCombatAudioSubsystem* Audio = World != nullptr ? World->GetSubsystem<UNazareneCombatAudioSubsystem>() : nullptr)
+    {
+        Audio->RequestSound(Sound, Location, VolumeMultiplier, Category);
+    }
+}
+
+void UNazareneCombatAudioSubsystem::RequestSound(USoundBase* Sound, const FVector& Location, float VolumeMultiplier, ENazareneCombatAudioCategory Category)
+{
+    if (Sound == nullptr || VolumeMultiplier <= KINDA_SMALL_NUMBER)
+    {
+        return;
+    }
+
+    const float MergeDistanceSq = FMath::Square(MergeDistance);
+    for (FSoundRequest& Pending : PendingRequests)
+    {
+        if (Pending.Sound == Sound && FVector::DistSquared(Pending.Location, Location) <= MergeDistanceSq)
+        {
+            Pending.VolumeMultiplier = FMath::Max(Pending.VolumeMultiplier, VolumeMultiplier);
+            return;
+        }
+    }
+
+    FSoundRequest& Request = PendingRequests.AddDefaulted_GetRef();
+    Request.Sound = Sound;
+    Request.Location = Location;
+    Request.VolumeMultiplier = VolumeMultiplier;
+    Request.Category = Category;
+}
+
+void UNazareneCombatAudioSubsystem::Tick(float DeltaTime)
+{
+    const int32 RequestCount = PendingRequests.Num();
+    SET_DWORD_STAT(STAT_NazareneCombatSoundRequests, RequestCount);
+    if (RequestCount == 0)
+    {
+        SET_DWORD_STAT(STAT_NazareneCombatSoundsCulled, 0);
+        SET_DWORD_STAT(STAT_NazareneCombatVoicesActive, GetActiveVoiceCount());
+        return;
+    }
+
+    FVector ListenerLocation;
+    const bool bHasListener = ResolveListener(ListenerLocation);
+    const float Falloff = FMath::Max(1.0f, PriorityFalloffDistance);
+    for (FSoundRequest& Request : PendingRequests)
+    {
+        const float* CategoryPriority = CategoryPriorities.Find(Request.Category);
+        const float Distance = bHasListener ? FVector::Dist(ListenerLocation, Request.Location) : 0.0f;
+        Request.Score = (CategoryPriority != nullptr ? *CategoryPriority : 0.5f) * Request.VolumeMultiplier / (1.0f + Distance / Falloff);
+    }
+    PendingRequests.StableSort([](const FSoundRequest& A, const FSoundRequest& B) { return A.Score > B.Score; });
+
+    int32 Started = 0;
+    for (const FSoundRequest& Request : PendingRequests)
+    {
+        if (Started >= MaxVoicesPerFrame)
+        {
+            break;
+        }
+
+        USoundBase* Sound = Request.Sound.Get();
+        const int32* Limit = CategoryVoiceLimits.Find(Request.Category);
+        if (Sound == nullptr || (Limit != nullptr && CountPlaying(Request.Category) >= *Limit))
+        {
+            continue;
+        }
+
+        // Requests are sorted, so once one cannot get or steal a voice none of the rest can.
+        const int32 VoiceIndex = AcquireVoice(Request.Score);
+        if (VoiceIndex == INDEX_NONE)
+        {
+            break;
+        }
+
+        FVoiceSlot& Slot = VoiceSlots[VoiceIndex];
+        Slot.Category = Request.Category;
+        Slot.Score = Request.Score;
+        Slot.StartSeconds = GetWorld()->GetAudioTimeSeconds();
+
+        UAudioComponent* Voice = Voices[VoiceIndex];
+        Voice->SetWorldLocation(Request.Location);
+        Voice->SetSound(Sound);
+        Voice->SetVolumeMultiplier(Request.VolumeMultiplier);
+        Voice->Play();
+        ++Started;
+    }
+
+    SET_DWORD_STAT(STAT_NazareneCombatSoundsCulled, RequestCount - Started);
+    SET_DWORD_STAT(STAT_NazareneCombatVoicesActive, GetActiveVoiceCount());
+    PendingRequests.Reset();
+}
+
+int32 UNazareneCombatAudioSubsystem::AcquireVoice(float Score)
+{
+    int32 StealIndex = INDEX_NONE;
+    for (int32 Index = 0; Index < Voices.Num(); ++Index)
+    {
+        if (Voices[Index] == nullptr)
+        {
+            continue;
+        }
+        if (!Voices[Index]->IsPlaying())
+        {
+            return Index;
+        }
+
+        const FVoiceSlot& Slot = VoiceSlots[Index];
+        if (StealIndex == INDEX_NONE || Slot.Score < VoiceSlots[StealIndex].Score
+            || (Slot.Score == VoiceSlots[StealIndex].Score && Slot.StartSeconds < VoiceSlots[StealIndex].StartSeconds))
+        {
+            StealIndex = Index;
+        }
+    }
+
+    UWorld* World = GetWorld();
+    if (Voices.Num() < PoolSize && World != nullptr && World->GetWorldSettings() != nullptr)
+    {
+        UAudioComponent* Voice = NewObject<UAudioComponent>(World->GetWorldSettings());
+        Voice->bAutoActivate = false;
+        Voice->bAutoDestroy = false;
+        Voice->bAllowSpatialization = true;
+        Voice->RegisterComponentWithWorld(World);
+        VoiceSlots.AddDefaulted();
+        return Voices.Add(Voice);
+    }
+
+    if (StealIndex == INDEX_NONE || VoiceSlots[StealIndex].Score >= Score)
+    {
+        return INDEX_NONE;
+    }
+
+    Voices[StealIndex]->Stop();
+    INC_DWORD_STAT(STAT_NazareneCombatVoicesStolen);
+    return StealIndex;
+}
+
+bool UNazareneCombatAudioSubsystem::ResolveListener(FVector& OutLocation) const
+{
+    const UWorld* World = GetWorld();
+    APlayerController* PlayerController = World != nullptr ? World->GetFirstPlayerController() : nullptr;
+    if (PlayerController == nullptr)
+    {
+        return false;
+    }
+
+    FVector Front;
+    FVector Right;
+    PlayerController->GetAudioListenerPosition(OutLocation, Front, Right);
+    return true;
+}
+
+int32 UNazareneCombatAudioSubsystem::CountPlaying(ENazareneCombatAudioCategory Category) const
+{
+    int32 Count = 0;
+    for (int32 Index = 0; Index < Voices.Num(); ++Index)
+    {
+        if (VoiceSlots[Index].Category == Category && Voices[Index] != nullptr && Voices[Index]->IsPlaying())
+        {
+            ++Count;
+        }
+    }
+    return Count;
+}
+
+int32 UNazareneCombatAudioSubsystem::GetActiveVoiceCount() const
+{
+    int32 Count = 0;
+    for (const UAudioComponent* Voice : Voices)
+    {
+        if (Voice != nullptr && Voice->IsPlaying())
+        {
+            ++Count;
+        }
+    }
+    return Count;
+}
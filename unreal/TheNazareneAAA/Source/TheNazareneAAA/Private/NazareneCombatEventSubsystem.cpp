@@ -0,0 +1,202 @@
+#include "NazareneCombatEventSubsystem.h"
+
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "NazareneCombatAudioSubsystem.h"
+#include "NazareneStats.h"
+#include "NiagaraFunctionLibrary.h"
+#include "NiagaraSystem.h"
+#include "Sound/SoundBase.h"
+
+DECLARE_CYCLE_STAT(TEXT("Combat Event Flush"), STAT_NazareneCombatEventFlush, STATGROUP_NazareneCombat);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Combat Events / Frame"), STAT_NazareneCombatEventsPerFrame, STATGROUP_NazareneCombat);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Combat Events Dropped"), STAT_NazareneCombatEventsDropped, STATGROUP_NazareneCombat);
+
+namespace
+{
+    bool CanCoalesce(const FNazareneCombatEvent& Existing, const FNazareneCombatEvent& Incoming)
+    {
+        return Existing.Type == Incoming.Type
+            && Existing.Target == Incoming.Target
+            && Existing.NumberType == Incoming.NumberType
+            && Existing.bDisplayNumber == Incoming.bDisplayNumber;
+    }
+
+    ENazareneCombatAudioCategory AudioCategoryFor(const FNazareneCombatEvent& Event)
+    {
+        switch (Event.Type)
+        {
+        case ENazareneCombatEventType::Block:
+        case ENazareneCombatEventType::Parry:
+            return ENazareneCombatAudioCategory::Guard;
+        case ENazareneCombatEventType::Redeem:
+            return ENazareneCombatAudioCategory::Redeem;
+        default:
+        {
+            const APawn* TargetPawn = Cast<APawn>(Event.Target.Get());
+            return TargetPawn != nullptr && TargetPawn->IsPlayerControlled()
+                ? ENazareneCombatAudioCategory::Hurt
+                : ENazareneCombatAudioCategory::Impact;
+        }
+        }
+    }
+}
+
+FNazareneCombatEvent FNazareneCombatEvent::Make(ENazareneCombatEventType InType, const AActor* InTarget, const AActor* InInstigator)
+{
+    FNazareneCombatEvent Event;
+    Event.Type = InType;
+    Event.Target = InTarget;
+    Event.Instigator = InInstigator;
+    if (InTarget != nullptr)
+    {
+        Event.Location = InTarget->GetActorLocation();
+        Event.Rotation = InTarget->GetActorRotation();
+    }
+    return Event;
+}
+
+TStatId UNazareneCombatEventSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UNazareneCombatEventSubsystem, STATGROUP_Tickables);
+}
+
+void UNazareneCombatEventSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    const int32 Capacity = FMath::Max(16, EventCapacity);
+    for (FEventPage& Page : Pages)
+    {
+        Page.Events.SetNum(Capacity);
+        Page.Stamps = MakeUnique<std::atomic<uint32>[]>(Capacity);
+        for (int32 Index = 0; Index < Capacity; ++Index)
+        {
+            Page.Stamps[Index].store(0, std::memory_order_relaxed);
+        }
+        Page.WriteCursor.store(0, std::memory_order_relaxed);
+    }
+
+    Pages[0].Serial.store(NextSerial++, std::memory_order_relaxed);
+    ActivePage.store(0, std::memory_order_release);
+    FrameEvents.Reserve(Capacity);
+}
+
+void UNazareneCombatEventSubsystem::Publish(const FNazareneCombatEvent& Event)
+{
+    FEventPage& Page = Pages[ActivePage.load(std::memory_order_acquire)];
+    const int32 Slot = Page.WriteCursor.fetch_add(1, std::memory_order_relaxed);
+    if (Slot >= Page.Events.Num())
+    {
+        DroppedThisFrame.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    Page.Events[Slot] = Event;
+    // The stamp publishes the slot; the flush skips slots still being written.
+    Page.Stamps[Slot].store(Page.Serial.load(std::memory_order_relaxed), std::memory_order_release);
+}
+
+void UNazareneCombatEventSubsystem::Publish(const UObject* WorldContextObject, const FNazareneCombatEvent& Event)
+{
+    const UWorld* World = WorldContextObject != nullptr ? WorldContextObject->GetWorld() : nullptr;
+    if (UNazareneCombatEventSubsystem* Events = World != nullptr ? World->GetSubsystem<UNazareneCombatEventSubsystem>() : nullptr)
+    {
+        Events->Publish(Event);
+    }
+}
+
+void UNazareneCombatEventSubsystem::Tick(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_NazareneCombatEventFlush);
+
+    // Open the other page before reading this one so publishers never wait on the flush.
+    const int32 ReadIndex = ActivePage.load(std::memory_order_relaxed);
+    FEventPage& NextPage = Pages[1 - ReadIndex];
+    NextPage.WriteCursor.store(0, std::memory_order_relaxed);
+    NextPage.Serial.store(NextSerial++, std::memory_order_relaxed);
+    if (NextSerial == 0)
+    {
+        NextSerial = 1;
+    }
+    ActivePage.store(1 - ReadIndex, std::memory_order_release);
+
+    CoalescePage(Pages[ReadIndex]);
+
+    const int32 Dropped = DroppedThisFrame.exchange(0, std::memory_order_relaxed);
+    DroppedEventsTotal += Dropped;
+    EventsLastFrame = FrameEvents.Num();
+    SET_DWORD_STAT(STAT_NazareneCombatEventsPerFrame, EventsLastFrame);
+    SET_DWORD_STAT(STAT_NazareneCombatEventsDropped, DroppedEventsTotal);
+
+    if (FrameEvents.Num() == 0)
+    {
+        return;
+    }
+
+    const TConstArrayView<FNazareneCombatEvent> Batch(FrameEvents);
+    RunPresentationPass(Batch);
+    OnEventsFlushed.Broadcast(Batch);
+}
+
+void UNazareneCombatEventSubsystem::CoalescePage(FEventPage& Page)
+{
+    FrameEvents.Reset();
+
+    const uint32 Serial = Page.Serial.load(std::memory_order_relaxed);
+    const int32 Written = FMath::Min(Page.WriteCursor.load(std::memory_order_acquire), Page.Events.Num());
+    for (int32 Slot = 0; Slot < Written; ++Slot)
+    {
+        if (Page.Stamps[Slot].load(std::memory_order_acquire) != Serial)
+        {
+            DroppedThisFrame.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        const FNazareneCombatEvent& Event = Page.Events[Slot];
+        FNazareneCombatEvent* Existing = FrameEvents.FindByPredicate([&Event](const FNazareneCombatEvent& Candidate)
+        {
+            return CanCoalesce(Candidate, Event);
+        });
+
+        if (Existing != nullptr)
+        {
+            Existing->Amount += Event.Amount;
+            Existing->Param = Event.Param;
+            Existing->Count += Event.Count;
+            Existing->VolumeMultiplier = FMath::Max(Existing->VolumeMultiplier, Event.VolumeMultiplier);
+        }
+        else if (FrameEvents.Num() < MaxEventsPerFrame)
+        {
+            FrameEvents.Add(Event);
+        }
+    }
+}
+
+void UNazareneCombatEventSubsystem::RunPresentationPass(TConstArrayView<FNazareneCombatEvent> Events) const
+{
+    UWorld* World = GetWorld();
+    if (World == nullptr)
+    {
+        return;
+    }
+
+    UNazareneCombatAudioSubsystem* Audio = World->GetSubsystem<UNazareneCombatAudioSubsystem>();
+    int32 EffectsSpawned = 0;
+    for (const FNazareneCombatEvent& Event : Events)
+    {
+        if (Audio != nullptr && Event.Sound.IsValid())
+        {
+            Audio->RequestSound(Event.Sound.Get(), Event.Location, Event.VolumeMultiplier, AudioCategoryFor(Event));
+        }
+
+        if (UNiagaraSystem* Effect = Event.Effect.Get())
+        {
+            if (EffectsSpawned < MaxEffectsPerFrame)
+            {
+                UNiagaraFunctionLibrary::SpawnSystemAtLocation(World, Effect, Event.Location, Event.Rotation);
+                ++EffectsSpawned;
+            }
+        }
+    }
+}
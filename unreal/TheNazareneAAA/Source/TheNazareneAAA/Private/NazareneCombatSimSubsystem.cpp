@@ -0,0 +1,67 @@
+#include "NazareneCombatSimSubsystem.h"
+
+#include "HAL/PlatformTime.h"
+#include "NazareneStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Combat Step"), STAT_NazareneCombatStep, STATGROUP_NazareneCombat);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Combat Steps / Frame"), STAT_NazareneCombatStepsPerFrame, STATGROUP_NazareneCombat);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Combat Participants"), STAT_NazareneCombatParticipants, STATGROUP_NazareneCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Combat Step Avg (ms)"), STAT_NazareneCombatStepAvgMs, STATGROUP_NazareneCombat);
+
+TStatId UNazareneCombatSimSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UNazareneCombatSimSubsystem, STATGROUP_Tickables);
+}
+
+void UNazareneCombatSimSubsystem::RegisterParticipant(UObject* Participant)
+{
+    if (Participant == nullptr || !Participant->GetClass()->ImplementsInterface(UNazareneCombatSimulated::StaticClass()))
+    {
+        return;
+    }
+    Participants.AddUnique(Participant);
+}
+
+void UNazareneCombatSimSubsystem::UnregisterParticipant(UObject* Participant)
+{
+    Participants.Remove(Participant);
+}
+
+void UNazareneCombatSimSubsystem::Tick(float DeltaTime)
+{
+    const float StepSeconds = GetStepSeconds();
+    Accumulator += FMath::Max(0.0f, DeltaTime);
+
+    int32 Steps = 0;
+    while (Accumulator >= StepSeconds && Steps < MaxStepsPerFrame)
+    {
+        SCOPE_CYCLE_COUNTER(STAT_NazareneCombatStep);
+        const double StepStart = FPlatformTime::Seconds();
+
+        // Registration order is the simulation order; it stays stable for replays.
+        for (int32 Index = 0; Index < Participants.Num(); ++Index)
+        {
+            if (INazareneCombatSimulated* Simulated = Cast<INazareneCombatSimulated>(Participants[Index].Get()))
+            {
+                Simulated->CombatStep(StepSeconds);
+            }
+        }
+
+        const double StepMilliseconds = (FPlatformTime::Seconds() - StepStart) * 1000.0;
+        AverageStepMilliseconds = FMath::Lerp(AverageStepMilliseconds, StepMilliseconds, 0.05);
+        Accumulator -= StepSeconds;
+        ++Steps;
+    }
+
+    if (Steps >= MaxStepsPerFrame && Accumulator >= StepSeconds)
+    {
+        Accumulator = FMath::Fmod(Accumulator, StepSeconds);
+    }
+
+    Participants.RemoveAll([](const TWeakObjectPtr<UObject>& Participant) { return !Participant.IsValid(); });
+    StepsLastFrame = Steps;
+
+    SET_DWORD_STAT(STAT_NazareneCombatStepsPerFrame, Steps);
+    SET_DWORD_STAT(STAT_NazareneCombatParticipants, Participants.Num());
+    SET_FLOAT_STAT(STAT_NazareneCombatStepAvgMs, static_cast<float>(AverageStepMilliseconds));
+}
@@ -0,0 +1,197 @@
+#include "NazareneDialogueVoiceSubsystem.h"
+
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "Sound/SoundBase.h"
+#include "Stats/Stats.h"
+#include "TimerManager.h"
+
+DECLARE_STATS_GROUP(TEXT("Nazarene Audio"), STATGROUP_NazareneAudio, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Voice Sets Resident"), STAT_NazareneVoiceSetsResident, STATGROUP_NazareneAudio);
+
+void UNazareneDialogueVoiceSubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(SweepTimer);
+    }
+
+    while (VoiceSets.Num() > 0)
+    {
+        DropVoiceSet(VoiceSets.Num() - 1);
+    }
+
+    Super::Deinitialize();
+}
+
+int32 UNazareneDialogueVoiceSubsystem::FindVoiceSet(const UObject* Owner) const
+{
+    return VoiceSets.IndexOfByPredicate([Owner](const FVoiceSet& Set) { return Set.Owner.Get() == Owner; });
+}
+
+void UNazareneDialogueVoiceSubsystem::AcquireVoiceSet(const UObject* Owner, const TArray<TSoftObjectPtr<USoundBase>>& Clips)
+{
+    if (Owner == nullptr)
+    {
+        return;
+    }
+
+    // Re-entering within the release delay reuses the resident set; it moves to the most recent slot.
+    const int32 ExistingIndex = FindVoiceSet(Owner);
+    if (ExistingIndex != INDEX_NONE)
+    {
+        FVoiceSet Set = MoveTemp(VoiceSets[ExistingIndex]);
+        VoiceSets.RemoveAt(ExistingIndex);
+        Set.bPinned = true;
+        Set.ReleaseAtSeconds = 0.0;
+        VoiceSets.Add(MoveTemp(Set));
+        return;
+    }
+
+    TArray<FSoftObjectPath> ToLoad;
+    for (const TSoftObjectPtr<USoundBase>& Clip : Clips)
+    {
+        if (!Clip.IsNull())
+        {
+            ToLoad.AddUnique(Clip.ToSoftObjectPath());
+        }
+    }
+    if (ToLoad.Num() == 0)
+    {
+        return;
+    }
+
+    FVoiceSet& Set = VoiceSets.AddDefaulted_GetRef();
+    Set.Owner = Owner;
+    Set.bPinned = true;
+    Set.Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(ToLoad, FStreamableDelegate(), FStreamableManager::DefaultAsyncLoadPriority);
+
+    EvictUnpinnedVoiceSets();
+    SET_DWORD_STAT(STAT_NazareneVoiceSetsResident, VoiceSets.Num());
+}
+
+void UNazareneDialogueVoiceSubsystem::ReleaseVoiceSet(const UObject* Owner)
+{
+    const int32 Index = FindVoiceSet(Owner);
+    if (Index == INDEX_NONE || !VoiceSets[Index].bPinned)
+    {
+        return;
+    }
+
+    const UWorld* World = GetWorld();
+    VoiceSets[Index].bPinned = false;
+    VoiceSets[Index].ReleaseAtSeconds = (World != nullptr ? World->GetTimeSeconds() : 0.0) + FMath::Max(0.0f, ReleaseDelaySeconds);
+
+    EvictUnpinnedVoiceSets();
+    ScheduleSweep();
+}
+
+void UNazareneDialogueVoiceSubsystem::WhenVoiceLoaded(const TSoftObjectPtr<USoundBase>& Clip, TFunction<void(USoundBase*)> OnLoaded)
+{
+    if (Clip.IsNull() || !OnLoaded)
+    {
+        return;
+    }
+
+    if (USoundBase* Resident = Clip.Get())
+    {
+        OnLoaded(Resident);
+        return;
+    }
+
+    // Still streaming with its set (or spoken from outside the sphere); the active sound keeps it alive once started.
+    const FSoftObjectPath ClipPath = Clip.ToSoftObjectPath();
+    UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        ClipPath,
+        FStreamableDelegate::CreateLambda([ClipPath, OnLoaded = MoveTemp(OnLoaded)]()
+        {
+            if (USoundBase* Sound = Cast<USoundBase>(ClipPath.ResolveObject()))
+            {
+                OnLoaded(Sound);
+            }
+        }),
+        FStreamableManager::AsyncLoadHighPriority);
+}
+
+void UNazareneDialogueVoiceSubsystem::DropVoiceSet(int32 Index)
+{
+    TSharedPtr<FStreamableHandle> Handle = MoveTemp(VoiceSets[Index].Handle);
+    VoiceSets.RemoveAt(Index);
+    if (Handle.IsValid())
+    {
+        if (Handle->HasLoadCompleted())
+        {
+            Handle->ReleaseHandle();
+        }
+        else
+        {
+            Handle->CancelHandle();
+        }
+    }
+    SET_DWORD_STAT(STAT_NazareneVoiceSetsResident, VoiceSets.Num());
+}
+
+void UNazareneDialogueVoiceSubsystem::EvictUnpinnedVoiceSets()
+{
+    int32 Unpinned = 0;
+    for (const FVoiceSet& Set : VoiceSets)
+    {
+        Unpinned += Set.bPinned ? 0 : 1;
+    }
+
+    // Oldest first, so the sets dropped early are the ones the player visited longest ago.
+    for (int32 Index = 0; Index < VoiceSets.Num() && Unpinned > FMath::Max(0, MaxCachedVoiceSets);)
+    {
+        if (!VoiceSets[Index].bPinned || !VoiceSets[Index].Owner.IsValid())
+        {
+            Unpinned -= VoiceSets[Index].bPinned ? 0 : 1;
+            DropVoiceSet(Index);
+            continue;
+        }
+        ++Index;
+    }
+}
+
+void UNazareneDialogueVoiceSubsystem::SweepReleasedVoiceSets()
+{
+    const UWorld* World = GetWorld();
+    const double Now = World != nullptr ? World->GetTimeSeconds() : 0.0;
+    for (int32 Index = VoiceSets.Num() - 1; Index >= 0; --Index)
+    {
+        const FVoiceSet& Set = VoiceSets[Index];
+        if (!Set.Owner.IsValid() || (!Set.bPinned && Set.ReleaseAtSeconds <= Now))
+        {
+            DropVoiceSet(Index);
+        }
+    }
+    ScheduleSweep();
+}
+
+void UNazareneDialogueVoiceSubsystem::ScheduleSweep()
+{
+    UWorld* World = GetWorld();
+    if (World == nullptr)
+    {
+        return;
+    }
+
+    double NextRelease = TNumericLimits<double>::Max();
+    for (const FVoiceSet& Set : VoiceSets)
+    {
+        if (!Set.bPinned)
+        {
+            NextRelease = FMath::Min(NextRelease, Set.ReleaseAtSeconds);
+        }
+    }
+
+    FTimerManager& TimerManager = World->GetTimerManager();
+    if (NextRelease == TNumericLimits<double>::Max())
+    {
+        TimerManager.ClearTimer(SweepTimer);
+        return;
+    }
+
+    const float Delay = FMath::Max(0.1f, static_cast<float>(NextRelease - World->GetTimeSeconds()));
+    TimerManager.SetTimer(SweepTimer, FTimerDelegate::CreateUObject(this, &UNazareneDialogueVoiceSubsystem::SweepReleasedVoiceSets), Delay, false);
+}
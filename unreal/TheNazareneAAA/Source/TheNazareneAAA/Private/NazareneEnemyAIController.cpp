@@ -84,6 +84,15 @@ AActor* ANazareneEnemyAIController::GetCurrentTargetActor() const
     return CurrentTargetActor.Get();
 }
 
+void ANazareneEnemyAIController::ResetTarget()
+{
+    if (RuntimePerception != nullptr)
+    {
+        RuntimePerception->ForgetAll();
+    }
+    PushTargetToBlackboard(nullptr);
+}
+
 void ANazareneEnemyAIController::PushTargetToBlackboard(AActor* TargetActor)
 {
     CurrentTargetActor = TargetActor;
@@ -0,0 +1,24 @@
+#include "NazareneEnemyAnimSharingProcessor.h"
+
+#include "NazareneEnemyCharacter.h"
+
+UNazareneEnemyAnimSharingProcessor::UNazareneEnemyAnimSharingProcessor()
+{
+    AnimationStateEnum = StaticEnum<ENazareneEnemyState>();
+}
+
+void UNazareneEnemyAnimSharingProcessor::ProcessActorState_Implementation(int32& OutState, AActor* InActor, uint8 CurrentState, uint8 OnDemandState, bool& bShouldProcess)
+{
+    const ANazareneEnemyCharacter* Enemy = Cast<ANazareneEnemyCharacter>(InActor);
+    if (Enemy == nullptr || Enemy->IsRedeemed())
+    {
+        OutState = CurrentState;
+        bShouldProcess = false;
+        return;
+    }
+
+    // Windup, Casting and Parried are authored as on-demand states in the setup asset so each
+    // enemy's tell starts from frame zero; the looping states share master pose instances.
+    OutState = static_cast<int32>(Enemy->GetState());
+    bShouldProcess = true;
+}
@@ -1,5 +1,6 @@
 #include "NazareneEnemyCharacter.h"
 
+#include "AnimationSharingManager.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Components/StaticMeshComponent.h"
@@ -7,12 +8,20 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Materials/MaterialInterface.h"
+#include "NavigationSystem.h"
 #include "NiagaraFunctionLibrary.h"
 #include "NiagaraSystem.h"
+#include "NazareneAbilitySystemComponent.h"
 #include "NazareneAssetResolver.h"
+#include "NazareneAttributeSet.h"
+#include "NazareneCombatAudioSubsystem.h"
+#include "NazareneCombatEventSubsystem.h"
 #include "NazareneEnemyAIController.h"
 #include "NazareneEnemyAnimInstance.h"
+#include "NazareneFlowFieldSubsystem.h"
+#include "NazareneMemoryTags.h"
 #include "NazarenePlayerCharacter.h"
+#include "NazareneWeaponTraceComponent.h"
 #include "Sound/SoundBase.h"
 #include "UObject/ConstructorHelpers.h"
 
@@ -59,6 +68,32 @@ namespace
         }
         return nullptr;
     }
+
+    void ApplyAnimUpdateRateTier(FAnimUpdateRateParameters* Params, int32 Tier)
+    {
+        if (Params == nullptr)
+        {
+            return;
+        }
+
+        // Screen-size thresholds: above the Nth entry the mesh evaluates every N+1 frames.
+        Params->BaseVisibleDistanceFactorThesholds.Reset();
+        switch (Tier)
+        {
+        case 0:
+            Params->BaseVisibleDistanceFactorThesholds.Append({ 0.40f, 0.20f });
+            Params->BaseNonRenderedUpdateRate = 4.0f;
+            break;
+        case 1:
+            Params->BaseVisibleDistanceFactorThesholds.Append({ 0.55f, 0.30f, 0.15f });
+            Params->BaseNonRenderedUpdateRate = 6.0f;
+            break;
+        default:
+            Params->BaseVisibleDistanceFactorThesholds.Append({ 0.80f, 0.45f, 0.25f, 0.12f });
+            Params->BaseNonRenderedUpdateRate = 8.0f;
+            break;
+        }
+    }
 }
 
 ANazareneEnemyCharacter::ANazareneEnemyCharacter()
@@ -109,6 +144,13 @@ ANazareneEnemyCharacter::ANazareneEnemyCharacter()
     CrownMesh->SetRelativeScale3D(FVector(0.3f, 0.3f, 0.1f));
     CrownMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
+    WeaponTrace = CreateDefaultSubobject<UNazareneWeaponTraceComponent>(TEXT("WeaponTrace"));
+
+    AbilitySystemComponent = CreateDefaultSubobject<UNazareneAbilitySystemComponent>(TEXT("AbilitySystemComponent"));
+    AbilitySystemComponent->SetIsReplicated(false);
+    AbilitySystemComponent->PrimaryComponentTick.bStartWithTickEnabled = false;
+    AttributeSet = CreateDefaultSubobject<UNazareneAttributeSet>(TEXT("AttributeSet"));
+
     static ConstructorHelpers::FObjectFinder<UStaticMesh> CapsuleMesh(TEXT("/Engine/BasicShapes/Cylinder.Cylinder"));
     static ConstructorHelpers::FObjectFinder<UStaticMesh> SphereMesh(TEXT("/Engine/BasicShapes/Sphere.Sphere"));
     static ConstructorHelpers::FObjectFinder<UStaticMesh> ConeMesh(TEXT("/Engine/BasicShapes/Cone.Cone"));
@@ -147,6 +189,9 @@ ANazareneEnemyCharacter::ANazareneEnemyCharacter()
     GetMesh()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
     GetMesh()->SetAnimationMode(EAnimationMode::AnimationBlueprint);
     GetMesh()->SetAnimInstanceClass(UNazareneEnemyAnimInstance::StaticClass());
+    GetMesh()->bEnableUpdateRateOptimizations = true;
+    GetMesh()->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+    GetMesh()->OnAnimUpdateRateParamsCreated.BindUObject(this, &ANazareneEnemyCharacter::HandleAnimUpdateRateParamsCreated);
 
     if (!ProductionSkeletalMesh.ToSoftObjectPath().IsValid())
     {
@@ -189,6 +234,7 @@ ANazareneEnemyCharacter::ANazareneEnemyCharacter()
 
 void ANazareneEnemyCharacter::BeginPlay()
 {
+    LLM_SCOPE_BYTAG(Nazarene_Enemies);
     Super::BeginPlay();
 
     TSoftObjectPtr<USkeletalMesh> ResolvedProductionMesh = ProductionSkeletalMesh;
@@ -258,11 +304,21 @@ void ANazareneEnemyCharacter::BeginPlay()
     }
 
     SetProxyVisualsHidden(bAppliedCharacterMesh);
+    GetMesh()->bEnableUpdateRateOptimizations = bUseAnimUpdateRateOptimization;
+    if (bAppliedCharacterMesh)
+    {
+        RegisterWithAnimationSharing();
+    }
 
     if (SpawnId.IsNone())
     {
         SpawnId = FName(*FString::Printf(TEXT("%s_%d"), *EnemyName.Replace(TEXT(" "), TEXT("_")).ToLower(), GetUniqueID()));
     }
+    if (DecisionStream.GetInitialSeed() == 0)
+    {
+        // Level-placed enemies; the campaign reseeds spawned ones from its simulation seed.
+        DecisionStream.Initialize(static_cast<int32>(GetTypeHash(GetName())));
+    }
 
     ConfigureFromArchetype();
 
@@ -274,6 +330,29 @@ void ANazareneEnemyCharacter::BeginPlay()
     CurrentState = ENazareneEnemyState::Idle;
 
     SyncTargetFromAIController();
+    SetFlowFieldAgentRegistered(true);
+
+    CombatSim = GetWorld()->GetSubsystem<UNazareneCombatSimSubsystem>();
+    if (CombatSim.IsValid())
+    {
+        CombatSim->RegisterParticipant(this);
+    }
+    FrameBudget = GetWorld()->GetSubsystem<UNazareneFrameBudgetSubsystem>();
+
+    if (AbilitySystemComponent != nullptr)
+    {
+        AbilitySystemComponent->InitializeForActor(this, this);
+    }
+    if (AttributeSet != nullptr)
+    {
+        AttributeSet->OnIncomingDamage.AddUObject(this, &ANazareneEnemyCharacter::HandleIncomingDamage);
+    }
+    SyncAttributeVitals();
+
+    if (WeaponTrace != nullptr)
+    {
+        WeaponTrace->OnWeaponHit.AddUObject(this, &ANazareneEnemyCharacter::HandleWeaponHit);
+    }
 
     if (ANazareneEnemyAIController* AIController = Cast<ANazareneEnemyAIController>(GetController()))
     {
@@ -282,6 +361,106 @@ void ANazareneEnemyCharacter::BeginPlay()
     }
 }
 
+void ANazareneEnemyCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UnregisterFromAnimationSharing();
+    SetFlowFieldAgentRegistered(false);
+    if (CombatSim.IsValid())
+    {
+        CombatSim->UnregisterParticipant(this);
+    }
+    Super::EndPlay(EndPlayReason);
+}
+
+void ANazareneEnemyCharacter::HandleAnimUpdateRateParamsCreated(FAnimUpdateRateParameters* Params)
+{
+    if (Params == nullptr)
+    {
+        return;
+    }
+
+    Params->bShouldUseLodMap = false;
+    Params->bInterpolateSkippedFrames = true;
+    Params->MaxEvalRateForInterpolation = 4;
+    AnimUpdateRateTier = 0;
+    ApplyAnimUpdateRateTier(Params, AnimUpdateRateTier);
+}
+
+void ANazareneEnemyCharacter::UpdateAnimUpdateRateTier(float DistanceToPlayer)
+{
+    USkeletalMeshComponent* MeshComponent = GetMesh();
+    if (!bUseAnimUpdateRateOptimization || MeshComponent == nullptr || MeshComponent->AnimUpdateRateParams == nullptr)
+    {
+        return;
+    }
+
+    // Telegraphed states stay at full rate so windup reads and parry timing are never skipped.
+    int32 DesiredTier = 0;
+    const bool bTelegraphing = CurrentState == ENazareneEnemyState::Windup
+        || CurrentState == ENazareneEnemyState::Casting
+        || CurrentState == ENazareneEnemyState::Parried;
+    if (!bTelegraphing && Archetype != ENazareneEnemyArchetype::Boss)
+    {
+        // Lower quality tiers pull the thresholds in and bias every enemy toward cheaper evaluation.
+        const FNazareneQualityTier* Tier = ActiveQualityTier();
+        const float Scale = Tier != nullptr ? Tier->EnemySignificanceScale : 1.0f;
+        if (DistanceToPlayer > AnimUROFarDistance * Scale)
+        {
+            DesiredTier = 2;
+        }
+        else if (DistanceToPlayer > AnimURONearDistance * Scale || CurrentState == ENazareneEnemyState::Idle)
+        {
+            DesiredTier = 1;
+        }
+        DesiredTier = FMath::Min(DesiredTier + (Tier != nullptr ? Tier->AnimUROTierBias : 0), 2);
+    }
+
+    if (DesiredTier == AnimUpdateRateTier)
+    {
+        return;
+    }
+
+    AnimUpdateRateTier = DesiredTier;
+    ApplyAnimUpdateRateTier(MeshComponent->AnimUpdateRateParams, AnimUpdateRateTier);
+}
+
+void ANazareneEnemyCharacter::RegisterWithAnimationSharing()
+{
+    if (bRegisteredForAnimationSharing || !bAllowAnimationSharing || Archetype == ENazareneEnemyArchetype::Boss)
+    {
+        return;
+    }
+
+    if (!UAnimationSharingManager::AnimationSharingEnabled())
+    {
+        return;
+    }
+
+    UAnimationSharingManager* SharingManager = UAnimationSharingManager::GetAnimationSharingManager(this);
+    const USkeletalMesh* MeshAsset = GetMesh() != nullptr ? GetMesh()->GetSkeletalMeshAsset() : nullptr;
+    if (SharingManager == nullptr || MeshAsset == nullptr || MeshAsset->GetSkeleton() == nullptr)
+    {
+        return;
+    }
+
+    SharingManager->RegisterActorWithSkeletonBP(this, MeshAsset->GetSkeleton());
+    bRegisteredForAnimationSharing = true;
+}
+
+void ANazareneEnemyCharacter::UnregisterFromAnimationSharing()
+{
+    if (!bRegisteredForAnimationSharing)
+    {
+        return;
+    }
+
+    bRegisteredForAnimationSharing = false;
+    if (UAnimationSharingManager* SharingManager = UAnimationSharingManager::GetAnimationSharingManager(this))
+    {
+        SharingManager->UnregisterActor(this);
+    }
+}
+
 void ANazareneEnemyCharacter::ConfigureProxyVisuals()
 {
     UMaterialInterface* ShapeMaterial = LoadObject<UMaterialInterface>(nullptr, TEXT("/Engine/BasicShapes/BasicShapeMaterial.BasicShapeMaterial"));
@@ -357,16 +536,13 @@ void ANazareneEnemyCharacter::Tick(float DeltaSeconds)
         return;
     }
 
-    UpdateBossPhase();
-    ApplyPhaseSpecificBehavior(DeltaSeconds);
-
-    ShotCooldown = FMath::Max(0.0f, ShotCooldown - DeltaSeconds);
-    DashCooldown = FMath::Max(0.0f, DashCooldown - DeltaSeconds);
-    CurrentPoise = FMath::Min(MaxPoise, CurrentPoise + PoiseRegen * DeltaSeconds);
-
     const FVector ToPlayer = TargetPlayer->GetActorLocation() - GetActorLocation();
     const float DistanceToPlayer = ToPlayer.Size2D();
+    UpdateAnimUpdateRateTier(DistanceToPlayer);
+    UpdateMovementFidelity(DistanceToPlayer, DeltaSeconds);
+    UpdateTickSignificance(DistanceToPlayer);
 
+    // Timers and state expiry advance in CombatStep; Tick only steers and picks moves.
     switch (CurrentState)
     {
     case ENazareneEnemyState::Idle:
@@ -390,19 +566,64 @@ void ANazareneEnemyCharacter::Tick(float DeltaSeconds)
         break;
 
     case ENazareneEnemyState::Windup:
-        ProcessWindup(DeltaSeconds, false);
+    case ENazareneEnemyState::Casting:
+        FaceTarget(DeltaSeconds);
+        SlowToStop(DeltaSeconds);
+        break;
+
+    case ENazareneEnemyState::Blocking:
+    case ENazareneEnemyState::Recover:
+    case ENazareneEnemyState::Staggered:
+    case ENazareneEnemyState::Parried:
+        SlowToStop(DeltaSeconds);
+        break;
+
+    case ENazareneEnemyState::Retreat:
+        MoveAwayFromTarget(DeltaSeconds);
+        if (DistanceToPlayer >= MinimumRange + 70.0f)
+        {
+            CurrentState = ENazareneEnemyState::Chase;
+        }
+        break;
+
+    case ENazareneEnemyState::Strafe:
+        StrafeAroundTarget(DeltaSeconds);
+        break;
+
+    default:
+        break;
+    }
+}
+
+void ANazareneEnemyCharacter::CombatStep(float StepSeconds)
+{
+    if (bCombatSuppressed || CurrentState == ENazareneEnemyState::Redeemed || !TargetPlayer.IsValid())
+    {
+        return;
+    }
+
+    UpdateBossPhase();
+    ApplyPhaseSpecificBehavior(StepSeconds);
+
+    ShotCooldown = FMath::Max(0.0f, ShotCooldown - StepSeconds);
+    DashCooldown = FMath::Max(0.0f, DashCooldown - StepSeconds);
+    CurrentPoise = FMath::Min(MaxPoise, CurrentPoise + PoiseRegen * StepSeconds);
+
+    switch (CurrentState)
+    {
+    case ENazareneEnemyState::Windup:
+        ProcessWindup(StepSeconds, false);
         break;
 
     case ENazareneEnemyState::Casting:
-        ProcessWindup(DeltaSeconds, true);
+        ProcessWindup(StepSeconds, true);
         break;
 
     case ENazareneEnemyState::Blocking:
     case ENazareneEnemyState::Recover:
     case ENazareneEnemyState::Staggered:
     case ENazareneEnemyState::Parried:
-        StateTimer = FMath::Max(0.0f, StateTimer - DeltaSeconds);
-        SlowToStop(DeltaSeconds);
+        StateTimer = FMath::Max(0.0f, StateTimer - StepSeconds);
         if (StateTimer <= 0.0f)
         {
             if (CurrentState == ENazareneEnemyState::Parried)
@@ -417,17 +638,8 @@ void ANazareneEnemyCharacter::Tick(float DeltaSeconds)
         }
         break;
 
-    case ENazareneEnemyState::Retreat:
-        MoveAwayFromTarget(DeltaSeconds);
-        if (DistanceToPlayer >= MinimumRange + 70.0f)
-        {
-            CurrentState = ENazareneEnemyState::Chase;
-        }
-        break;
-
     case ENazareneEnemyState::Strafe:
-        StrafeAroundTarget(DeltaSeconds);
-        StateTimer = FMath::Max(0.0f, StateTimer - DeltaSeconds);
+        StateTimer = FMath::Max(0.0f, StateTimer - StepSeconds);
         if (StateTimer <= 0.0f)
         {
             CurrentState = ENazareneEnemyState::Chase;
@@ -570,8 +782,16 @@ void ANazareneEnemyCharacter::ConfigureFromArchetype()
 
     CurrentHealth = MaxHealth;
     CurrentPoise = MaxPoise;
+    SyncAttributeVitals();
+    RefreshDerivedStats();
     GetCharacterMovement()->MaxWalkSpeed = MoveSpeed;
     ApplyProxyArchetypeVisualStyle();
+
+    // Archetype is assigned after spawn, so bosses registered in BeginPlay leave the shared crowd here.
+    if (Archetype == ENazareneEnemyArchetype::Boss)
+    {
+        UnregisterFromAnimationSharing();
+    }
 }
 
 void ANazareneEnemyCharacter::ApplyProxyArchetypeVisualStyle()
@@ -721,7 +941,7 @@ bool ANazareneEnemyCharacter::CanBeParried() const
     }
 
     const float Ratio = WindupElapsed / WindupDuration;
-    return Ratio >= EffectiveParryStartRatio() && Ratio <= EffectiveParryEndRatio();
+    return Ratio >= DerivedStats.ParryStartRatio && Ratio <= DerivedStats.ParryEndRatio;
 }
 
 bool ANazareneEnemyCharacter::IsParried() const
@@ -739,9 +959,14 @@ ENazareneEnemyState ANazareneEnemyCharacter::GetState() const
     return CurrentState;
 }
 
+bool ANazareneEnemyCharacter::IsUsingKinematicMovement() const
+{
+    return bKinematicMovement;
+}
+
 float ANazareneEnemyCharacter::GetStateTimerRemaining() const
 {
-    return StateTimer;
+    return CombatSim.IsValid() ? CombatSim->AdvanceTimerForPresentation(StateTimer) : StateTimer;
 }
 
 void ANazareneEnemyCharacter::OnParried(ANazarenePlayerCharacter* ByPlayer)
@@ -751,6 +976,7 @@ void ANazareneEnemyCharacter::OnParried(ANazarenePlayerCharacter* ByPlayer)
         return;
     }
 
+    CancelWeaponSwing();
     CurrentState = ENazareneEnemyState::Parried;
     StateTimer = ParryVulnerabilityDuration;
     if (Archetype == ENazareneEnemyArchetype::Boss)
@@ -779,10 +1005,19 @@ void ANazareneEnemyCharacter::ReceiveCombatHit(float Damage, float PoiseDamage,
 
     CurrentHealth -= Damage;
     CurrentPoise -= PoiseDamage;
-    TriggerPresentation(HitReactSound, HitReactVFX, GetActorLocation(), 0.8f);
+    SyncAttributeVitals();
+
+    FNazareneCombatEvent HitEvent = FNazareneCombatEvent::Make(ENazareneCombatEventType::Hit, this, Source);
+    HitEvent.Amount = Damage;
+    HitEvent.bDisplayNumber = Source != nullptr;
+    HitEvent.Sound = HitReactSound;
+    HitEvent.Effect = HitReactVFX;
+    HitEvent.VolumeMultiplier = 0.8f;
+    UNazareneCombatEventSubsystem::Publish(this, HitEvent);
 
     if (CurrentPoise <= 0.0f)
     {
+        CancelWeaponSwing();
         CurrentState = ENazareneEnemyState::Staggered;
         StateTimer = StaggerDuration;
         if (Archetype == ENazareneEnemyArchetype::Boss)
@@ -790,10 +1025,13 @@ void ANazareneEnemyCharacter::ReceiveCombatHit(float Damage, float PoiseDamage,
             StateTimer *= 0.68f;
         }
         CurrentPoise = MaxPoise;
-        if (Source != nullptr)
-        {
-            Source->DisplayDamageNumber(GetActorLocation() + FVector(0.0f, 0.0f, 150.0f), PoiseDamage, ENazareneDamageNumberType::PoiseBreak);
-        }
+
+        FNazareneCombatEvent PoiseEvent = FNazareneCombatEvent::Make(ENazareneCombatEventType::PoiseBreak, this, Source);
+        PoiseEvent.Amount = PoiseDamage;
+        PoiseEvent.bDisplayNumber = Source != nullptr;
+        PoiseEvent.NumberType = ENazareneDamageNumberType::PoiseBreak;
+        PoiseEvent.NumberHeight = 150.0f;
+        UNazareneCombatEventSubsystem::Publish(this, PoiseEvent);
     }
 
     if (CurrentHealth <= 0.0f)
@@ -810,6 +1048,17 @@ void ANazareneEnemyCharacter::ReceiveRiposte(float Damage, ANazarenePlayerCharac
     }
 
     CurrentHealth -= Damage;
+    SyncAttributeVitals();
+
+    FNazareneCombatEvent HitEvent = FNazareneCombatEvent::Make(ENazareneCombatEventType::Hit, this, Source);
+    HitEvent.Amount = Damage;
+    HitEvent.bDisplayNumber = Source != nullptr;
+    HitEvent.NumberType = ENazareneDamageNumberType::Critical;
+    HitEvent.Sound = HitReactSound;
+    HitEvent.Effect = HitReactVFX;
+    HitEvent.VolumeMultiplier = 0.8f;
+    UNazareneCombatEventSubsystem::Publish(this, HitEvent);
+
     if (CurrentHealth <= 0.0f)
     {
         BecomeRedeemed(Source, true);
@@ -829,15 +1078,48 @@ void ANazareneEnemyCharacter::ApplyKnockback(const FVector& Direction, float For
     LaunchCharacter(Direction.GetSafeNormal2D() * Force, true, false);
 }
 
+void ANazareneEnemyCharacter::LaunchCharacter(FVector LaunchVelocity, bool bXYOverride, bool bZOverride)
+{
+    // Knockbacks and dashes need real floor and wall resolution.
+    ExitKinematicMovement();
+    Super::LaunchCharacter(LaunchVelocity, bXYOverride, bZOverride);
+}
+
+void ANazareneEnemyCharacter::SetDecisionStream(const FRandomStream& Stream)
+{
+    DecisionStream = Stream;
+}
+
 void ANazareneEnemyCharacter::ResetToSpawn()
 {
+    ResetTransientState();
     SetActorLocation(SpawnLocation);
     SetActorRotation(SpawnRotation);
     CurrentHealth = MaxHealth;
     CurrentPoise = MaxPoise;
+    BossPhase = 1;
+    SyncAttributeVitals();
+    RefreshDerivedStats();
+}
+
+void ANazareneEnemyCharacter::ResetTransientState()
+{
+    ExitKinematicMovement();
+    CancelWeaponSwing();
+    DecisionStream.Reset();
+    SetActorHiddenInGame(false);
+    SetActorEnableCollision(true);
+    GetCharacterMovement()->SetMovementMode(MOVE_Walking);
+    GetCharacterMovement()->StopMovementImmediately();
+    SetFlowFieldAgentRegistered(true);
+    if (AbilitySystemComponent != nullptr)
+    {
+        AbilitySystemComponent->RemoveActiveEffects(FGameplayEffectQuery());
+    }
+    ResetAwareness();
+
     CurrentState = ENazareneEnemyState::Idle;
     StateTimer = 0.0f;
-    BossPhase = 1;
     WindupElapsed = 0.0f;
     WindupDuration = 0.0f;
     bAttackResolved = false;
@@ -846,9 +1128,16 @@ void ANazareneEnemyCharacter::ResetToSpawn()
     bPhase2WaveSpawned = false;
     bPhase3WaveSpawned = false;
     DoubleStrikeCooldown = 0.0f;
-    SetActorHiddenInGame(false);
-    SetActorEnableCollision(true);
-    GetCharacterMovement()->SetMovementMode(MOVE_Walking);
+}
+
+void ANazareneEnemyCharacter::ResetAwareness()
+{
+    TargetPlayer.Reset();
+    if (ANazareneEnemyAIController* AIController = Cast<ANazareneEnemyAIController>(GetController()))
+    {
+        AIController->ResetTarget();
+    }
+    SetActorTickInterval(0.0f);
 }
 
 FNazareneEnemySnapshot ANazareneEnemyCharacter::BuildSnapshot() const
@@ -873,25 +1162,60 @@ void ANazareneEnemyCharacter::ApplySnapshot(const FNazareneEnemySnapshot& Snapsh
         return;
     }
 
-    SetActorHiddenInGame(false);
-    SetActorEnableCollision(true);
-    GetCharacterMovement()->SetMovementMode(MOVE_Walking);
-
+    ResetTransientState();
     SetActorLocation(Snapshot.Position);
+    SetActorRotation(SpawnRotation);
     CurrentHealth = FMath::Clamp(Snapshot.Health, 0.0f, MaxHealth);
     CurrentPoise = FMath::Clamp(Snapshot.Poise, 0.0f, MaxPoise);
     BossPhase = FMath::Clamp(Snapshot.BossPhase, 1, 3);
+    SyncAttributeVitals();
+    RefreshDerivedStats();
+}
 
-    CurrentState = ENazareneEnemyState::Idle;
-    StateTimer = 0.0f;
-    WindupElapsed = 0.0f;
-    WindupDuration = 0.0f;
-    bAttackResolved = false;
-    ShotCooldown = 0.0f;
-    DashCooldown = 0.0f;
-    bPhase2WaveSpawned = false;
-    bPhase3WaveSpawned = false;
-    DoubleStrikeCooldown = 0.0f;
+UAbilitySystemComponent* ANazareneEnemyCharacter::GetAbilitySystemComponent() const
+{
+    return AbilitySystemComponent;
+}
+
+void ANazareneEnemyCharacter::SyncAttributeVitals()
+{
+    // CurrentHealth stays authoritative; the attribute set is a mirror for effects and queries.
+    if (AttributeSet != nullptr)
+    {
+        AttributeSet->SetMaxHealth(MaxHealth);
+        AttributeSet->SetHealth(FMath::Max(0.0f, CurrentHealth));
+    }
+}
+
+void ANazareneEnemyCharacter::HandleIncomingDamage(float Damage, float PoiseDamage, AActor* DamageInstigator)
+{
+    ReceiveCombatHit(Damage, PoiseDamage, Cast<ANazarenePlayerCharacter>(DamageInstigator));
+}
+
+bool ANazareneEnemyCharacter::MatchesSnapshot(const FNazareneEnemySnapshot& Snapshot) const
+{
+    if (Snapshot.bRedeemed)
+    {
+        return CurrentState == ENazareneEnemyState::Redeemed;
+    }
+
+    // Positions compare in 2D: spawn points are authored above the floor and the capsule settles after load.
+    // Aggro target and tick interval are not compared: an idle enemy re-derives both every step, and restores reset them.
+    return CurrentState == ENazareneEnemyState::Idle
+        && !bKinematicMovement
+        && DecisionStream.GetCurrentSeed() == DecisionStream.GetInitialSeed()
+        && StateTimer <= 0.0f
+        && WindupElapsed <= 0.0f
+        && ShotCooldown <= 0.0f
+        && DashCooldown <= 0.0f
+        && DoubleStrikeCooldown <= 0.0f
+        && GetVelocity().IsNearlyZero(1.0f)
+        && (AbilitySystemComponent == nullptr || AbilitySystemComponent->GetNumActiveGameplayEffects() == 0)
+        && FMath::IsNearlyEqual(CurrentHealth, FMath::Clamp(Snapshot.Health, 0.0f, MaxHealth))
+        && FMath::IsNearlyEqual(CurrentPoise, FMath::Clamp(Snapshot.Poise, 0.0f, MaxPoise))
+        && BossPhase == FMath::Clamp(Snapshot.BossPhase, 1, 3)
+        && FVector::DistSquared2D(GetActorLocation(), Snapshot.Position) <= FMath::Square(25.0f)
+        && GetActorRotation().Equals(SpawnRotation, 1.0f);
 }
 
 void ANazareneEnemyCharacter::UpdateBossPhase()
@@ -915,6 +1239,12 @@ void ANazareneEnemyCharacter::UpdateBossPhase()
     if (NextPhase != BossPhase)
     {
         BossPhase = NextPhase;
+        RefreshDerivedStats();
+
+        FNazareneCombatEvent PhaseEvent = FNazareneCombatEvent::Make(ENazareneCombatEventType::PhaseChange, this, nullptr);
+        PhaseEvent.Param = BossPhase;
+        UNazareneCombatEventSubsystem::Publish(this, PhaseEvent);
+
         OnPhaseChanged.Broadcast(this, BossPhase);
         CheckReinforcementTrigger();
     }
@@ -974,36 +1304,36 @@ void ANazareneEnemyCharacter::ProcessChaseBehavior(float DistanceToPlayer, float
         }
         else if (DistanceToPlayer > AttackRange * 0.92f)
         {
-            MoveTowardTarget(DeltaSeconds, EffectiveMoveSpeed());
+            MoveTowardTarget(DeltaSeconds, DerivedStats.MoveSpeed);
         }
         else
         {
             CurrentState = ENazareneEnemyState::Strafe;
-            StateTimer = FMath::FRandRange(0.65f, 1.2f);
-            StrafeDirectionSign = (FMath::FRand() > 0.5f) ? 1 : -1;
+            StateTimer = DecisionStream.FRandRange(0.65f, 1.2f);
+            StrafeDirectionSign = (DecisionStream.FRand() > 0.5f) ? 1 : -1;
         }
         break;
 
     case ENazareneEnemyArchetype::Demon:
         if (DistanceToPlayer <= AttackRange * 1.25f)
         {
-            if (DashCooldown <= 0.0f && FMath::FRand() < 0.32f)
+            if (DashCooldown <= 0.0f && DecisionStream.FRand() < 0.32f)
             {
                 FVector Dir = TargetPlayer->GetActorLocation() - GetActorLocation();
                 Dir.Z = 0.0f;
-                LaunchCharacter(Dir.GetSafeNormal() * EffectiveMoveSpeed() * 1.9f, true, false);
+                LaunchCharacter(Dir.GetSafeNormal() * DerivedStats.MoveSpeed * 1.9f, true, false);
                 DashCooldown = 2.0f;
             }
             BeginMeleeAttack();
         }
         else
         {
-            MoveTowardTarget(DeltaSeconds, EffectiveMoveSpeed() * 1.08f);
+            MoveTowardTarget(DeltaSeconds, DerivedStats.MoveSpeed * 1.08f);
         }
         break;
 
     case ENazareneEnemyArchetype::Boss:
-        if (BossPhase >= 2 && DistanceToPlayer > AttackRange + 250.0f && ShotCooldown <= 0.0f && FMath::FRand() < Phase2CastFrequency)
+        if (BossPhase >= 2 && DistanceToPlayer > AttackRange + 250.0f && ShotCooldown <= 0.0f && DecisionStream.FRand() < Phase2CastFrequency)
         {
             BeginCastAttack();
         }
@@ -1013,17 +1343,17 @@ void ANazareneEnemyCharacter::ProcessChaseBehavior(float DistanceToPlayer, float
         }
         else
         {
-            MoveTowardTarget(DeltaSeconds, EffectiveMoveSpeed());
+            MoveTowardTarget(DeltaSeconds, DerivedStats.MoveSpeed);
         }
         if (BossPhase >= 3 && DashCooldown <= 0.0f && TargetPlayer.IsValid())
         {
             const float DistToPlayer = FVector::Dist(GetActorLocation(), TargetPlayer->GetActorLocation());
-            if (DistToPlayer > AttackRange * 1.5f && DistToPlayer < DetectionRange && FMath::FRand() < Phase3DashFrequency * DeltaSeconds)
+            if (DistToPlayer > AttackRange * 1.5f && DistToPlayer < DetectionRange && DecisionStream.FRand() < Phase3DashFrequency * DeltaSeconds)
             {
                 FVector DashDir = TargetPlayer->GetActorLocation() - GetActorLocation();
                 DashDir.Z = 0.0f;
                 DashDir = DashDir.GetSafeNormal();
-                LaunchCharacter(DashDir * EffectiveMoveSpeed() * 2.2f, true, false);
+                LaunchCharacter(DashDir * DerivedStats.MoveSpeed * 2.2f, true, false);
                 DashCooldown = 2.8f;
                 TriggerArenaHazard();
             }
@@ -1037,7 +1367,7 @@ void ANazareneEnemyCharacter::ProcessChaseBehavior(float DistanceToPlayer, float
         }
         else
         {
-            MoveTowardTarget(DeltaSeconds, EffectiveMoveSpeed());
+            MoveTowardTarget(DeltaSeconds, DerivedStats.MoveSpeed);
         }
         break;
     }
@@ -1051,7 +1381,7 @@ void ANazareneEnemyCharacter::BeginMeleeAttack()
     }
 
     CurrentState = ENazareneEnemyState::Windup;
-    WindupDuration = EffectiveWindup();
+    WindupDuration = DerivedStats.Windup;
     WindupElapsed = 0.0f;
     bAttackResolved = false;
     StateTimer = WindupDuration;
@@ -1066,19 +1396,17 @@ void ANazareneEnemyCharacter::BeginCastAttack()
     }
 
     CurrentState = ENazareneEnemyState::Casting;
-    WindupDuration = FMath::Max(0.22f, EffectiveWindup() + 0.08f);
+    WindupDuration = FMath::Max(0.22f, DerivedStats.Windup + 0.08f);
     WindupElapsed = 0.0f;
     bAttackResolved = false;
     StateTimer = WindupDuration;
     TriggerPresentation(AttackSound, AttackVFX, GetActorLocation() + GetActorForwardVector() * 130.0f, 0.72f);
 }
 
-void ANazareneEnemyCharacter::ProcessWindup(float DeltaSeconds, bool bCasting)
+void ANazareneEnemyCharacter::ProcessWindup(float StepSeconds, bool bCasting)
 {
-    FaceTarget(DeltaSeconds);
-    StateTimer = FMath::Max(0.0f, StateTimer - DeltaSeconds);
-    WindupElapsed += DeltaSeconds;
-    SlowToStop(DeltaSeconds);
+    StateTimer = FMath::Max(0.0f, StateTimer - StepSeconds);
+    WindupElapsed += StepSeconds;
 
     if (!bAttackResolved && WindupElapsed >= WindupDuration * StrikeTimingRatio)
     {
@@ -1096,7 +1424,7 @@ void ANazareneEnemyCharacter::ProcessWindup(float DeltaSeconds, bool bCasting)
     if (StateTimer <= 0.0f)
     {
         CurrentState = ENazareneEnemyState::Recover;
-        StateTimer = EffectiveRecovery();
+        StateTimer = DerivedStats.Recovery;
     }
 }
 
@@ -1117,10 +1445,40 @@ void ANazareneEnemyCharacter::ResolveMeleeAttack()
         BonusRange = 120.0f;
     }
 
-    const float Dist = FVector::Dist2D(GetActorLocation(), TargetPlayer->GetActorLocation());
-    if (Dist <= AttackRange + BonusRange)
+    if (WeaponTrace == nullptr)
     {
-        TargetPlayer->ReceiveEnemyAttack(this, EffectiveAttackDamage(), EffectivePostureDamage());
+        return;
+    }
+
+    // The blade stays live for the rest of the windup; hits land through HandleWeaponHit.
+    FNazareneWeaponSwingProfile Profile;
+    Profile.Reach = AttackRange + BonusRange;
+    Profile.ArcDegrees = MeleeArcDegrees;
+    Profile.Duration = FMath::Max(0.08f, StateTimer);
+    Profile.Radius = MeleeTraceRadius;
+    Profile.MaxTargets = 1;
+    Profile.TargetClass = ANazarenePlayerCharacter::StaticClass();
+    WeaponTrace->BeginSwing(Profile);
+}
+
+void ANazareneEnemyCharacter::HandleWeaponHit(AActor* HitActor, const FHitResult& Hit)
+{
+    if (CurrentState == ENazareneEnemyState::Redeemed)
+    {
+        return;
+    }
+
+    if (ANazarenePlayerCharacter* Player = Cast<ANazarenePlayerCharacter>(HitActor))
+    {
+        Player->ReceiveEnemyAttack(this, DerivedStats.AttackDamage, DerivedStats.PostureDamage);
+    }
+}
+
+void ANazareneEnemyCharacter::CancelWeaponSwing()
+{
+    if (WeaponTrace != nullptr)
+    {
+        WeaponTrace->EndSwing();
     }
 }
 
@@ -1134,10 +1492,10 @@ void ANazareneEnemyCharacter::ResolveCastAttack()
     const float Dist = FVector::Dist2D(GetActorLocation(), TargetPlayer->GetActorLocation());
     if (Dist <= AttackRange * 1.65f)
     {
-        TargetPlayer->ReceiveEnemyAttack(this, EffectiveAttackDamage() * 0.88f, EffectivePostureDamage() * 0.74f);
+        TargetPlayer->ReceiveEnemyAttack(this, DerivedStats.AttackDamage * 0.88f, DerivedStats.PostureDamage * 0.74f);
     }
 
-    ShotCooldown = 1.65f / PhaseSpeedScale();
+    ShotCooldown = 1.65f / DerivedStats.PhaseSpeedScale;
 }
 
 void ANazareneEnemyCharacter::FaceTarget(float DeltaSeconds)
@@ -1173,8 +1531,7 @@ void ANazareneEnemyCharacter::MoveTowardTarget(float DeltaSeconds, float Speed)
         return;
     }
 
-    GetCharacterMovement()->MaxWalkSpeed = Speed;
-    AddMovementInput(Dir.GetSafeNormal(), 1.0f);
+    ApplyMovementInput(ApplySeparation(SampleFlowForward(Dir.GetSafeNormal())), Speed, DeltaSeconds);
 }
 
 void ANazareneEnemyCharacter::MoveAwayFromTarget(float DeltaSeconds)
@@ -1191,8 +1548,8 @@ void ANazareneEnemyCharacter::MoveAwayFromTarget(float DeltaSeconds)
         return;
     }
 
-    GetCharacterMovement()->MaxWalkSpeed = EffectiveMoveSpeed();
-    AddMovementInput(Dir.GetSafeNormal(), 1.0f);
+    // Retreat runs up the integration field, i.e. back along the route the player would take to reach us.
+    ApplyMovementInput(ApplySeparation(-SampleFlowForward(-Dir.GetSafeNormal())), DerivedStats.MoveSpeed, DeltaSeconds);
     FaceTarget(DeltaSeconds);
 }
 
@@ -1209,12 +1566,11 @@ void ANazareneEnemyCharacter::StrafeAroundTarget(float DeltaSeconds)
     {
         return;
     }
-    Forward = Forward.GetSafeNormal();
+    Forward = SampleFlowForward(Forward.GetSafeNormal());
     FVector Right(-Forward.Y, Forward.X, 0.0f);
     FVector Strafe = (Right * float(StrafeDirectionSign) + Forward * 0.18f).GetSafeNormal();
 
-    GetCharacterMovement()->MaxWalkSpeed = EffectiveMoveSpeed() * 0.9f;
-    AddMovementInput(Strafe, 1.0f);
+    ApplyMovementInput(ApplySeparation(Strafe), DerivedStats.MoveSpeed * 0.9f, DeltaSeconds);
     FaceTarget(DeltaSeconds);
 }
 
@@ -1226,152 +1582,324 @@ void ANazareneEnemyCharacter::SlowToStop(float DeltaSeconds)
     GetCharacterMovement()->Velocity = Velocity;
 }
 
-bool ANazareneEnemyCharacter::TryShieldBlock(ANazarenePlayerCharacter* Source, float PoiseDamage)
+void ANazareneEnemyCharacter::ApplyMovementInput(const FVector& Direction, float Speed, float DeltaSeconds)
 {
-    if (Archetype != ENazareneEnemyArchetype::MeleeShield || Source == nullptr)
+    UCharacterMovementComponent* Movement = GetCharacterMovement();
+    if (!bKinematicMovement)
     {
-        return false;
+        Movement->MaxWalkSpeed = Speed;
+        AddMovementInput(Direction, 1.0f);
+        return;
     }
 
-    if (CurrentState != ENazareneEnemyState::Chase && CurrentState != ENazareneEnemyState::Idle && CurrentState != ENazareneEnemyState::Recover)
+    // Kinematic glide: no sweep, no floor find; walls are checked at each ground refresh. Velocity is still published for the anim graph.
+    const FVector Velocity = Direction.GetSafeNormal2D() * Speed;
+    Movement->Velocity = Velocity;
+
+    const float HalfHeight = GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+    FVector NewLocation = GetActorLocation() + Velocity * DeltaSeconds;
+    NewLocation.Z = FMath::FInterpTo(GetActorLocation().Z, KinematicGroundZ + HalfHeight, DeltaSeconds, 8.0f);
+    SetActorLocation(NewLocation, false, nullptr, ETeleportType::None);
+}
+
+FVector ANazareneEnemyCharacter::SampleFlowForward(const FVector& DirectDirection) const
+{
+    const UNazareneFlowFieldSubsystem* FlowField = GetWorld() != nullptr ? GetWorld()->GetSubsystem<UNazareneFlowFieldSubsystem>() : nullptr;
+    if (FlowField == nullptr || !TargetPlayer.IsValid())
     {
-        return false;
+        return DirectDirection;
     }
 
-    if (FMath::FRand() > ShieldBlockChance)
+    if (FVector::DistSquared2D(GetActorLocation(), TargetPlayer->GetActorLocation()) <= FMath::Square(FlowFieldDirectRange))
     {
-        return false;
+        return DirectDirection;
     }
 
-    FVector AttackDir = Source->GetActorLocation() - GetActorLocation();
-    AttackDir.Z = 0.0f;
-    if (AttackDir.IsNearlyZero())
+    const FVector Flow = FlowField->SampleFlowDirection(GetActorLocation());
+    return Flow.IsNearlyZero() ? DirectDirection : Flow;
+}
+
+FVector ANazareneEnemyCharacter::ApplySeparation(const FVector& Desired) const
+{
+    const UNazareneFlowFieldSubsystem* FlowField = GetWorld() != nullptr ? GetWorld()->GetSubsystem<UNazareneFlowFieldSubsystem>() : nullptr;
+    if (FlowField == nullptr || SeparationWeight <= 0.0f)
     {
-        return false;
+        return Desired;
     }
 
-    const FVector Facing = GetActorForwardVector().GetSafeNormal2D();
-    const bool bFrontal = FVector::DotProduct(Facing, AttackDir.GetSafeNormal2D()) > 0.3f;
-    if (!bFrontal)
+    const FVector Steered = Desired + FlowField->ComputeSeparation(this, GetActorLocation(), SeparationRadius) * SeparationWeight;
+    return Steered.IsNearlyZero() ? Desired : Steered.GetSafeNormal2D();
+}
+
+void ANazareneEnemyCharacter::SetFlowFieldAgentRegistered(bool bRegistered)
+{
+    UNazareneFlowFieldSubsystem* FlowField = GetWorld() != nullptr ? GetWorld()->GetSubsystem<UNazareneFlowFieldSubsystem>() : nullptr;
+    if (FlowField == nullptr)
     {
-        return false;
+        return;
     }
 
-    CurrentPoise = FMath::Max(0.0f, CurrentPoise - PoiseDamage * 0.35f);
-    CurrentState = ENazareneEnemyState::Blocking;
-    StateTimer = 0.26f;
-    Source->DisplayDamageNumber(GetActorLocation() + FVector(0.0f, 0.0f, 130.0f), 0.0f, ENazareneDamageNumberType::Blocked);
-    return true;
+    if (bRegistered)
+    {
+        FlowField->RegisterAgent(this);
+    }
+    else
+    {
+        FlowField->UnregisterAgent(this);
+    }
 }
 
-void ANazareneEnemyCharacter::BecomeRedeemed(ANazarenePlayerCharacter* Source, bool bGrantReward)
+const FNazareneQualityTier* ANazareneEnemyCharacter::ActiveQualityTier() const
 {
-    CurrentState = ENazareneEnemyState::Redeemed;
-    CurrentHealth = 0.0f;
-    GetCharacterMovement()->StopMovementImmediately();
-    GetCharacterMovement()->DisableMovement();
-    SetActorEnableCollision(false);
-    SetActorHiddenInGame(true);
-    TriggerPresentation(RedeemedSound, RedeemedVFX, GetActorLocation(), 0.95f);
+    return FrameBudget.IsValid() ? &FrameBudget->GetActiveTier() : nullptr;
+}
 
-    if (bGrantReward)
+void ANazareneEnemyCharacter::UpdateMovementFidelity(float DistanceToPlayer, float DeltaSeconds)
+{
+    const bool bCalmState = CurrentState == ENazareneEnemyState::Idle || CurrentState == ENazareneEnemyState::Chase;
+    const FNazareneQualityTier* Tier = ActiveQualityTier();
+    const float KinematicDistance = KinematicMovementDistance * (Tier != nullptr ? Tier->EnemySignificanceScale : 1.0f);
+
+    if (!bKinematicMovement)
     {
-        if (Source != nullptr)
+        if (bUseKinematicMovementWhenDistant
+            && bCalmState
+            && Archetype != ENazareneEnemyArchetype::Boss
+            && DistanceToPlayer > KinematicDistance
+            && GetCharacterMovement()->IsMovingOnGround())
         {
-            Source->AddFaith(FaithReward);
+            EnterKinematicMovement();
         }
-        OnRedeemed.Broadcast(this, FaithReward);
+        return;
     }
-}
 
-float ANazareneEnemyCharacter::EffectiveMoveSpeed() const
-{
-    float Value = MoveSpeed;
-    if (Archetype == ENazareneEnemyArchetype::Boss)
+    // Hysteresis band so enemies hovering at the threshold do not flip modes every frame.
+    if (!bCalmState || DistanceToPlayer < KinematicDistance - 250.0f)
     {
-        Value *= PhaseSpeedScale();
+        ExitKinematicMovement();
+        return;
     }
-    return Value;
+
+    KinematicGroundRefreshTimer -= DeltaSeconds;
+    if (KinematicGroundRefreshTimer > 0.0f)
+    {
+        return;
+    }
+
+    // Walked off the navmesh (ledge, bridge edge) or glided into geometry; let CharacterMovement resolve it.
+    if (!RefreshKinematicGroundHeight() || IsKinematicBodyBlocked())
+    {
+        ExitKinematicMovement();
+        return;
+    }
+    KinematicClearLocation = GetActorLocation();
 }
 
-float ANazareneEnemyCharacter::EffectiveAttackDamage() const
+void ANazareneEnemyCharacter::UpdateTickSignificance(float DistanceToPlayer)
 {
-    float Value = AttackDamage;
-    if (Archetype == ENazareneEnemyArchetype::Boss)
+    // Only calm, gliding enemies out past the kinematic distance may tick slower; CombatStep still runs at the fixed rate.
+    // CharacterMovement chase feeds AddMovementInput from Tick, so an enemy still on it must tick every frame.
+    const FNazareneQualityTier* Tier = ActiveQualityTier();
+    const bool bCalmState = CurrentState == ENazareneEnemyState::Idle || CurrentState == ENazareneEnemyState::Chase;
+    float DesiredInterval = 0.0f;
+    if (Tier != nullptr && bKinematicMovement && bCalmState && Archetype != ENazareneEnemyArchetype::Boss
+        && DistanceToPlayer > KinematicMovementDistance * Tier->EnemySignificanceScale)
     {
-        Value *= (1.0f + float(BossPhase - 1) * 0.2f);
+        DesiredInterval = Tier->DistantEnemyTickInterval;
     }
-    if (Archetype == ENazareneEnemyArchetype::Demon)
+
+    if (!FMath::IsNearlyEqual(GetActorTickInterval(), DesiredInterval))
     {
-        Value *= 1.08f;
+        SetActorTickInterval(DesiredInterval);
     }
-    return Value;
 }
 
-float ANazareneEnemyCharacter::EffectivePostureDamage() const
+void ANazareneEnemyCharacter::EnterKinematicMovement()
 {
-    float Value = PostureDamage;
-    if (Archetype == ENazareneEnemyArchetype::Boss)
+    if (bKinematicMovement || !RefreshKinematicGroundHeight())
     {
-        Value *= (1.0f + float(BossPhase - 1) * 0.16f);
+        return;
     }
-    return Value;
+
+    bKinematicMovement = true;
+    KinematicClearLocation = GetActorLocation();
+    ConsumeMovementInputVector();
+    GetCharacterMovement()->SetComponentTickEnabled(false);
 }
 
-float ANazareneEnemyCharacter::EffectiveWindup() const
+void ANazareneEnemyCharacter::ExitKinematicMovement()
 {
-    float Value = AttackWindup;
-    if (Archetype == ENazareneEnemyArchetype::Boss)
+    if (!bKinematicMovement)
     {
-        Value *= (1.0f - float(BossPhase - 1) * 0.08f);
+        return;
     }
-    return FMath::Max(Value, 0.16f);
+
+    bKinematicMovement = false;
+    SetActorTickInterval(0.0f);
+    UCharacterMovementComponent* Movement = GetCharacterMovement();
+    Movement->SetComponentTickEnabled(true);
+    Movement->bForceNextFloorCheck = true;
+    if (Movement->MovementMode == MOVE_None)
+    {
+        return;
+    }
+
+    // The glide does not sweep; a capsule left inside geometry goes back to where it was last checked clear.
+    if (IsKinematicBodyBlocked())
+    {
+        SetActorLocation(KinematicClearLocation, false, nullptr, ETeleportType::TeleportPhysics);
+    }
+    Movement->SetMovementMode(MOVE_Walking);
 }
 
-float ANazareneEnemyCharacter::EffectiveRecovery() const
+bool ANazareneEnemyCharacter::IsKinematicBodyBlocked() const
 {
-    float Value = AttackRecovery;
-    if (Archetype == ENazareneEnemyArchetype::Boss)
+    UWorld* World = GetWorld();
+    const UCapsuleComponent* Capsule = GetCapsuleComponent();
+    if (World == nullptr || Capsule == nullptr)
     {
-        Value *= (1.0f - float(BossPhase - 1) * 0.06f);
+        return false;
     }
-    return FMath::Max(Value, 0.24f);
+
+    // Only the body above step height is tested: the glide holds the capsule base on nav height, which may dip into the floor.
+    const float Radius = Capsule->GetScaledCapsuleRadius();
+    const float HalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+    const float BodyHalfHeight = FMath::Max(Radius, HalfHeight - GetCharacterMovement()->MaxStepHeight * 0.5f);
+    const FVector Center = GetActorLocation() + FVector(0.0f, 0.0f, HalfHeight - BodyHalfHeight);
+
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(NazareneKinematicOverlap), false, this);
+    return World->OverlapAnyTestByObjectType(Center, Capsule->GetComponentQuat(), FCollisionObjectQueryParams(ECC_WorldStatic),
+        FCollisionShape::MakeCapsule(Radius, BodyHalfHeight), Params);
 }
 
-float ANazareneEnemyCharacter::EffectiveParryStartRatio() const
+bool ANazareneEnemyCharacter::RefreshKinematicGroundHeight()
 {
-    float Value = ParryWindowStartRatio;
-    if (Archetype == ENazareneEnemyArchetype::Boss)
+    UWorld* World = GetWorld();
+    if (World == nullptr)
+    {
+        return false;
+    }
+
+    const FVector Location = GetActorLocation();
+    const float HalfHeight = GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+
+    if (UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World))
     {
-        Value += float(BossPhase - 1) * 0.05f;
+        FNavLocation Projected;
+        if (NavSystem->ProjectPointToNavigation(Location - FVector(0.0f, 0.0f, HalfHeight), Projected, FVector(60.0f, 60.0f, 200.0f)))
+        {
+            KinematicGroundZ = Projected.Location.Z;
+            KinematicGroundRefreshTimer = KinematicGroundRefreshInterval;
+            return true;
+        }
     }
-    return FMath::Clamp(Value, 0.1f, 0.84f);
+
+    // Regions without nav data fall back to one downward trace per refresh instead of per-frame sweeps.
+    FHitResult Hit;
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(NazareneKinematicGround), false, this);
+    const FVector TraceEnd = Location - FVector(0.0f, 0.0f, HalfHeight + 250.0f);
+    if (!World->LineTraceSingleByChannel(Hit, Location, TraceEnd, ECC_Visibility, Params))
+    {
+        return false;
+    }
+
+    KinematicGroundZ = Hit.ImpactPoint.Z;
+    KinematicGroundRefreshTimer = KinematicGroundRefreshInterval;
+    return true;
 }
 
-float ANazareneEnemyCharacter::EffectiveParryEndRatio() const
+bool ANazareneEnemyCharacter::TryShieldBlock(ANazarenePlayerCharacter* Source, float PoiseDamage)
 {
-    float Value = ParryWindowEndRatio;
-    if (Archetype == ENazareneEnemyArchetype::Boss)
+    if (Archetype != ENazareneEnemyArchetype::MeleeShield || Source == nullptr)
+    {
+        return false;
+    }
+
+    if (CurrentState != ENazareneEnemyState::Chase && CurrentState != ENazareneEnemyState::Idle && CurrentState != ENazareneEnemyState::Recover)
+    {
+        return false;
+    }
+
+    if (DecisionStream.FRand() > ShieldBlockChance)
     {
-        Value -= float(BossPhase - 1) * 0.05f;
+        return false;
     }
-    return FMath::Clamp(Value, EffectiveParryStartRatio() + 0.06f, 0.95f);
+
+    FVector AttackDir = Source->GetActorLocation() - GetActorLocation();
+    AttackDir.Z = 0.0f;
+    if (AttackDir.IsNearlyZero())
+    {
+        return false;
+    }
+
+    const FVector Facing = GetActorForwardVector().GetSafeNormal2D();
+    const bool bFrontal = FVector::DotProduct(Facing, AttackDir.GetSafeNormal2D()) > 0.3f;
+    if (!bFrontal)
+    {
+        return false;
+    }
+
+    CurrentPoise = FMath::Max(0.0f, CurrentPoise - PoiseDamage * 0.35f);
+    CurrentState = ENazareneEnemyState::Blocking;
+    StateTimer = 0.26f;
+
+    FNazareneCombatEvent BlockEvent = FNazareneCombatEvent::Make(ENazareneCombatEventType::Block, this, Source);
+    BlockEvent.bDisplayNumber = true;
+    BlockEvent.NumberType = ENazareneDamageNumberType::Blocked;
+    UNazareneCombatEventSubsystem::Publish(this, BlockEvent);
+    return true;
 }
 
-float ANazareneEnemyCharacter::PhaseSpeedScale() const
+void ANazareneEnemyCharacter::BecomeRedeemed(ANazarenePlayerCharacter* Source, bool bGrantReward)
 {
-    if (Archetype != ENazareneEnemyArchetype::Boss)
+    CurrentState = ENazareneEnemyState::Redeemed;
+    CurrentHealth = 0.0f;
+    SyncAttributeVitals();
+    ExitKinematicMovement();
+    CancelWeaponSwing();
+    SetFlowFieldAgentRegistered(false);
+    GetCharacterMovement()->StopMovementImmediately();
+    GetCharacterMovement()->DisableMovement();
+    SetActorEnableCollision(false);
+    SetActorHiddenInGame(true);
+
+    FNazareneCombatEvent RedeemEvent = FNazareneCombatEvent::Make(ENazareneCombatEventType::Redeem, this, Source);
+    RedeemEvent.Amount = bGrantReward ? FaithReward : 0.0f;
+    RedeemEvent.Sound = RedeemedSound;
+    RedeemEvent.Effect = RedeemedVFX;
+    RedeemEvent.VolumeMultiplier = 0.95f;
+    UNazareneCombatEventSubsystem::Publish(this, RedeemEvent);
+
+    if (bGrantReward)
     {
-        return 1.0f;
+        if (Source != nullptr)
+        {
+            Source->AddFaith(FaithReward);
+        }
+        OnRedeemed.Broadcast(this, FaithReward);
     }
-    return 1.0f + float(BossPhase - 1) * 0.12f;
 }
 
-void ANazareneEnemyCharacter::TriggerPresentation(USoundBase* Sound, UNiagaraSystem* Effect, const FVector& Location, float VolumeMultiplier) const
+void ANazareneEnemyCharacter::RefreshDerivedStats()
+{
+    const bool bBoss = Archetype == ENazareneEnemyArchetype::Boss;
+    const float PhaseSteps = bBoss ? float(BossPhase - 1) : 0.0f;
+
+    DerivedStats.PhaseSpeedScale = 1.0f + PhaseSteps * 0.12f;
+    DerivedStats.MoveSpeed = MoveSpeed * DerivedStats.PhaseSpeedScale;
+    DerivedStats.AttackDamage = AttackDamage * (1.0f + PhaseSteps * 0.2f) * (Archetype == ENazareneEnemyArchetype::Demon ? 1.08f : 1.0f);
+    DerivedStats.PostureDamage = PostureDamage * (1.0f + PhaseSteps * 0.16f);
+    DerivedStats.Windup = FMath::Max(AttackWindup * (1.0f - PhaseSteps * 0.08f), 0.16f);
+    DerivedStats.Recovery = FMath::Max(AttackRecovery * (1.0f - PhaseSteps * 0.06f), 0.24f);
+    DerivedStats.ParryStartRatio = FMath::Clamp(ParryWindowStartRatio + PhaseSteps * 0.05f, 0.1f, 0.84f);
+    DerivedStats.ParryEndRatio = FMath::Clamp(ParryWindowEndRatio - PhaseSteps * 0.05f, DerivedStats.ParryStartRatio + 0.06f, 0.95f);
+}
+
+void ANazareneEnemyCharacter::TriggerPresentation(USoundBase* Sound, UNiagaraSystem* Effect, const FVector& Location, float VolumeMultiplier, ENazareneCombatAudioCategory AudioCategory) const
 {
     if (Sound != nullptr)
     {
-        UGameplayStatics::PlaySoundAtLocation(this, Sound, Location, FRotator::ZeroRotator, VolumeMultiplier);
+        UNazareneCombatAudioSubsystem::Request(this, Sound, Location, VolumeMultiplier, AudioCategory);
     }
 
     if (Effect != nullptr && GetWorld() != nullptr)
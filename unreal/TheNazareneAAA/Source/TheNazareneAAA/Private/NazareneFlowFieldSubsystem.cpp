@@ -0,0 +1,368 @@
+#include "NazareneFlowFieldSubsystem.h"
+
+#include "CollisionQueryParams.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "Kismet/GameplayStatics.h"
+#include "NavigationSystem.h"
+#include "Tasks/Task.h"
+
+namespace
+{
+    constexpr int32 UnreachableCost = MAX_int32;
+    constexpr int32 StraightStepCost = 10;
+    constexpr int32 DiagonalStepCost = 14;
+
+    const FIntPoint NeighbourOffsets[8] =
+    {
+        FIntPoint(1, 0), FIntPoint(-1, 0), FIntPoint(0, 1), FIntPoint(0, -1),
+        FIntPoint(1, 1), FIntPoint(1, -1), FIntPoint(-1, 1), FIntPoint(-1, -1)
+    };
+
+    struct FOpenCell
+    {
+        int32 Cost;
+        int32 Index;
+
+        bool operator<(const FOpenCell& Other) const
+        {
+            return Cost < Other.Cost;
+        }
+    };
+}
+
+void UNazareneFlowFieldSubsystem::Deinitialize()
+{
+    BuildTask.Wait();
+    ClearRegionGrid();
+    Super::Deinitialize();
+}
+
+TStatId UNazareneFlowFieldSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UNazareneFlowFieldSubsystem, STATGROUP_Tickables);
+}
+
+void UNazareneFlowFieldSubsystem::BuildRegionGrid(const FBox& RegionBounds)
+{
+    ClearRegionGrid();
+    if (!RegionBounds.IsValid || CellSize <= KINDA_SMALL_NUMBER)
+    {
+        return;
+    }
+
+    const FVector Size = RegionBounds.GetSize();
+    GridOrigin = FVector(RegionBounds.Min.X, RegionBounds.Min.Y, RegionBounds.GetCenter().Z);
+    GridWidth = FMath::Clamp(FMath::CeilToInt(Size.X / CellSize), 1, 512);
+    GridHeight = FMath::Clamp(FMath::CeilToInt(Size.Y / CellSize), 1, 512);
+    Walkable.Init(0, GridWidth * GridHeight);
+    WalkabilityCursor = 0;
+    bWalkabilityReady = false;
+}
+
+void UNazareneFlowFieldSubsystem::ClearRegionGrid()
+{
+    // A build still in flight writes only into PendingField, which is discarded on completion.
+    PendingField.Reset();
+    FrontField.Reset();
+    Walkable.Empty();
+    GridWidth = 0;
+    GridHeight = 0;
+    WalkabilityCursor = 0;
+    bWalkabilityReady = false;
+    RequestedGoalCell = FIntPoint(INDEX_NONE, INDEX_NONE);
+}
+
+void UNazareneFlowFieldSubsystem::RegisterAgent(AActor* Agent)
+{
+    if (Agent != nullptr)
+    {
+        Agents.AddUnique(Agent);
+    }
+}
+
+void UNazareneFlowFieldSubsystem::UnregisterAgent(AActor* Agent)
+{
+    Agents.Remove(Agent);
+}
+
+void UNazareneFlowFieldSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    RebuildSeparationBuckets();
+
+    if (GridWidth <= 0)
+    {
+        return;
+    }
+
+    if (!bWalkabilityReady)
+    {
+        SampleWalkability(WalkabilitySamplesPerTick);
+        return;
+    }
+
+    if (PendingField.IsValid() && BuildTask.IsCompleted())
+    {
+        FrontField = PendingField;
+        PendingField.Reset();
+    }
+
+    TimeSinceRebuild += DeltaTime;
+
+    const APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(this, 0);
+    FIntPoint GoalCell;
+    if (PlayerPawn == nullptr || !WorldToCell(PlayerPawn->GetActorLocation(), GoalCell))
+    {
+        return;
+    }
+
+    if (GoalCell != RequestedGoalCell && !PendingField.IsValid() && TimeSinceRebuild >= MinRebuildInterval)
+    {
+        KickRebuild(GoalCell);
+    }
+}
+
+void UNazareneFlowFieldSubsystem::SampleWalkability(int32 Budget)
+{
+    UWorld* World = GetWorld();
+    if (World == nullptr)
+    {
+        return;
+    }
+
+    UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+    const bool bUseNavMesh = NavSystem != nullptr && NavSystem->GetDefaultNavDataInstance(FNavigationSystem::DontCreate) != nullptr;
+    const FVector ProjectExtent(CellSize * 0.45f, CellSize * 0.45f, 600.0f);
+    const FCollisionShape Probe = FCollisionShape::MakeBox(FVector(CellSize * 0.4f, CellSize * 0.4f, 60.0f));
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(NazareneFlowFieldWalkability), false);
+
+    const int32 CellCount = Walkable.Num();
+    const int32 End = FMath::Min(CellCount, WalkabilityCursor + FMath::Max(1, Budget));
+    for (; WalkabilityCursor < End; ++WalkabilityCursor)
+    {
+        const int32 X = WalkabilityCursor % GridWidth;
+        const int32 Y = WalkabilityCursor / GridWidth;
+        const FVector Center = GridOrigin + FVector((X + 0.5f) * CellSize, (Y + 0.5f) * CellSize, 0.0f);
+
+        // The navmesh is baked statically, so props and walls spawned with the region are only caught by the overlap probe.
+        FVector ProbeBase = Center;
+        bool bWalkable = true;
+        if (bUseNavMesh)
+        {
+            FNavLocation Projected;
+            bWalkable = NavSystem->ProjectPointToNavigation(Center, Projected, ProjectExtent);
+            ProbeBase = Projected.Location;
+        }
+        // Cells blocked by static geometry at hip height are walls.
+        bWalkable = bWalkable && !World->OverlapBlockingTestByChannel(ProbeBase + FVector(0.0f, 0.0f, 90.0f), FQuat::Identity, ECC_WorldStatic, Probe, Params);
+        Walkable[WalkabilityCursor] = bWalkable ? 1 : 0;
+    }
+
+    if (WalkabilityCursor >= CellCount)
+    {
+        bWalkabilityReady = true;
+    }
+}
+
+void UNazareneFlowFieldSubsystem::KickRebuild(const FIntPoint& GoalCell)
+{
+    RequestedGoalCell = GoalCell;
+    TimeSinceRebuild = 0.0f;
+
+    TSharedPtr<FNazareneFlowFieldBuild, ESPMode::ThreadSafe> Build = MakeShared<FNazareneFlowFieldBuild, ESPMode::ThreadSafe>();
+    Build->GoalCell = GoalCell;
+    PendingField = Build;
+
+    BuildTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Build, WalkableCopy = Walkable, Width = GridWidth, Height = GridHeight]()
+    {
+        BuildIntegrationField(WalkableCopy, Width, Height, *Build);
+    });
+}
+
+void UNazareneFlowFieldSubsystem::BuildIntegrationField(const TArray<uint8>& InWalkable, int32 Width, int32 Height, FNazareneFlowFieldBuild& Build)
+{
+    const int32 CellCount = Width * Height;
+    Build.Integration.Init(UnreachableCost, CellCount);
+    Build.Directions.Init(FVector2f::ZeroVector, CellCount);
+
+    const int32 GoalIndex = Build.GoalCell.Y * Width + Build.GoalCell.X;
+    if (!InWalkable.IsValidIndex(GoalIndex))
+    {
+        return;
+    }
+
+    // Dijkstra from the player's cell; the goal is seeded even if it projected as blocked.
+    TArray<FOpenCell> Open;
+    Open.Reserve(CellCount / 4);
+    Build.Integration[GoalIndex] = 0;
+    Open.HeapPush({ 0, GoalIndex });
+
+    while (Open.Num() > 0)
+    {
+        FOpenCell Current;
+        Open.HeapPop(Current, EAllowShrinking::No);
+        if (Current.Cost > Build.Integration[Current.Index])
+        {
+            continue;
+        }
+
+        const int32 CX = Current.Index % Width;
+        const int32 CY = Current.Index / Width;
+        for (int32 N = 0; N < 8; ++N)
+        {
+            const int32 NX = CX + NeighbourOffsets[N].X;
+            const int32 NY = CY + NeighbourOffsets[N].Y;
+            if (NX < 0 || NY < 0 || NX >= Width || NY >= Height)
+            {
+                continue;
+            }
+
+            const int32 NIndex = NY * Width + NX;
+            if (InWalkable[NIndex] == 0)
+            {
+                continue;
+            }
+
+            const bool bDiagonal = N >= 4;
+            if (bDiagonal && (InWalkable[CY * Width + NX] == 0 || InWalkable[NY * Width + CX] == 0))
+            {
+                continue;
+            }
+
+            const int32 NewCost = Current.Cost + (bDiagonal ? DiagonalStepCost : StraightStepCost);
+            if (NewCost < Build.Integration[NIndex])
+            {
+                Build.Integration[NIndex] = NewCost;
+                Open.HeapPush({ NewCost, NIndex });
+            }
+        }
+    }
+
+    for (int32 Index = 0; Index < CellCount; ++Index)
+    {
+        if (Build.Integration[Index] == UnreachableCost || Index == GoalIndex)
+        {
+            continue;
+        }
+
+        const int32 CX = Index % Width;
+        const int32 CY = Index / Width;
+        int32 BestCost = Build.Integration[Index];
+        FIntPoint BestStep = FIntPoint::ZeroValue;
+        for (int32 N = 0; N < 8; ++N)
+        {
+            const int32 NX = CX + NeighbourOffsets[N].X;
+            const int32 NY = CY + NeighbourOffsets[N].Y;
+            if (NX < 0 || NY < 0 || NX >= Width || NY >= Height)
+            {
+                continue;
+            }
+
+            const int32 NeighbourCost = Build.Integration[NY * Width + NX];
+            if (NeighbourCost < BestCost)
+            {
+                BestCost = NeighbourCost;
+                BestStep = NeighbourOffsets[N];
+            }
+        }
+
+        if (BestStep != FIntPoint::ZeroValue)
+        {
+            Build.Directions[Index] = FVector2f(float(BestStep.X), float(BestStep.Y)).GetSafeNormal();
+        }
+    }
+}
+
+FVector UNazareneFlowFieldSubsystem::SampleFlowDirection(const FVector& Location) const
+{
+    FIntPoint Cell;
+    if (!FrontField.IsValid() || !WorldToCell(Location, Cell))
+    {
+        return FVector::ZeroVector;
+    }
+
+    const FVector2f& Direction = FrontField->Directions[Cell.Y * GridWidth + Cell.X];
+    return FVector(Direction.X, Direction.Y, 0.0f);
+}
+
+void UNazareneFlowFieldSubsystem::RebuildSeparationBuckets()
+{
+    AgentBuckets.Reset();
+
+    for (int32 Index = Agents.Num() - 1; Index >= 0; --Index)
+    {
+        if (!Agents[Index].IsValid())
+        {
+            Agents.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+        }
+    }
+
+    for (const TWeakObjectPtr<AActor>& Agent : Agents)
+    {
+        FSeparationEntry Entry;
+        Entry.Agent = Agent.Get();
+        Entry.Location = Entry.Agent->GetActorLocation();
+        AgentBuckets.Add(ToBucket(Entry.Location), Entry);
+    }
+}
+
+FVector UNazareneFlowFieldSubsystem::ComputeSeparation(const AActor* Agent, const FVector& Location, float Radius) const
+{
+    if (Radius <= KINDA_SMALL_NUMBER)
+    {
+        return FVector::ZeroVector;
+    }
+
+    FVector Push = FVector::ZeroVector;
+    const FIntPoint Center = ToBucket(Location);
+    for (int32 DY = -1; DY <= 1; ++DY)
+    {
+        for (int32 DX = -1; DX <= 1; ++DX)
+        {
+            for (TMultiMap<FIntPoint, FSeparationEntry>::TConstKeyIterator It = AgentBuckets.CreateConstKeyIterator(Center + FIntPoint(DX, DY)); It; ++It)
+            {
+                const FSeparationEntry& Entry = It.Value();
+                if (Entry.Agent == Agent)
+                {
+                    continue;
+                }
+
+                FVector Away = Location - Entry.Location;
+                Away.Z = 0.0f;
+                const float Distance = Away.Size();
+                if (Distance >= Radius || Distance <= KINDA_SMALL_NUMBER)
+                {
+                    continue;
+                }
+                Push += (Away / Distance) * (1.0f - Distance / Radius);
+            }
+        }
+    }
+    return Push;
+}
+
+bool UNazareneFlowFieldSubsystem::WorldToCell(const FVector& Location, FIntPoint& OutCell) const
+{
+    if (GridWidth <= 0 || GridHeight <= 0)
+    {
+        return false;
+    }
+
+    const int32 X = FMath::FloorToInt((Location.X - GridOrigin.X) / CellSize);
+    const int32 Y = FMath::FloorToInt((Location.Y - GridOrigin.Y) / CellSize);
+    if (X < 0 || Y < 0 || X >= GridWidth || Y >= GridHeight)
+    {
+        return false;
+    }
+
+    OutCell = FIntPoint(X, Y);
+    return true;
+}
+
+FIntPoint UNazareneFlowFieldSubsystem::ToBucket(const FVector& Location) const
+{
+    const float BucketSize = FMath::Max(SeparationBucketSize, 1.0f);
+    return FIntPoint(FMath::FloorToInt(Location.X / BucketSize), FMath::FloorToInt(Location.Y / BucketSize));
+}
@@ -0,0 +1,256 @@
+#include "NazareneFrameBudgetSubsystem.h"
+
+#include "Components/PointLightComponent.h"
+#include "Engine/GameInstance.h"
+#include "Engine/PointLight.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "NazareneSettingsSubsystem.h"
+#include "NazareneStats.h"
+#include "NazareneVFXSubsystem.h"
+#include "RenderCore.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Quality Tier"), STAT_NazareneQualityTier, STATGROUP_NazareneScalability);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Frame Budget (ms)"), STAT_NazareneFrameBudgetMs, STATGROUP_NazareneScalability);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Game Thread Smoothed (ms)"), STAT_NazareneGameThreadMs, STATGROUP_NazareneScalability);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Render Thread Smoothed (ms)"), STAT_NazareneRenderThreadMs, STATGROUP_NazareneScalability);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Point Lights Culled"), STAT_NazarenePointLightsCulled, STATGROUP_NazareneScalability);
+
+namespace
+{
+    FNazareneQualityTier MakeTier(
+        const TCHAR* Name,
+        int32 AmbientVFXPerType,
+        int32 MaxPointLights,
+        int32 MaxEnemyHealthBars,
+        int32 MaxDamageNumbersPerFrame,
+        float EnemySignificanceScale,
+        float DistantEnemyTickInterval,
+        int32 AnimUROTierBias)
+    {
+        FNazareneQualityTier Tier;
+        Tier.Name = FName(Name);
+        Tier.AmbientVFXPerType = AmbientVFXPerType;
+        Tier.MaxPointLights = MaxPointLights;
+        Tier.MaxEnemyHealthBars = MaxEnemyHealthBars;
+        Tier.MaxDamageNumbersPerFrame = MaxDamageNumbersPerFrame;
+        Tier.EnemySignificanceScale = EnemySignificanceScale;
+        Tier.DistantEnemyTickInterval = DistantEnemyTickInterval;
+        Tier.AnimUROTierBias = AnimUROTierBias;
+        return Tier;
+    }
+}
+
+UNazareneFrameBudgetSubsystem::UNazareneFrameBudgetSubsystem()
+{
+    QualityTiers.Add(MakeTier(TEXT("High"), 5, 32, 12, 6, 1.0f, 0.0f, 0));
+    QualityTiers.Add(MakeTier(TEXT("Medium"), 3, 16, 8, 5, 0.85f, 0.05f, 0));
+    QualityTiers.Add(MakeTier(TEXT("Low"), 2, 8, 5, 4, 0.7f, 0.1f, 1));
+    QualityTiers.Add(MakeTier(TEXT("Minimum"), 1, 4, 3, 3, 0.55f, 0.2f, 2));
+}
+
+TStatId UNazareneFrameBudgetSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UNazareneFrameBudgetSubsystem, STATGROUP_Tickables);
+}
+
+void UNazareneFrameBudgetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // Consumers read the tier when they spawn or update, so a pinned tier needs no push here.
+    int32 PinnedTier = INDEX_NONE;
+    if (FParse::Value(FCommandLine::Get(), TEXT("NazareneQualityTier="), PinnedTier) && QualityTiers.IsValidIndex(PinnedTier))
+    {
+        TierOverride = PinnedTier;
+        ActiveTier = PinnedTier;
+    }
+}
+
+void UNazareneFrameBudgetSubsystem::Deinitialize()
+{
+    BudgetDisabledLights.Reset();
+    OnQualityTierChanged.Clear();
+    Super::Deinitialize();
+}
+
+const FNazareneQualityTier& UNazareneFrameBudgetSubsystem::GetActiveTier() const
+{
+    static const FNazareneQualityTier DefaultTier;
+    return QualityTiers.IsValidIndex(ActiveTier) ? QualityTiers[ActiveTier] : DefaultTier;
+}
+
+const FNazareneQualityTier* UNazareneFrameBudgetSubsystem::FindActiveTier(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject != nullptr ? WorldContextObject->GetWorld() : nullptr;
+    const UNazareneFrameBudgetSubsystem* Governor = World != nullptr ? World->GetSubsystem<UNazareneFrameBudgetSubsystem>() : nullptr;
+    return Governor != nullptr ? &Governor->GetActiveTier() : nullptr;
+}
+
+void UNazareneFrameBudgetSubsystem::SetTierOverride(int32 TierIndex)
+{
+    TierOverride = QualityTiers.IsValidIndex(TierIndex) ? TierIndex : INDEX_NONE;
+    if (TierOverride != INDEX_NONE)
+    {
+        SetActiveTier(TierOverride);
+    }
+}
+
+float UNazareneFrameBudgetSubsystem::ResolveFrameBudgetMilliseconds() const
+{
+    float FrameRate = FMath::Max(1.0f, TargetFrameRate);
+    const UGameInstance* GameInstance = GetWorld() != nullptr ? GetWorld()->GetGameInstance() : nullptr;
+    if (const UNazareneSettingsSubsystem* Settings = GameInstance ? GameInstance->GetSubsystem<UNazareneSettingsSubsystem>() : nullptr)
+    {
+        FrameRate = FMath::Min(FrameRate, FMath::Max(1.0f, Settings->GetSettings().FrameRateLimit));
+    }
+    return 1000.0f / FrameRate;
+}
+
+void UNazareneFrameBudgetSubsystem::Tick(float DeltaTime)
+{
+    SecondsSinceTierChange += DeltaTime;
+
+    PointLightRefreshTimer -= DeltaTime;
+    if (PointLightRefreshTimer <= 0.0f)
+    {
+        PointLightRefreshTimer = PointLightRefreshSeconds;
+        ApplyPointLightBudget();
+    }
+
+    if (DeltaTime <= 0.0f || DeltaTime > IgnoreFramesLongerThanSeconds)
+    {
+        return;
+    }
+
+    // Thread times exclude waits, so the slower of the two is the one that sets the frame rate.
+    const double Alpha = 0.1;
+    SmoothedGameThreadMilliseconds = FMath::Lerp(SmoothedGameThreadMilliseconds, static_cast<double>(FPlatformTime::ToMilliseconds(GGameThreadTime)), Alpha);
+    SmoothedRenderThreadMilliseconds = FMath::Lerp(SmoothedRenderThreadMilliseconds, static_cast<double>(FPlatformTime::ToMilliseconds(GRenderThreadTime)), Alpha);
+
+    const float BudgetMilliseconds = ResolveFrameBudgetMilliseconds();
+    const float BoundMilliseconds = static_cast<float>(FMath::Max(SmoothedGameThreadMilliseconds, SmoothedRenderThreadMilliseconds));
+
+    SET_DWORD_STAT(STAT_NazareneQualityTier, ActiveTier);
+    SET_FLOAT_STAT(STAT_NazareneFrameBudgetMs, BudgetMilliseconds);
+    SET_FLOAT_STAT(STAT_NazareneGameThreadMs, static_cast<float>(SmoothedGameThreadMilliseconds));
+    SET_FLOAT_STAT(STAT_NazareneRenderThreadMs, static_cast<float>(SmoothedRenderThreadMilliseconds));
+
+    if (TierOverride != INDEX_NONE)
+    {
+        return;
+    }
+
+    // The gap between the two fractions plus the hold times is the hysteresis band.
+    OverBudgetSeconds = BoundMilliseconds > BudgetMilliseconds * DowngradeBudgetFraction ? OverBudgetSeconds + DeltaTime : 0.0f;
+    UnderBudgetSeconds = BoundMilliseconds < BudgetMilliseconds * UpgradeBudgetFraction ? UnderBudgetSeconds + DeltaTime : 0.0f;
+
+    if (SecondsSinceTierChange < MinSecondsBetweenChanges)
+    {
+        return;
+    }
+
+    if (OverBudgetSeconds >= DowngradeHoldSeconds && ActiveTier < QualityTiers.Num() - 1)
+    {
+        SetActiveTier(ActiveTier + 1);
+    }
+    else if (UnderBudgetSeconds >= UpgradeHoldSeconds && ActiveTier > 0)
+    {
+        SetActiveTier(ActiveTier - 1);
+    }
+}
+
+void UNazareneFrameBudgetSubsystem::SetActiveTier(int32 NewTier)
+{
+    NewTier = FMath::Clamp(NewTier, 0, FMath::Max(0, QualityTiers.Num() - 1));
+    if (NewTier == ActiveTier)
+    {
+        return;
+    }
+
+    UE_LOG(
+        LogTemp,
+        Log,
+        TEXT("Frame budget: quality tier %d -> %d (%s); game %.2f ms, render %.2f ms, budget %.2f ms"),
+        ActiveTier,
+        NewTier,
+        *QualityTiers[NewTier].Name.ToString(),
+        SmoothedGameThreadMilliseconds,
+        SmoothedRenderThreadMilliseconds,
+        ResolveFrameBudgetMilliseconds()
+    );
+
+    ActiveTier = NewTier;
+    OverBudgetSeconds = 0.0f;
+    UnderBudgetSeconds = 0.0f;
+    SecondsSinceTierChange = 0.0f;
+    SET_DWORD_STAT(STAT_NazareneQualityTier, ActiveTier);
+
+    ApplyTierBudgets();
+    OnQualityTierChanged.Broadcast(ActiveTier, GetActiveTier());
+}
+
+void UNazareneFrameBudgetSubsystem::ApplyTierBudgets()
+{
+    if (UNazareneVFXSubsystem* VFX = GetWorld() != nullptr ? GetWorld()->GetSubsystem<UNazareneVFXSubsystem>() : nullptr)
+    {
+        VFX->SetAmbientInstanceBudget(GetActiveTier().AmbientVFXPerType);
+    }
+
+    PointLightRefreshTimer = PointLightRefreshSeconds;
+    ApplyPointLightBudget();
+}
+
+void UNazareneFrameBudgetSubsystem::ApplyPointLightBudget()
+{
+    UWorld* World = GetWorld();
+    APlayerController* PlayerController = World != nullptr ? World->GetFirstPlayerController() : nullptr;
+    if (PlayerController == nullptr)
+    {
+        return;
+    }
+
+    FVector ViewLocation;
+    FRotator ViewRotation;
+    PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+    // Only lights that are on, or that this budget turned off, are candidates; lights disabled elsewhere stay off.
+    BudgetDisabledLights.RemoveAll([](const TWeakObjectPtr<UPointLightComponent>& Light) { return !Light.IsValid(); });
+    TArray<UPointLightComponent*> Candidates;
+    for (TActorIterator<APointLight> It(World); It; ++It)
+    {
+        UPointLightComponent* Light = It->PointLightComponent;
+        if (Light != nullptr && (Light->IsVisible() || BudgetDisabledLights.Contains(Light)))
+        {
+            Candidates.Add(Light);
+        }
+    }
+
+    Candidates.Sort([&ViewLocation](const UPointLightComponent& A, const UPointLightComponent& B)
+    {
+        return FVector::DistSquared(A.GetComponentLocation(), ViewLocation) < FVector::DistSquared(B.GetComponentLocation(), ViewLocation);
+    });
+
+    const int32 MaxLights = FMath::Max(0, GetActiveTier().MaxPointLights);
+    for (int32 Index = 0; Index < Candidates.Num(); ++Index)
+    {
+        UPointLightComponent* Light = Candidates[Index];
+        const bool bEnable = Index < MaxLights;
+        if (bEnable && !Light->IsVisible())
+        {
+            Light->SetVisibility(true);
+            BudgetDisabledLights.Remove(Light);
+        }
+        else if (!bEnable && Light->IsVisible())
+        {
+            Light->SetVisibility(false);
+            BudgetDisabledLights.AddUnique(Light);
+        }
+    }
+
+    SET_DWORD_STAT(STAT_NazarenePointLightsCulled, BudgetDisabledLights.Num());
+}
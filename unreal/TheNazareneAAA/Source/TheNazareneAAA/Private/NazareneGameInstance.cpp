@@ -1,7 +1,10 @@
 #include "NazareneGameInstance.h"
 
+#include "NazareneStartupProfiler.h"
+
 void UNazareneGameInstance::Init()
 {
+    FNazareneStartupScope StartupScope(TEXT("GameInstance.Init"));
     Super::Init();
     StartNewGame();
 }
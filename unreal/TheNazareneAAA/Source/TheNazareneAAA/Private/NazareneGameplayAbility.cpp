@@ -5,6 +5,7 @@
 #include "GE_NazareneMiracleCooldown.h"
 #include "GE_NazareneMiracleCost.h"
 #include "NazareneAttributeSet.h"
+#include "NazareneGameplayTags.h"
 #include "NazarenePlayerCharacter.h"
 
 UNazareneGameplayAbility::UNazareneGameplayAbility()
@@ -61,7 +62,7 @@ bool UNazareneGameplayAbility::CommitMiracle(const FGameplayAbilityActorInfo* Ac
     {
         return false;
     }
-    CostSpec.Data->SetSetByCallerMagnitude(FGameplayTag::RequestGameplayTag(TEXT("Data.Miracle.FaithCost")), -FMath::Abs(FaithCost));
+    CostSpec.Data->SetSetByCallerMagnitude(NazareneGameplayTags::Data_Miracle_FaithCost, -FMath::Abs(FaithCost));
     ASC->ApplyGameplayEffectSpecToSelf(*CostSpec.Data.Get());
 
     if (CooldownDuration > 0.0f && CooldownTag.IsValid())
@@ -72,7 +73,7 @@ bool UNazareneGameplayAbility::CommitMiracle(const FGameplayAbilityActorInfo* Ac
             return false;
         }
 
-        CooldownSpec.Data->SetSetByCallerMagnitude(FGameplayTag::RequestGameplayTag(TEXT("Data.Miracle.Cooldown")), CooldownDuration);
+        CooldownSpec.Data->SetSetByCallerMagnitude(NazareneGameplayTags::Data_Miracle_Cooldown, CooldownDuration);
         CooldownSpec.Data->DynamicGrantedTags.AddTag(CooldownTag);
         ASC->ApplyGameplayEffectSpecToSelf(*CooldownSpec.Data.Get());
     }
@@ -0,0 +1,13 @@
+#include "NazareneGameplayTags.h"
+
+namespace NazareneGameplayTags
+{
+    UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_Miracle_FaithCost, "Data.Miracle.FaithCost", "SetByCaller tag used by miracle cost GameplayEffect");
+    UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_Miracle_Cooldown, "Data.Miracle.Cooldown", "SetByCaller tag used by miracle cooldown GameplayEffect");
+    UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_Miracle_Damage, "Data.Miracle.Damage", "SetByCaller tag used by miracle damage GameplayEffect");
+    UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_Miracle_PoiseDamage, "Data.Miracle.PoiseDamage", "SetByCaller poise damage carried alongside miracle damage");
+
+    UE_DEFINE_GAMEPLAY_TAG_COMMENT(Cooldown_Miracle_Heal, "Cooldown.Miracle.Heal", "Blocks heal miracle while cooldown effect is active");
+    UE_DEFINE_GAMEPLAY_TAG_COMMENT(Cooldown_Miracle_Blessing, "Cooldown.Miracle.Blessing", "Blocks blessing miracle while cooldown effect is active");
+    UE_DEFINE_GAMEPLAY_TAG_COMMENT(Cooldown_Miracle_Radiance, "Cooldown.Miracle.Radiance", "Blocks radiance miracle while cooldown effect is active");
+}
@@ -3,12 +3,18 @@
 #include "Blueprint/UserWidget.h"
 #include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
+#include "NazareneCombatEventSubsystem.h"
 #include "NazareneCursorWidget.h"
+#include "NazareneFrameBudgetSubsystem.h"
 #include "NazareneHUDWidget.h"
+#include "NazareneMemoryTags.h"
+#include "NazareneStartupProfiler.h"
 #include "TimerManager.h"
 
 void ANazareneHUD::BeginPlay()
 {
+    LLM_SCOPE_BYTAG(Nazarene_HUD);
+    FNazareneStartupScope StartupScope(TEXT("HUD.BeginPlay"));
     Super::BeginPlay();
 
     APlayerController* PlayerController = GetOwningPlayerController();
@@ -35,6 +41,10 @@ void ANazareneHUD::BeginPlay()
 
     if (UWorld* World = GetWorld())
     {
+        if (UNazareneCombatEventSubsystem* CombatEvents = World->GetSubsystem<UNazareneCombatEventSubsystem>())
+        {
+            CombatEventsHandle = CombatEvents->OnEventsFlushed.AddUObject(this, &ANazareneHUD::HandleCombatEvents);
+        }
         World->GetTimerManager().SetTimerForNextTick(this, &ANazareneHUD::ApplyInitialMenuState);
     }
     else
@@ -43,6 +53,50 @@ void ANazareneHUD::BeginPlay()
     }
 }
 
+void ANazareneHUD::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (UNazareneCombatEventSubsystem* CombatEvents = World->GetSubsystem<UNazareneCombatEventSubsystem>())
+        {
+            CombatEvents->OnEventsFlushed.Remove(CombatEventsHandle);
+        }
+    }
+    CombatEventsHandle.Reset();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void ANazareneHUD::HandleCombatEvents(TConstArrayView<FNazareneCombatEvent> Events)
+{
+    if (RuntimeWidget == nullptr)
+    {
+        return;
+    }
+
+    int32 MaxShown = MaxDamageNumbersPerFrame;
+    if (const FNazareneQualityTier* Tier = UNazareneFrameBudgetSubsystem::FindActiveTier(this))
+    {
+        MaxShown = FMath::Min(MaxShown, Tier->MaxDamageNumbersPerFrame);
+    }
+
+    int32 Shown = 0;
+    for (const FNazareneCombatEvent& Event : Events)
+    {
+        if (!Event.bDisplayNumber)
+        {
+            continue;
+        }
+        if (Shown >= MaxShown)
+        {
+            break;
+        }
+
+        RuntimeWidget->ShowDamageNumber(Event.Location + FVector(0.0f, 0.0f, Event.NumberHeight), Event.Amount, Event.NumberType);
+        ++Shown;
+    }
+}
+
 void ANazareneHUD::DrawHUD()
 {
     Super::DrawHUD();
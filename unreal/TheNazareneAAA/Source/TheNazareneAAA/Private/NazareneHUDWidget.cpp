@@ -5,7 +5,9 @@
 #include "Components/Button.h"
 #include "Components/CanvasPanel.h"
 #include "Components/CanvasPanelSlot.h"
+#include "Components/InvalidationBox.h"
 #include "Components/ProgressBar.h"
+#include "Components/RetainerBox.h"
 #include "Components/ScrollBox.h"
 #include "Components/Spacer.h"
 #include "Components/TextBlock.h"
@@ -13,23 +15,62 @@
 #include "Components/VerticalBoxSlot.h"
 #include "EngineUtils.h"
 #include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
 #include "NazareneCampaignGameMode.h"
 #include "NazareneDamageNumberWidget.h"
 #include "NazareneEnemyCharacter.h"
 #include "NazareneEnemyHealthBarWidget.h"
+#include "NazareneFrameBudgetSubsystem.h"
 #include "NazareneGameInstance.h"
 #include "NazareneHUD.h"
+#include "NazareneMemoryTags.h"
 #include "NazarenePlayerCharacter.h"
 #include "NazareneSaveSubsystem.h"
 #include "NazareneSettingsSubsystem.h"
 #include "NazareneSkillTreeWidget.h"
+#include "NazareneStartupProfiler.h"
 #include "Components/SizeBox.h"
 #include "Styling/SlateTypes.h"
 
 namespace
 {
+    // Menu overlays are added to the root canvas in whatever order they are first opened.
+    constexpr int32 PauseMenuZOrder = 10;
+    constexpr int32 StartMenuZOrder = 20;
+    constexpr int32 OptionsMenuZOrder = 30;
+    constexpr int32 DeathOverlayZOrder = 40;
+    constexpr int32 LoadingOverlayZOrder = 50;
+
+    /** Idle-frame prewarm waits out the startup window and skips frames slower than this. */
+    constexpr float MenuPrewarmMaxFrameSeconds = 1.0f / 50.0f;
+
+    /** The retained controls strip redraws once every this many frames. */
+    constexpr int32 ControlsRetainerPhaseCount = 30;
+
+    /** Only push text that actually changed, so cached HUD regions are not invalidated every frame. */
+    static void SetTextIfChanged(UTextBlock* Text, FString& DisplayedValue, const FString& Value)
+    {
+        if (Text == nullptr || DisplayedValue.Equals(Value, ESearchCase::CaseSensitive))
+        {
+            return;
+        }
+
+        DisplayedValue = Value;
+        Text->SetText(FText::FromString(Value));
+    }
+
+    static void SetVisibilityIfChanged(UWidget* Widget, ESlateVisibility Visibility)
+    {
+        if (Widget != nullptr && Widget->GetVisibility() != Visibility)
+        {
+            Widget->SetVisibility(Visibility);
+        }
+    }
+
     static void ConfigureText(UTextBlock* Text, const FString& Value, const FLinearColor& Color, int32 Size)
     {
         if (Text == nullptr)
@@ -211,6 +252,10 @@ void UNazareneHUDWidget::NativeOnInitialized()
 {
     Super::NativeOnInitialized();
 
+    FNazareneStartupScope StartupScope(TEXT("HUD.WidgetConstruct"));
+    InitializeStartSeconds = FPlatformTime::Seconds();
+    bStartupBenchmark = FParse::Param(FCommandLine::Get(), TEXT("NazareneHUDBenchmark"));
+
     if (WidgetTree == nullptr)
     {
         return;
@@ -222,17 +267,23 @@ void UNazareneHUDWidget::NativeOnInitialized()
         return;
     }
     WidgetTree->RootWidget = RootPanel;
+    RootCanvas = RootPanel;
 
-    UBorder* PlayerPanel = WidgetTree->ConstructWidget<UBorder>(UBorder::StaticClass(), TEXT("PlayerPanel"));
-    PlayerPanel->SetBrushColor(FLinearColor(0.07f, 0.07f, 0.06f, 0.74f));
-    PlayerPanelRoot = PlayerPanel;
-    UCanvasPanelSlot* PlayerPanelSlot = RootPanel->AddChildToCanvas(PlayerPanel);
+    // Panel frames and labels sit in cached invalidation regions; only bars that animate every frame are volatile.
+    UInvalidationBox* PlayerPanelCache = WidgetTree->ConstructWidget<UInvalidationBox>(UInvalidationBox::StaticClass(), TEXT("PlayerPanelCache"));
+    PlayerPanelCache->SetCanCache(true);
+    PlayerPanelRoot = PlayerPanelCache;
+    UCanvasPanelSlot* PlayerPanelSlot = RootPanel->AddChildToCanvas(PlayerPanelCache);
     if (PlayerPanelSlot != nullptr)
     {
         PlayerPanelSlot->SetSize(FVector2D(470.0f, 380.0f));
         PlayerPanelSlot->SetPosition(FVector2D(24.0f, 18.0f));
     }
 
+    UBorder* PlayerPanel = WidgetTree->ConstructWidget<UBorder>(UBorder::StaticClass(), TEXT("PlayerPanel"));
+    PlayerPanel->SetBrushColor(FLinearColor(0.07f, 0.07f, 0.06f, 0.74f));
+    PlayerPanelCache->SetContent(PlayerPanel);
+
     UVerticalBox* PlayerPanelContent = WidgetTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass(), TEXT("PlayerPanelContent"));
     PlayerPanel->SetContent(PlayerPanelContent);
 
@@ -246,6 +297,7 @@ void UNazareneHUDWidget::NativeOnInitialized()
 
     HealthBar = WidgetTree->ConstructWidget<UProgressBar>(UProgressBar::StaticClass(), TEXT("HealthBar"));
     HealthBar->SetPercent(1.0f);
+    HealthBar->ForceVolatile(true);
     HealthBar->SetFillColorAndOpacity(FLinearColor(0.83f, 0.24f, 0.20f, 1.0f));
     AddVerticalChild(PlayerPanelContent, HealthBar, FMargin(14.0f, 2.0f, 14.0f, 6.0f));
 
@@ -255,6 +307,7 @@ void UNazareneHUDWidget::NativeOnInitialized()
 
     StaminaBar = WidgetTree->ConstructWidget<UProgressBar>(UProgressBar::StaticClass(), TEXT("StaminaBar"));
     StaminaBar->SetPercent(1.0f);
+    StaminaBar->ForceVolatile(true);
     StaminaBar->SetFillColorAndOpacity(FLinearColor(0.30f, 0.78f, 0.34f, 1.0f));
     AddVerticalChild(PlayerPanelContent, StaminaBar, FMargin(14.0f, 2.0f, 14.0f, 6.0f));
 
@@ -287,6 +340,7 @@ void UNazareneHUDWidget::NativeOnInitialized()
     if (HealCooldownBar != nullptr)
     {
         HealCooldownBar->SetPercent(1.0f);
+        HealCooldownBar->ForceVolatile(true);
         HealCooldownBar->SetFillColorAndOpacity(FLinearColor(0.2f, 0.8f, 0.3f, 0.9f));
         AddVerticalChild(PlayerPanelContent, HealCooldownBar, FMargin(14.0f, 2.0f, 14.0f, 2.0f));
     }
@@ -295,6 +349,7 @@ void UNazareneHUDWidget::NativeOnInitialized()
     if (BlessingCooldownBar != nullptr)
     {
         BlessingCooldownBar->SetPercent(1.0f);
+        BlessingCooldownBar->ForceVolatile(true);
         BlessingCooldownBar->SetFillColorAndOpacity(FLinearColor(0.9f, 0.8f, 0.3f, 0.9f));
         AddVerticalChild(PlayerPanelContent, BlessingCooldownBar, FMargin(14.0f, 2.0f, 14.0f, 2.0f));
     }
@@ -303,14 +358,15 @@ void UNazareneHUDWidget::NativeOnInitialized()
     if (RadianceCooldownBar != nullptr)
     {
         RadianceCooldownBar->SetPercent(1.0f);
+        RadianceCooldownBar->ForceVolatile(true);
         RadianceCooldownBar->SetFillColorAndOpacity(FLinearColor(0.9f, 0.6f, 0.2f, 0.9f));
         AddVerticalChild(PlayerPanelContent, RadianceCooldownBar, FMargin(14.0f, 2.0f, 14.0f, 6.0f));
     }
 
-    UBorder* ObjectivePanel = WidgetTree->ConstructWidget<UBorder>(UBorder::StaticClass(), TEXT("ObjectivePanel"));
-    ObjectivePanel->SetBrushColor(FLinearColor(0.07f, 0.07f, 0.06f, 0.74f));
-    ObjectivePanelRoot = ObjectivePanel;
-    UCanvasPanelSlot* ObjectivePanelSlot = RootPanel->AddChildToCanvas(ObjectivePanel);
+    UInvalidationBox* ObjectivePanelCache = WidgetTree->ConstructWidget<UInvalidationBox>(UInvalidationBox::StaticClass(), TEXT("ObjectivePanelCache"));
+    ObjectivePanelCache->SetCanCache(true);
+    ObjectivePanelRoot = ObjectivePanelCache;
+    UCanvasPanelSlot* ObjectivePanelSlot = RootPanel->AddChildToCanvas(ObjectivePanelCache);
     if (ObjectivePanelSlot != nullptr)
     {
         ObjectivePanelSlot->SetSize(FVector2D(500.0f, 190.0f));
@@ -319,6 +375,10 @@ void UNazareneHUDWidget::NativeOnInitialized()
         ObjectivePanelSlot->SetPosition(FVector2D(-24.0f, 18.0f));
     }
 
+    UBorder* ObjectivePanel = WidgetTree->ConstructWidget<UBorder>(UBorder::StaticClass(), TEXT("ObjectivePanel"));
+    ObjectivePanel->SetBrushColor(FLinearColor(0.07f, 0.07f, 0.06f, 0.74f));
+    ObjectivePanelCache->SetContent(ObjectivePanel);
+
     UVerticalBox* ObjectiveContent = WidgetTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass(), TEXT("ObjectiveContent"));
     ObjectivePanel->SetContent(ObjectiveContent);
 
@@ -335,6 +395,7 @@ void UNazareneHUDWidget::NativeOnInitialized()
     ConfigureText(MessageText, TEXT(""), FLinearColor(0.95f, 0.90f, 0.78f), 18);
     MessageText->SetJustification(ETextJustify::Center);
     MessageText->SetVisibility(ESlateVisibility::Collapsed);
+    MessageText->ForceVolatile(true);
     UCanvasPanelSlot* MessageSlot = RootPanel->AddChildToCanvas(MessageText);
     if (MessageSlot != nullptr)
     {
@@ -366,7 +427,13 @@ void UNazareneHUDWidget::NativeOnInitialized()
         13
     );
     ControlsTextRoot->SetAutoWrapText(true);
-    UCanvasPanelSlot* ControlsSlot = RootPanel->AddChildToCanvas(ControlsTextRoot);
+
+    // The controls strip never changes, so it is kept in a retainer and redrawn only on its phase.
+    URetainerBox* ControlsRetainer = WidgetTree->ConstructWidget<URetainerBox>(URetainerBox::StaticClass(), TEXT("ControlsRetainer"));
+    ControlsRetainer->SetRenderingPhase(0, ControlsRetainerPhaseCount);
+    ControlsRetainer->SetContent(ControlsTextRoot);
+    ControlsPanelRoot = ControlsRetainer;
+    UCanvasPanelSlot* ControlsSlot = RootPanel->AddChildToCanvas(ControlsRetainer);
     if (ControlsSlot != nullptr)
     {
         ControlsSlot->SetSize(FVector2D(1300.0f, 40.0f));
@@ -375,14 +442,28 @@ void UNazareneHUDWidget::NativeOnInitialized()
         ControlsSlot->SetPosition(FVector2D(24.0f, -18.0f));
     }
 
+    // Menu panels are built on first open or prewarmed on idle frames; only the start menu is needed now.
+    SetStartMenuVisible(true);
+
+    InitializeMilliseconds = (FPlatformTime::Seconds() - InitializeStartSeconds) * 1000.0;
+}
+
+void UNazareneHUDWidget::BuildPauseMenu()
+{
+    if (WidgetTree == nullptr || RootCanvas == nullptr)
+    {
+        return;
+    }
+
     PauseOverlay = WidgetTree->ConstructWidget<UBorder>(UBorder::StaticClass(), TEXT("PauseOverlay"));
     PauseOverlay->SetBrushColor(FLinearColor(0.01f, 0.01f, 0.01f, 0.82f));
     PauseOverlay->SetVisibility(ESlateVisibility::Collapsed);
-    UCanvasPanelSlot* PauseOverlaySlot = RootPanel->AddChildToCanvas(PauseOverlay);
+    UCanvasPanelSlot* PauseOverlaySlot = RootCanvas->AddChildToCanvas(PauseOverlay);
     if (PauseOverlaySlot != nullptr)
     {
         PauseOverlaySlot->SetAnchors(FAnchors(0.0f, 0.0f, 1.0f, 1.0f));
         PauseOverlaySlot->SetOffsets(FMargin(0.0f));
+        PauseOverlaySlot->SetZOrder(PauseMenuZOrder);
     }
 
     UCanvasPanel* PauseCanvas = WidgetTree->ConstructWidget<UCanvasPanel>(UCanvasPanel::StaticClass(), TEXT("PauseCanvas"));
@@ -514,15 +595,24 @@ void UNazareneHUDWidget::NativeOnInitialized()
             }
         }
     }
+}
+
+void UNazareneHUDWidget::BuildStartMenu()
+{
+    if (WidgetTree == nullptr || RootCanvas == nullptr)
+    {
+        return;
+    }
 
     StartMenuOverlay = WidgetTree->ConstructWidget<UBorder>(UBorder::StaticClass(), TEXT("StartMenuOverlay"));
     StartMenuOverlay->SetBrushColor(FLinearColor(0.01f, 0.01f, 0.00f, 0.56f));
     StartMenuOverlay->SetVisibility(ESlateVisibility::Collapsed);
-    UCanvasPanelSlot* StartOverlaySlot = RootPanel->AddChildToCanvas(StartMenuOverlay);
+    UCanvasPanelSlot* StartOverlaySlot = RootCanvas->AddChildToCanvas(StartMenuOverlay);
     if (StartOverlaySlot != nullptr)
     {
         StartOverlaySlot->SetAnchors(FAnchors(0.0f, 0.0f, 1.0f, 1.0f));
         StartOverlaySlot->SetOffsets(FMargin(0.0f));
+        StartOverlaySlot->SetZOrder(StartMenuZOrder);
     }
 
     UCanvasPanel* StartCanvas = WidgetTree->ConstructWidget<UCanvasPanel>(UCanvasPanel::StaticClass(), TEXT("StartCanvas"));
@@ -597,15 +687,24 @@ void UNazareneHUDWidget::NativeOnInitialized()
             }
         }
     }
+}
+
+void UNazareneHUDWidget::BuildOptionsMenu()
+{
+    if (WidgetTree == nullptr || RootCanvas == nullptr)
+    {
+        return;
+    }
 
     OptionsOverlay = WidgetTree->ConstructWidget<UBorder>(UBorder::StaticClass(), TEXT("OptionsOverlay"));
     OptionsOverlay->SetBrushColor(FLinearColor(0.0f, 0.0f, 0.0f, 0.94f));
     OptionsOverlay->SetVisibility(ESlateVisibility::Collapsed);
-    UCanvasPanelSlot* OptionsOverlaySlot = RootPanel->AddChildToCanvas(OptionsOverlay);
+    UCanvasPanelSlot* OptionsOverlaySlot = RootCanvas->AddChildToCanvas(OptionsOverlay);
     if (OptionsOverlaySlot != nullptr)
     {
         OptionsOverlaySlot->SetAnchors(FAnchors(0.0f, 0.0f, 1.0f, 1.0f));
         OptionsOverlaySlot->SetOffsets(FMargin(0.0f));
+        OptionsOverlaySlot->SetZOrder(OptionsMenuZOrder);
     }
 
     UCanvasPanel* OptionsCanvas = WidgetTree->ConstructWidget<UCanvasPanel>(UCanvasPanel::StaticClass(), TEXT("OptionsCanvas"));
@@ -767,15 +866,24 @@ void UNazareneHUDWidget::NativeOnInitialized()
             }
         }
     }
+}
+
+void UNazareneHUDWidget::BuildDeathOverlay()
+{
+    if (WidgetTree == nullptr || RootCanvas == nullptr)
+    {
+        return;
+    }
 
     DeathOverlay = WidgetTree->ConstructWidget<UBorder>(UBorder::StaticClass(), TEXT("DeathOverlay"));
     DeathOverlay->SetBrushColor(FLinearColor(0.0f, 0.0f, 0.0f, 0.86f));
     DeathOverlay->SetVisibility(ESlateVisibility::Collapsed);
-    UCanvasPanelSlot* DeathOverlaySlot = RootPanel->AddChildToCanvas(DeathOverlay);
+    UCanvasPanelSlot* DeathOverlaySlot = RootCanvas->AddChildToCanvas(DeathOverlay);
     if (DeathOverlaySlot != nullptr)
     {
         DeathOverlaySlot->SetAnchors(FAnchors(0.0f, 0.0f, 1.0f, 1.0f));
         DeathOverlaySlot->SetOffsets(FMargin(0.0f));
+        DeathOverlaySlot->SetZOrder(DeathOverlayZOrder);
     }
 
     UVerticalBox* DeathContent = WidgetTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass(), TEXT("DeathContent"));
@@ -797,15 +905,24 @@ void UNazareneHUDWidget::NativeOnInitialized()
     {
         RiseAgainButton->OnClicked.AddDynamic(this, &UNazareneHUDWidget::HandleRiseAgainPressed);
     }
+}
+
+void UNazareneHUDWidget::BuildLoadingOverlay()
+{
+    if (WidgetTree == nullptr || RootCanvas == nullptr)
+    {
+        return;
+    }
 
     LoadingOverlay = WidgetTree->ConstructWidget<UBorder>(UBorder::StaticClass(), TEXT("LoadingOverlay"));
     LoadingOverlay->SetBrushColor(FLinearColor(0.01f, 0.01f, 0.01f, 0.88f));
     LoadingOverlay->SetVisibility(ESlateVisibility::Collapsed);
-    UCanvasPanelSlot* LoadingOverlaySlot = RootPanel->AddChildToCanvas(LoadingOverlay);
+    UCanvasPanelSlot* LoadingOverlaySlot = RootCanvas->AddChildToCanvas(LoadingOverlay);
     if (LoadingOverlaySlot != nullptr)
     {
         LoadingOverlaySlot->SetAnchors(FAnchors(0.0f, 0.0f, 1.0f, 1.0f));
         LoadingOverlaySlot->SetOffsets(FMargin(0.0f));
+        LoadingOverlaySlot->SetZOrder(LoadingOverlayZOrder);
     }
 
     UVerticalBox* LoadingContent = WidgetTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass(), TEXT("LoadingContent"));
@@ -821,7 +938,11 @@ void UNazareneHUDWidget::NativeOnInitialized()
     LoadingTipText->SetJustification(ETextJustify::Center);
     LoadingTipText->SetAutoWrapText(true);
     AddVerticalChild(LoadingContent, LoadingTipText, FMargin(120.0f, 0.0f, 120.0f, 12.0f));
+}
 
+void UNazareneHUDWidget::BuildSkillTree()
+{
+    LLM_SCOPE_BYTAG(Nazarene_HUD);
     // Skill Tree Widget (separate viewport widget, toggled by T key)
     APlayerController* SkillTreePC = GetOwningPlayer();
     if (SkillTreePC != nullptr)
@@ -833,17 +954,155 @@ void UNazareneHUDWidget::NativeOnInitialized()
             SkillTreeWidget->SetVisibility(ESlateVisibility::Collapsed);
         }
     }
+}
 
+bool UNazareneHUDWidget::IsPanelBuilt(EMenuPanel Panel) const
+{
+    switch (Panel)
+    {
+    case EMenuPanel::Start:
+        return StartMenuOverlay != nullptr;
+    case EMenuPanel::Pause:
+        return PauseOverlay != nullptr;
+    case EMenuPanel::Options:
+        return OptionsOverlay != nullptr;
+    case EMenuPanel::Death:
+        return DeathOverlay != nullptr;
+    case EMenuPanel::Loading:
+        return LoadingOverlay != nullptr;
+    case EMenuPanel::SkillTree:
+        return SkillTreeWidget != nullptr;
+    default:
+        return true;
+    }
+}
+
+void UNazareneHUDWidget::EnsurePanelBuilt(EMenuPanel Panel)
+{
+    LLM_SCOPE_BYTAG(Nazarene_HUD);
+    if (IsPanelBuilt(Panel))
+    {
+        return;
+    }
+
+    const double BuildStartSeconds = FPlatformTime::Seconds();
+    switch (Panel)
+    {
+    case EMenuPanel::Start:
+        BuildStartMenu();
+        break;
+    case EMenuPanel::Pause:
+        BuildPauseMenu();
+        break;
+    case EMenuPanel::Options:
+        BuildOptionsMenu();
+        break;
+    case EMenuPanel::Death:
+        BuildDeathOverlay();
+        break;
+    case EMenuPanel::Loading:
+        BuildLoadingOverlay();
+        break;
+    case EMenuPanel::SkillTree:
+        BuildSkillTree();
+        break;
+    default:
+        break;
+    }
+
+    const double BuildMilliseconds = (FPlatformTime::Seconds() - BuildStartSeconds) * 1000.0;
+    PanelBuildMilliseconds[static_cast<int32>(Panel)] = BuildMilliseconds;
+    UE_LOG(LogTemp, Verbose, TEXT("HUD panel %d built in %.3f ms."), static_cast<int32>(Panel), BuildMilliseconds);
+
+    // New panel slots pick up the current viewport size.
     RefreshResponsiveMenuLayout();
-    RefreshSlotSummaries();
-    RefreshOptionsSummary();
-    SetStartMenuVisible(true);
+}
+
+void UNazareneHUDWidget::TickMenuPrewarm(float DeltaTime)
+{
+    // Panels that open mid-combat are worth building ahead of time; options and the skill tree wait for first use.
+    static const EMenuPanel PrewarmOrder[] = { EMenuPanel::Pause, EMenuPanel::Death, EMenuPanel::Loading };
+
+    if (PrewarmCursor >= static_cast<int32>(UE_ARRAY_COUNT(PrewarmOrder)))
+    {
+        return;
+    }
+
+    MenuPrewarmDelayRemaining = FMath::Max(0.0f, MenuPrewarmDelayRemaining - DeltaTime);
+    if (MenuPrewarmDelayRemaining > 0.0f || DeltaTime > MenuPrewarmMaxFrameSeconds)
+    {
+        return;
+    }
+
+    // One panel per idle frame keeps the build cost out of any single frame's budget.
+    EnsurePanelBuilt(PrewarmOrder[PrewarmCursor++]);
+}
+
+int32 UNazareneHUDWidget::CountWidgets() const
+{
+    TArray<UWidget*> Widgets;
+    if (WidgetTree != nullptr)
+    {
+        WidgetTree->GetAllWidgets(Widgets);
+    }
+    int32 Count = Widgets.Num();
+
+    if (SkillTreeWidget != nullptr && SkillTreeWidget->WidgetTree != nullptr)
+    {
+        Widgets.Reset();
+        SkillTreeWidget->WidgetTree->GetAllWidgets(Widgets);
+        Count += Widgets.Num() + 1;
+    }
+    return Count;
+}
+
+void UNazareneHUDWidget::ReportStartupBenchmark()
+{
+    const double FirstFrameMilliseconds = (FPlatformTime::Seconds() - InitializeStartSeconds) * 1000.0;
+    const int32 LazyWidgetCount = CountWidgets();
+
+    // Build everything still pending so the same run also reports what eager construction would cost.
+    double DeferredMilliseconds = 0.0;
+    for (int32 PanelIndex = 0; PanelIndex < static_cast<int32>(EMenuPanel::Count); ++PanelIndex)
+    {
+        const EMenuPanel Panel = static_cast<EMenuPanel>(PanelIndex);
+        if (!IsPanelBuilt(Panel))
+        {
+            EnsurePanelBuilt(Panel);
+            DeferredMilliseconds += PanelBuildMilliseconds[PanelIndex];
+        }
+    }
+
+    UE_LOG(
+        LogTemp,
+        Display,
+        TEXT("HUDBenchmark: init_ms=%.3f first_frame_ms=%.3f since_launch_s=%.3f widgets=%d deferred_ms=%.3f eager_widgets=%d"),
+        InitializeMilliseconds,
+        FirstFrameMilliseconds,
+        FPlatformTime::Seconds() - GStartTime,
+        LazyWidgetCount,
+        DeferredMilliseconds,
+        CountWidgets()
+    );
+
+    UKismetSystemLibrary::QuitGame(this, GetOwningPlayer(), EQuitPreference::Quit, false);
 }
 
 void UNazareneHUDWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
     Super::NativeTick(MyGeometry, InDeltaTime);
 
+    if (!bFirstFrameTicked)
+    {
+        bFirstFrameTicked = true;
+        NazareneStartupProfiler::MarkInteractive();
+        if (bStartupBenchmark)
+        {
+            ReportStartupBenchmark();
+        }
+    }
+    TickMenuPrewarm(InDeltaTime);
+
     CachedDeltaTime = InDeltaTime;
     const FVector2D ViewportSize = ResolveViewportSize(this);
     if (!ViewportSize.Equals(CachedMenuViewportSize, 1.0f))
@@ -859,14 +1118,11 @@ void UNazareneHUDWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTi
     if (MessageTimer > 0.0f)
     {
         MessageTimer = FMath::Max(0.0f, MessageTimer - InDeltaTime);
-        if (MessageText != nullptr)
-        {
-            MessageText->SetVisibility(ESlateVisibility::Visible);
-        }
+        SetVisibilityIfChanged(MessageText, ESlateVisibility::Visible);
     }
-    else if (MessageText != nullptr)
+    else
     {
-        MessageText->SetVisibility(ESlateVisibility::Collapsed);
+        SetVisibilityIfChanged(MessageText, ESlateVisibility::Collapsed);
     }
 
     for (int32 Index = DamageNumberWidgets.Num() - 1; Index >= 0; --Index)
@@ -931,9 +1187,9 @@ void UNazareneHUDWidget::SetGameplayHUDVisible(bool bVisible)
         ObjectivePanelRoot->SetVisibility(TargetVisibility);
     }
 
-    if (ControlsTextRoot != nullptr)
+    if (ControlsPanelRoot != nullptr)
     {
-        ControlsTextRoot->SetVisibility(TargetVisibility);
+        ControlsPanelRoot->SetVisibility(TargetVisibility);
     }
 }
 
@@ -967,6 +1223,7 @@ void UNazareneHUDWidget::ShowMessage(const FString& InMessage, float Duration)
 
 void UNazareneHUDWidget::ShowDamageNumber(const FVector& WorldLocation, float Amount, ENazareneDamageNumberType Type)
 {
+    LLM_SCOPE_BYTAG(Nazarene_HUD);
     APlayerController* PlayerController = GetOwningPlayer();
     if (PlayerController == nullptr)
     {
@@ -986,6 +1243,8 @@ void UNazareneHUDWidget::ShowDamageNumber(const FVector& WorldLocation, float Am
 
 void UNazareneHUDWidget::ShowDeathOverlay(int32 RetryCount)
 {
+    EnsurePanelBuilt(EMenuPanel::Death);
+
     if (DeathRetryText != nullptr)
     {
         DeathRetryText->SetText(FText::FromString(FString::Printf(TEXT("Attempt %d begins at the nearest prayer site."), FMath::Max(1, RetryCount))));
@@ -1004,6 +1263,11 @@ void UNazareneHUDWidget::ShowDeathOverlay(int32 RetryCount)
 
 void UNazareneHUDWidget::SetLoadingOverlayVisible(bool bVisible, const FString& LoreTip)
 {
+    if (bVisible)
+    {
+        EnsurePanelBuilt(EMenuPanel::Loading);
+    }
+
     if (LoadingTipText != nullptr && !LoreTip.IsEmpty())
     {
         LoadingTipText->SetText(FText::FromString(LoreTip));
@@ -1017,6 +1281,11 @@ void UNazareneHUDWidget::SetLoadingOverlayVisible(bool bVisible, const FString&
 
 void UNazareneHUDWidget::SetStartMenuVisible(bool bVisible)
 {
+    if (bVisible)
+    {
+        EnsurePanelBuilt(EMenuPanel::Start);
+    }
+
     RefreshResponsiveMenuLayout();
     SetGameplayHUDVisible(!bVisible);
 
@@ -1060,6 +1329,11 @@ void UNazareneHUDWidget::SetPauseMenuVisible(bool bVisible)
         return;
     }
 
+    if (bVisible)
+    {
+        EnsurePanelBuilt(EMenuPanel::Pause);
+    }
+
     if (PauseOverlay != nullptr)
     {
         PauseOverlay->SetVisibility(bVisible ? ESlateVisibility::Visible : ESlateVisibility::Collapsed);
@@ -1087,6 +1361,12 @@ bool UNazareneHUDWidget::IsPauseMenuVisible() const
 
 void UNazareneHUDWidget::RefreshSlotSummaries()
 {
+    // The pause menu refreshes these when it opens; nothing to update until it exists.
+    if (PauseOverlay == nullptr)
+    {
+        return;
+    }
+
     UNazareneSaveSubsystem* SaveSubsystem = nullptr;
     if (UGameInstance* GameInstance = GetGameInstance())
     {
@@ -1180,18 +1460,9 @@ void UNazareneHUDWidget::RefreshVitals(const ANazarenePlayerCharacter* Player)
     const float HealthRatio = MaxHealth > 0.0f ? Health / MaxHealth : 0.0f;
     const float StaminaRatio = MaxStamina > 0.0f ? Stamina / MaxStamina : 0.0f;
 
-    if (HealthText != nullptr)
-    {
-        HealthText->SetText(FText::FromString(FString::Printf(TEXT("Health %.0f / %.0f"), Health, MaxHealth)));
-    }
-    if (StaminaText != nullptr)
-    {
-        StaminaText->SetText(FText::FromString(FString::Printf(TEXT("Stamina %.0f / %.0f"), Stamina, MaxStamina)));
-    }
-    if (FaithText != nullptr)
-    {
-        FaithText->SetText(FText::FromString(FString::Printf(TEXT("Faith %.0f"), Player->GetFaith())));
-    }
+    SetTextIfChanged(HealthText, DisplayedHealthLabel, FString::Printf(TEXT("Health %.0f / %.0f"), Health, MaxHealth));
+    SetTextIfChanged(StaminaText, DisplayedStaminaLabel, FString::Printf(TEXT("Stamina %.0f / %.0f"), Stamina, MaxStamina));
+    SetTextIfChanged(FaithText, DisplayedFaithLabel, FString::Printf(TEXT("Faith %.0f"), Player->GetFaith()));
     // Smooth bar interpolation
     const float TargetHealthPercent = FMath::Clamp(HealthRatio, 0.0f, 1.0f);
     DisplayedHealthPercent = FMath::FInterpTo(DisplayedHealthPercent, TargetHealthPercent, CachedDeltaTime, BarLerpSpeed);
@@ -1278,12 +1549,9 @@ void UNazareneHUDWidget::RefreshVitals(const ANazarenePlayerCharacter* Player)
     if (LockTargetText != nullptr)
     {
         const FString TargetName = Player->GetLockTargetName();
-        LockTargetText->SetText(FText::FromString(FString::Printf(TEXT("Lock-On %s"), TargetName.IsEmpty() ? TEXT("None") : *TargetName)));
-    }
-    if (ContextHintText != nullptr)
-    {
-        ContextHintText->SetText(FText::FromString(Player->GetContextHint()));
+        SetTextIfChanged(LockTargetText, DisplayedLockTargetLabel, FString::Printf(TEXT("Lock-On %s"), TargetName.IsEmpty() ? TEXT("None") : *TargetName));
     }
+    SetTextIfChanged(ContextHintText, DisplayedContextHint, Player->GetContextHint());
 
     if (CriticalStateText != nullptr)
     {
@@ -1303,13 +1571,16 @@ void UNazareneHUDWidget::RefreshVitals(const ANazarenePlayerCharacter* Player)
 
         if (CriticalState.IsEmpty())
         {
-            CriticalStateText->SetVisibility(ESlateVisibility::Collapsed);
+            SetVisibilityIfChanged(CriticalStateText, ESlateVisibility::Collapsed);
         }
         else
         {
-            CriticalStateText->SetText(FText::FromString(CriticalState));
-            CriticalStateText->SetColorAndOpacity(FSlateColor(CriticalColor));
-            CriticalStateText->SetVisibility(ESlateVisibility::Visible);
+            if (!DisplayedCriticalState.Equals(CriticalState, ESearchCase::CaseSensitive))
+            {
+                CriticalStateText->SetColorAndOpacity(FSlateColor(CriticalColor));
+            }
+            SetTextIfChanged(CriticalStateText, DisplayedCriticalState, CriticalState);
+            SetVisibilityIfChanged(CriticalStateText, ESlateVisibility::Visible);
         }
     }
 
@@ -1322,18 +1593,18 @@ void UNazareneHUDWidget::RefreshVitals(const ANazarenePlayerCharacter* Player)
             ? FString::Printf(TEXT("Radiance %.1fs"), Player->GetRadianceCooldownRemaining())
             : TEXT("Radiance Locked");
 
-        CombatStateText->SetText(
-            FText::FromString(
-                FString::Printf(
-                    TEXT("Lvl %d | XP %d (Next %d) | Skill Pts %d\nHeal %.1fs | %s | %s"),
-                    Player->GetPlayerLevel(),
-                    Player->GetTotalXP(),
-                    Player->GetXPToNextLevel(),
-                    Player->GetSkillPoints(),
-                    Player->GetHealCooldownRemaining(),
-                    *BlessingState,
-                    *RadianceState
-                )
+        SetTextIfChanged(
+            CombatStateText,
+            DisplayedCombatState,
+            FString::Printf(
+                TEXT("Lvl %d | XP %d (Next %d) | Skill Pts %d\nHeal %.1fs | %s | %s"),
+                Player->GetPlayerLevel(),
+                Player->GetTotalXP(),
+                Player->GetXPToNextLevel(),
+                Player->GetSkillPoints(),
+                Player->GetHealCooldownRemaining(),
+                *BlessingState,
+                *RadianceState
             )
         );
     }
@@ -1341,6 +1612,7 @@ void UNazareneHUDWidget::RefreshVitals(const ANazarenePlayerCharacter* Player)
 
 void UNazareneHUDWidget::SyncEnemyHealthBars(ANazarenePlayerCharacter* Player)
 {
+    LLM_SCOPE_BYTAG(Nazarene_HUD);
     if (Player == nullptr || GetOwningPlayer() == nullptr || GetWorld() == nullptr)
     {
         return;
@@ -1356,6 +1628,18 @@ void UNazareneHUDWidget::SyncEnemyHealthBars(ANazarenePlayerCharacter* Player)
         }
     }
 
+    // Over the tier's bar budget only the nearest enemies keep a bar; the rest are culled below.
+    const FNazareneQualityTier* Tier = UNazareneFrameBudgetSubsystem::FindActiveTier(this);
+    if (Tier != nullptr && Enemies.Num() > Tier->MaxEnemyHealthBars)
+    {
+        const FVector PlayerLocation = Player->GetActorLocation();
+        Enemies.Sort([&PlayerLocation](const ANazareneEnemyCharacter& A, const ANazareneEnemyCharacter& B)
+        {
+            return FVector::DistSquared(A.GetActorLocation(), PlayerLocation) < FVector::DistSquared(B.GetActorLocation(), PlayerLocation);
+        });
+        Enemies.SetNum(FMath::Max(0, Tier->MaxEnemyHealthBars));
+    }
+
     for (ANazareneEnemyCharacter* Enemy : Enemies)
     {
         bool bHasWidget = false;
@@ -1494,6 +1778,7 @@ void UNazareneHUDWidget::HandleContinuePilgrimagePressed()
 
 void UNazareneHUDWidget::HandleOptionsPressed()
 {
+    EnsurePanelBuilt(EMenuPanel::Options);
     RefreshResponsiveMenuLayout();
 
     bOptionsOpenedFromStartMenu = IsStartMenuVisible();
@@ -1874,6 +2159,11 @@ void UNazareneHUDWidget::HandleRiseAgainPressed()
 
 void UNazareneHUDWidget::SetSkillTreeVisible(bool bVisible)
 {
+    if (bVisible)
+    {
+        EnsurePanelBuilt(EMenuPanel::SkillTree);
+    }
+
     if (SkillTreeWidget == nullptr)
     {
         return;
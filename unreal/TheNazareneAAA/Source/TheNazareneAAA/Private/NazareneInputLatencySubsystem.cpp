@@ -0,0 +1,274 @@
+#include "NazareneInputLatencySubsystem.h"
+
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "NazareneProfiling.h"
+#include "NazareneStats.h"
+
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input To Act (ms)"), STAT_NazareneInputToActMs, STATGROUP_NazareneCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Input To Display (ms)"), STAT_NazareneInputToDisplayMs, STATGROUP_NazareneCombat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Latency Probes Dropped"), STAT_NazareneLatencyProbesDropped, STATGROUP_NazareneCombat);
+
+const float FNazareneLatencyHistogram::BucketEdgesMs[FNazareneLatencyHistogram::NumBuckets - 1] = { 4.0f, 8.0f, 16.7f, 25.0f, 33.3f, 50.0f, 66.7f, 100.0f, 150.0f, 250.0f };
+
+namespace
+{
+    const TCHAR* ProbeName(ENazareneLatencyProbe Probe)
+    {
+        switch (Probe)
+        {
+        case ENazareneLatencyProbe::LightAttack:
+            return TEXT("LightAttack");
+        case ENazareneLatencyProbe::HeavyAttack:
+            return TEXT("HeavyAttack");
+        case ENazareneLatencyProbe::Dodge:
+            return TEXT("Dodge");
+        case ENazareneLatencyProbe::Parry:
+            return TEXT("Parry");
+        case ENazareneLatencyProbe::Block:
+            return TEXT("Block");
+        case ENazareneLatencyProbe::Miracle:
+            return TEXT("Miracle");
+        default:
+            return TEXT("Unknown");
+        }
+    }
+
+    UNazareneInputLatencySubsystem* FindLatencySubsystem(const UObject* WorldContextObject)
+    {
+        const UWorld* World = WorldContextObject != nullptr ? WorldContextObject->GetWorld() : nullptr;
+        const UGameInstance* GameInstance = World != nullptr ? World->GetGameInstance() : nullptr;
+        return GameInstance != nullptr ? GameInstance->GetSubsystem<UNazareneInputLatencySubsystem>() : nullptr;
+    }
+}
+
+void FNazareneLatencyHistogram::Add(float Milliseconds)
+{
+    int32 Bucket = 0;
+    while (Bucket < NumBuckets - 1 && Milliseconds > BucketEdgesMs[Bucket])
+    {
+        ++Bucket;
+    }
+    ++Buckets[Bucket];
+    ++Count;
+    SumMs += Milliseconds;
+    MaxMs = FMath::Max(MaxMs, Milliseconds);
+}
+
+void UNazareneInputLatencySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    bEnabled = !UE_BUILD_SHIPPING && !FParse::Param(FCommandLine::Get(), TEXT("NoNazareneLatencyProbes"));
+    if (!bEnabled)
+    {
+        return;
+    }
+
+    ReportFilePath = NazareneProfiling::ResolveReportPath(TEXT("NazareneLatencyCsv="), TEXT("InputLatency"));
+
+    EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UNazareneInputLatencySubsystem::HandleEndFrame);
+}
+
+void UNazareneInputLatencySubsystem::Deinitialize()
+{
+    FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+    EndFrameHandle.Reset();
+
+    uint32 SampleCount = 0;
+    for (const FNazareneLatencyHistogram& Histogram : ActedHistograms)
+    {
+        SampleCount += Histogram.Count;
+    }
+    if (bEnabled && SampleCount > 0)
+    {
+        WriteReport();
+    }
+    PendingProbes.Reset();
+
+    Super::Deinitialize();
+}
+
+int32 UNazareneInputLatencySubsystem::Begin(const UObject* WorldContextObject, ENazareneLatencyProbe Probe)
+{
+    UNazareneInputLatencySubsystem* Latency = FindLatencySubsystem(WorldContextObject);
+    return Latency != nullptr ? Latency->BeginProbe(Probe) : 0;
+}
+
+void UNazareneInputLatencySubsystem::Acted(const UObject* WorldContextObject, int32 ProbeId)
+{
+    if (ProbeId == 0)
+    {
+        return;
+    }
+    if (UNazareneInputLatencySubsystem* Latency = FindLatencySubsystem(WorldContextObject))
+    {
+        Latency->MarkActed(ProbeId);
+    }
+}
+
+void UNazareneInputLatencySubsystem::Drop(const UObject* WorldContextObject, int32 ProbeId)
+{
+    if (ProbeId == 0)
+    {
+        return;
+    }
+    if (UNazareneInputLatencySubsystem* Latency = FindLatencySubsystem(WorldContextObject))
+    {
+        Latency->DropProbe(ProbeId);
+    }
+}
+
+int32 UNazareneInputLatencySubsystem::BeginProbe(ENazareneLatencyProbe Probe)
+{
+    if (!bEnabled || Probe >= ENazareneLatencyProbe::Count)
+    {
+        return 0;
+    }
+
+    // Ids only need to outlive MaxPendingSeconds; skip 0 on wrap so it keeps meaning "no probe".
+    LastProbeId = LastProbeId == MAX_int32 ? 1 : LastProbeId + 1;
+
+    FPendingProbe& Pending = PendingProbes.AddDefaulted_GetRef();
+    Pending.Id = LastProbeId;
+    Pending.Probe = Probe;
+    Pending.PressedSeconds = FPlatformTime::Seconds();
+    return Pending.Id;
+}
+
+void UNazareneInputLatencySubsystem::MarkActed(int32 ProbeId)
+{
+    if (!bEnabled)
+    {
+        return;
+    }
+
+    FPendingProbe* Pending = PendingProbes.FindByPredicate([ProbeId](const FPendingProbe& Candidate)
+    {
+        return Candidate.Id == ProbeId && Candidate.FrameEndsSinceActed == INDEX_NONE;
+    });
+    if (Pending == nullptr)
+    {
+        return;
+    }
+
+    Pending->ActedSeconds = FPlatformTime::Seconds();
+    Pending->FrameEndsSinceActed = 0;
+
+    const float Milliseconds = static_cast<float>((Pending->ActedSeconds - Pending->PressedSeconds) * 1000.0);
+    ActedHistograms[static_cast<int32>(Pending->Probe)].Add(Milliseconds);
+    SET_FLOAT_STAT(STAT_NazareneInputToActMs, Milliseconds);
+}
+
+void UNazareneInputLatencySubsystem::DropProbe(int32 ProbeId)
+{
+    const int32 Index = PendingProbes.IndexOfByPredicate([ProbeId](const FPendingProbe& Candidate)
+    {
+        return Candidate.Id == ProbeId && Candidate.FrameEndsSinceActed == INDEX_NONE;
+    });
+    if (Index != INDEX_NONE)
+    {
+        PendingProbes.RemoveAt(Index);
+        INC_DWORD_STAT(STAT_NazareneLatencyProbesDropped);
+    }
+}
+
+void UNazareneInputLatencySubsystem::HandleEndFrame()
+{
+    if (PendingProbes.Num() == 0)
+    {
+        return;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    for (int32 Index = PendingProbes.Num() - 1; Index >= 0; --Index)
+    {
+        FPendingProbe& Pending = PendingProbes[Index];
+        if (Pending.FrameEndsSinceActed == INDEX_NONE)
+        {
+            if (Now - Pending.PressedSeconds > MaxPendingSeconds)
+            {
+                PendingProbes.RemoveAt(Index);
+                INC_DWORD_STAT(STAT_NazareneLatencyProbesDropped);
+            }
+            continue;
+        }
+
+        // The acting frame is rendered while the next game frame runs; its end means the frame is out.
+        if (++Pending.FrameEndsSinceActed >= 2)
+        {
+            const float Milliseconds = static_cast<float>((Now - Pending.PressedSeconds) * 1000.0);
+            DisplayHistograms[static_cast<int32>(Pending.Probe)].Add(Milliseconds);
+            SET_FLOAT_STAT(STAT_NazareneInputToDisplayMs, Milliseconds);
+            PendingProbes.RemoveAt(Index);
+        }
+    }
+}
+
+const FNazareneLatencyHistogram& UNazareneInputLatencySubsystem::GetHistogram(ENazareneLatencyProbe Probe, bool bDisplayStage) const
+{
+    const int32 Index = FMath::Clamp(static_cast<int32>(Probe), 0, static_cast<int32>(ENazareneLatencyProbe::Count) - 1);
+    return bDisplayStage ? DisplayHistograms[Index] : ActedHistograms[Index];
+}
+
+void UNazareneInputLatencySubsystem::ResetHistograms()
+{
+    for (int32 Index = 0; Index < static_cast<int32>(ENazareneLatencyProbe::Count); ++Index)
+    {
+        ActedHistograms[Index] = FNazareneLatencyHistogram();
+        DisplayHistograms[Index] = FNazareneLatencyHistogram();
+    }
+    PendingProbes.Reset();
+}
+
+bool UNazareneInputLatencySubsystem::WriteReport() const
+{
+    if (!bEnabled || ReportFilePath.IsEmpty())
+    {
+        return false;
+    }
+
+    FString Csv = TEXT("Probe,Stage,Count,MeanMs,MaxMs");
+    for (int32 Bucket = 0; Bucket < FNazareneLatencyHistogram::NumBuckets; ++Bucket)
+    {
+        Csv += Bucket < FNazareneLatencyHistogram::NumBuckets - 1
+            ? FString::Printf(TEXT(",Le%.1fMs"), FNazareneLatencyHistogram::BucketEdgesMs[Bucket])
+            : FString::Printf(TEXT(",Gt%.1fMs"), FNazareneLatencyHistogram::BucketEdgesMs[Bucket - 1]);
+    }
+    Csv += LINE_TERMINATOR;
+
+    for (int32 Index = 0; Index < static_cast<int32>(ENazareneLatencyProbe::Count); ++Index)
+    {
+        for (int32 Stage = 0; Stage < 2; ++Stage)
+        {
+            const FNazareneLatencyHistogram& Histogram = Stage == 0 ? ActedHistograms[Index] : DisplayHistograms[Index];
+            const double MeanMs = Histogram.Count > 0 ? Histogram.SumMs / Histogram.Count : 0.0;
+            Csv += FString::Printf(TEXT("%s,%s,%u,%.2f,%.2f"), ProbeName(static_cast<ENazareneLatencyProbe>(Index)), Stage == 0 ? TEXT("Act") : TEXT("Display"), Histogram.Count, MeanMs, Histogram.MaxMs);
+            for (int32 Bucket = 0; Bucket < FNazareneLatencyHistogram::NumBuckets; ++Bucket)
+            {
+                Csv += FString::Printf(TEXT(",%u"), Histogram.Buckets[Bucket]);
+            }
+            Csv += LINE_TERMINATOR;
+
+            if (Histogram.Count > 0)
+            {
+                UE_LOG(LogTemp, Log, TEXT("Input latency %s/%s: %u samples, mean %.2f ms, max %.2f ms"),
+                    ProbeName(static_cast<ENazareneLatencyProbe>(Index)), Stage == 0 ? TEXT("act") : TEXT("display"), Histogram.Count, MeanMs, Histogram.MaxMs);
+            }
+        }
+    }
+
+    if (!FFileHelper::SaveStringToFile(Csv, *ReportFilePath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to write input latency report: %s"), *ReportFilePath);
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Input latency report saved: %s"), *ReportFilePath);
+    return true;
+}
@@ -0,0 +1,407 @@
+#include "NazareneInputReplaySubsystem.h"
+
+#include "EnhancedInputSubsystems.h"
+#include "EnhancedPlayerInput.h"
+#include "Engine/GameInstance.h"
+#include "Engine/LocalPlayer.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
+#include "InputAction.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "NazareneInputLatencySubsystem.h"
+#include "NazarenePlayerCharacter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+    constexpr uint32 CaptureMagic = 0x52495A4E; // "NZIR"
+    constexpr uint16 CaptureVersion = 1;
+
+    static FString ResolveCapturePath(const FString& FilePath)
+    {
+        return FPaths::IsRelative(FilePath) ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("InputReplays"), FilePath) : FilePath;
+    }
+
+    static APlayerController* ResolvePlayerController(const ANazarenePlayerCharacter* Player)
+    {
+        return Player != nullptr ? Cast<APlayerController>(Player->GetController()) : nullptr;
+    }
+}
+
+void UNazareneInputReplaySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    FString FilePath;
+    if (FParse::Value(FCommandLine::Get(), TEXT("NazareneReplayInput="), FilePath))
+    {
+        bQuitWhenReplayEnds = FParse::Param(FCommandLine::Get(), TEXT("NazareneReplayQuit"));
+        StartReplay(FilePath);
+    }
+    else if (FParse::Value(FCommandLine::Get(), TEXT("NazareneRecordInput="), FilePath))
+    {
+        StartRecording(FilePath);
+    }
+}
+
+void UNazareneInputReplaySubsystem::Deinitialize()
+{
+    StopRecording();
+    Super::Deinitialize();
+}
+
+TStatId UNazareneInputReplaySubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UNazareneInputReplaySubsystem, STATGROUP_Tickables);
+}
+
+ETickableTickType UNazareneInputReplaySubsystem::GetTickableTickType() const
+{
+    return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UNazareneInputReplaySubsystem::IsTickable() const
+{
+    return Mode == ENazareneInputReplayMode::Recording || Mode == ENazareneInputReplayMode::Replaying;
+}
+
+UWorld* UNazareneInputReplaySubsystem::GetTickableGameObjectWorld() const
+{
+    const UGameInstance* GameInstance = GetGameInstance();
+    return GameInstance != nullptr ? GameInstance->GetWorld() : nullptr;
+}
+
+bool UNazareneInputReplaySubsystem::StartRecording(const FString& FilePath)
+{
+    if (IsReplayActive() || FilePath.IsEmpty())
+    {
+        return false;
+    }
+
+    CaptureFilePath = ResolveCapturePath(FilePath);
+    Events.Reset();
+    Frame = 0;
+    Mode = ENazareneInputReplayMode::RecordArmed;
+    UE_LOG(LogTemp, Log, TEXT("Input capture armed: %s"), *CaptureFilePath);
+    return true;
+}
+
+bool UNazareneInputReplaySubsystem::StopRecording()
+{
+    if (Mode != ENazareneInputReplayMode::Recording && Mode != ENazareneInputReplayMode::RecordArmed)
+    {
+        return false;
+    }
+
+    const bool bWasRecording = (Mode == ENazareneInputReplayMode::Recording);
+    Mode = ENazareneInputReplayMode::Idle;
+    return bWasRecording && WriteCapture();
+}
+
+bool UNazareneInputReplaySubsystem::StartReplay(const FString& FilePath)
+{
+    if (Mode == ENazareneInputReplayMode::Recording || !ReadCapture(ResolveCapturePath(FilePath)))
+    {
+        return false;
+    }
+
+    Mode = ENazareneInputReplayMode::ReplayArmed;
+    UE_LOG(LogTemp, Log, TEXT("Input replay armed: %s (%d events, %u frames, seed %d)"), *CaptureFilePath, Events.Num(), ReplayFrameCount, ReplaySeed);
+    return true;
+}
+
+bool UNazareneInputReplaySubsystem::GetReplaySeed(int32& OutSeed) const
+{
+    if (!IsReplayActive() || !bHasReplaySeed)
+    {
+        return false;
+    }
+    OutSeed = ReplaySeed;
+    return true;
+}
+
+void UNazareneInputReplaySubsystem::NotifyGameplayStarted(ANazarenePlayerCharacter* Player)
+{
+    if (Mode != ENazareneInputReplayMode::RecordArmed && Mode != ENazareneInputReplayMode::ReplayArmed)
+    {
+        return;
+    }
+
+    if (!BindPlayer(Player))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Input replay could not bind to the player; capture disabled."));
+        Mode = ENazareneInputReplayMode::Idle;
+        return;
+    }
+
+    Frame = 0;
+    ReplayCursor = 0;
+    CurrentValues.Init(0.0f, TrackedActions.Num());
+    if (Mode == ENazareneInputReplayMode::ReplayArmed)
+    {
+        if (UNazareneInputLatencySubsystem* Latency = GetGameInstance()->GetSubsystem<UNazareneInputLatencySubsystem>())
+        {
+            Latency->ResetHistograms();
+        }
+    }
+    ReplayStartSeconds = FPlatformTime::Seconds();
+    LastFrameSeconds = ReplayStartSeconds;
+    WorstFrameMilliseconds = 0.0;
+    Mode = (Mode == ENazareneInputReplayMode::RecordArmed) ? ENazareneInputReplayMode::Recording : ENazareneInputReplayMode::Replaying;
+}
+
+bool UNazareneInputReplaySubsystem::BindPlayer(ANazarenePlayerCharacter* Player)
+{
+    if (Player == nullptr)
+    {
+        return false;
+    }
+
+    TArray<UInputAction*> Actions;
+    Player->GetReplayInputActions(Actions);
+    if (Actions.Num() == 0 || Actions.Num() > MAX_uint8)
+    {
+        return false;
+    }
+
+    BoundPlayer = Player;
+    TrackedActions.Reset();
+    for (UInputAction* Action : Actions)
+    {
+        TrackedActions.Add(Action);
+    }
+
+    if (Mode == ENazareneInputReplayMode::RecordArmed)
+    {
+        CaptureActionNames.Reset();
+        for (const UInputAction* Action : TrackedActions)
+        {
+            CaptureActionNames.Add(Action != nullptr ? Action->GetFName() : NAME_None);
+        }
+        return true;
+    }
+
+    // Match captured actions by name so a replay survives actions being added or reordered.
+    ReplayToTracked.Init(INDEX_NONE, CaptureActionNames.Num());
+    for (int32 CaptureIndex = 0; CaptureIndex < CaptureActionNames.Num(); ++CaptureIndex)
+    {
+        ReplayToTracked[CaptureIndex] = TrackedActions.IndexOfByPredicate([&](const UInputAction* Action)
+        {
+            return Action != nullptr && Action->GetFName() == CaptureActionNames[CaptureIndex];
+        });
+    }
+    return true;
+}
+
+void UNazareneInputReplaySubsystem::Tick(float DeltaTime)
+{
+    if (!BoundPlayer.IsValid())
+    {
+        if (Mode == ENazareneInputReplayMode::Recording)
+        {
+            StopRecording();
+        }
+        else if (Mode == ENazareneInputReplayMode::Replaying)
+        {
+            FinishReplay();
+        }
+        return;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    WorstFrameMilliseconds = FMath::Max(WorstFrameMilliseconds, (Now - LastFrameSeconds) * 1000.0);
+    LastFrameSeconds = Now;
+
+    if (Mode == ENazareneInputReplayMode::Recording)
+    {
+        TickRecording();
+    }
+    else if (Mode == ENazareneInputReplayMode::Replaying)
+    {
+        TickReplay();
+    }
+    ++Frame;
+}
+
+void UNazareneInputReplaySubsystem::TickRecording()
+{
+    const APlayerController* PlayerController = ResolvePlayerController(BoundPlayer.Get());
+    const UEnhancedPlayerInput* PlayerInput = PlayerController != nullptr ? Cast<UEnhancedPlayerInput>(PlayerController->PlayerInput) : nullptr;
+    if (PlayerInput == nullptr)
+    {
+        return;
+    }
+
+    for (int32 Index = 0; Index < TrackedActions.Num(); ++Index)
+    {
+        const UInputAction* Action = TrackedActions[Index];
+        if (Action == nullptr)
+        {
+            continue;
+        }
+
+        const float Value = PlayerInput->GetActionValue(Action).Get<float>();
+        if (Value != CurrentValues[Index])
+        {
+            CurrentValues[Index] = Value;
+            Events.Add({ Frame, static_cast<uint8>(Index), Value });
+        }
+    }
+}
+
+void UNazareneInputReplaySubsystem::TickReplay()
+{
+    APlayerController* PlayerController = ResolvePlayerController(BoundPlayer.Get());
+    UEnhancedInputLocalPlayerSubsystem* InputSubsystem = PlayerController != nullptr
+        ? ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PlayerController->GetLocalPlayer())
+        : nullptr;
+    if (InputSubsystem == nullptr)
+    {
+        return;
+    }
+
+    // Injected values are consumed by the next frame's input pass, so feed the frame ahead.
+    const uint32 TargetFrame = Frame + 1;
+    while (Events.IsValidIndex(ReplayCursor) && Events[ReplayCursor].Frame <= TargetFrame)
+    {
+        const FNazareneInputReplayEvent& Event = Events[ReplayCursor++];
+        const int32 TrackedIndex = ReplayToTracked.IsValidIndex(Event.ActionIndex) ? ReplayToTracked[Event.ActionIndex] : INDEX_NONE;
+        if (CurrentValues.IsValidIndex(TrackedIndex))
+        {
+            CurrentValues[TrackedIndex] = Event.Value;
+        }
+    }
+
+    for (int32 Index = 0; Index < TrackedActions.Num(); ++Index)
+    {
+        if (TrackedActions[Index] != nullptr && CurrentValues[Index] != 0.0f)
+        {
+            InputSubsystem->InjectInputForAction(TrackedActions[Index], FInputActionValue(CurrentValues[Index]));
+        }
+    }
+
+    if (TargetFrame >= ReplayFrameCount && !Events.IsValidIndex(ReplayCursor))
+    {
+        FinishReplay();
+    }
+}
+
+void UNazareneInputReplaySubsystem::FinishReplay()
+{
+    const double ElapsedSeconds = FPlatformTime::Seconds() - ReplayStartSeconds;
+    const double AverageMilliseconds = Frame > 0 ? (ElapsedSeconds * 1000.0) / static_cast<double>(Frame) : 0.0;
+    UE_LOG(LogTemp, Log, TEXT("Input replay finished: %u frames in %.2fs, avg %.2f ms, worst %.2f ms (%s)"),
+        Frame, ElapsedSeconds, AverageMilliseconds, WorstFrameMilliseconds, *CaptureFilePath);
+
+    Mode = ENazareneInputReplayMode::Idle;
+    BoundPlayer.Reset();
+
+    // Replays are the latency regression run, so their report is written before any quit.
+    if (UNazareneInputLatencySubsystem* Latency = GetGameInstance()->GetSubsystem<UNazareneInputLatencySubsystem>())
+    {
+        Latency->WriteReport();
+    }
+
+    if (bQuitWhenReplayEnds)
+    {
+        FPlatformMisc::RequestExit(false);
+    }
+}
+
+bool UNazareneInputReplaySubsystem::WriteCapture() const
+{
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes);
+
+    uint32 Magic = CaptureMagic;
+    uint16 Version = CaptureVersion;
+    int32 Seed = RecordingSeed;
+    uint32 FrameCount = Frame;
+    uint8 ActionCount = static_cast<uint8>(CaptureActionNames.Num());
+    Writer << Magic << Version << Seed << FrameCount << ActionCount;
+    for (FName ActionName : CaptureActionNames)
+    {
+        FString Name = ActionName.ToString();
+        Writer << Name;
+    }
+
+    int32 EventCount = Events.Num();
+    Writer << EventCount;
+    uint32 PreviousFrame = 0;
+    for (const FNazareneInputReplayEvent& Event : Events)
+    {
+        uint32 FrameDelta = Event.Frame - PreviousFrame;
+        uint8 ActionIndex = Event.ActionIndex;
+        float Value = Event.Value;
+        Writer.SerializeIntPacked(FrameDelta);
+        Writer << ActionIndex << Value;
+        PreviousFrame = Event.Frame;
+    }
+
+    if (!FFileHelper::SaveArrayToFile(Bytes, *CaptureFilePath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to write input capture: %s"), *CaptureFilePath);
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Input capture saved: %s (%u frames, %d events, %d bytes)"), *CaptureFilePath, Frame, Events.Num(), Bytes.Num());
+    return true;
+}
+
+bool UNazareneInputReplaySubsystem::ReadCapture(const FString& FilePath)
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Input capture not found: %s"), *FilePath);
+        return false;
+    }
+
+    FMemoryReader Reader(Bytes);
+    uint32 Magic = 0;
+    uint16 Version = 0;
+    uint8 ActionCount = 0;
+    Reader << Magic << Version << ReplaySeed << ReplayFrameCount << ActionCount;
+    if (Magic != CaptureMagic || Version != CaptureVersion)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Input capture has an unknown format: %s"), *FilePath);
+        return false;
+    }
+
+    CaptureActionNames.Reset(ActionCount);
+    for (uint8 Index = 0; Index < ActionCount; ++Index)
+    {
+        FString Name;
+        Reader << Name;
+        CaptureActionNames.Add(FName(*Name));
+    }
+
+    int32 EventCount = 0;
+    Reader << EventCount;
+    Events.Reset(FMath::Max(0, EventCount));
+    uint32 EventFrame = 0;
+    for (int32 Index = 0; Index < EventCount && !Reader.IsError(); ++Index)
+    {
+        uint32 FrameDelta = 0;
+        FNazareneInputReplayEvent Event;
+        Reader.SerializeIntPacked(FrameDelta);
+        Reader << Event.ActionIndex << Event.Value;
+        EventFrame += FrameDelta;
+        Event.Frame = EventFrame;
+        Events.Add(Event);
+    }
+
+    if (Reader.IsError())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Input capture is truncated: %s"), *FilePath);
+        return false;
+    }
+
+    CaptureFilePath = FilePath;
+    bHasReplaySeed = true;
+    return true;
+}
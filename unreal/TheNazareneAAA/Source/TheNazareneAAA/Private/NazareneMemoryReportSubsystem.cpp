@@ -0,0 +1,186 @@
+#include "NazareneMemoryReportSubsystem.h"
+
+#include "Engine/GameInstance.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/CommandLine.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "NazareneProfiling.h"
+#include "Stats/Stats.h"
+#include "TimerManager.h"
+
+DECLARE_STATS_GROUP(TEXT("Nazarene Memory"), STATGROUP_NazareneMemory, STATCAT_Advanced);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Region Memory Total (MB)"), STAT_NazareneRegionMemoryTotalMB, STATGROUP_NazareneMemory);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Memory Budgets Exceeded"), STAT_NazareneMemoryBudgetsExceeded, STATGROUP_NazareneMemory);
+
+namespace
+{
+    const TCHAR* BudgetSection = TEXT("NazareneMemoryBudgets");
+
+    struct FTrackedSystem
+    {
+        const TCHAR* Name;
+        /** Path of the LLM tag declared in NazareneMemoryTags.h. */
+        const TCHAR* LLMTag;
+    };
+
+    const FTrackedSystem TrackedSystems[] =
+    {
+        { TEXT("Regions"), TEXT("Nazarene/Regions") },
+        { TEXT("Enemies"), TEXT("Nazarene/Enemies") },
+        { TEXT("VFX"), TEXT("Nazarene/VFX") },
+        { TEXT("Music"), TEXT("Nazarene/Music") },
+        { TEXT("HUD"), TEXT("Nazarene/HUD") },
+        { TEXT("Save"), TEXT("Nazarene/Save") },
+    };
+
+    bool TryGetBudgetValue(const FString& Key, float& OutMegabytes)
+    {
+        const FString BudgetIniPath = FPaths::ProjectConfigDir() / TEXT("NazareneMemoryBudgets.ini");
+        return GConfig->GetFloat(BudgetSection, *Key, OutMegabytes, BudgetIniPath)
+            || GConfig->GetFloat(BudgetSection, *Key, OutMegabytes, GGameIni);
+    }
+
+    float BytesToMegabytes(uint64 Bytes)
+    {
+        return static_cast<float>(static_cast<double>(Bytes) / (1024.0 * 1024.0));
+    }
+}
+
+void UNazareneMemoryReportSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    bEnabled = !UE_BUILD_SHIPPING && !FParse::Param(FCommandLine::Get(), TEXT("NoNazareneMemoryReport"));
+    if (!bEnabled)
+    {
+        return;
+    }
+
+    ReportFilePath = NazareneProfiling::ResolveReportPath(TEXT("NazareneMemoryCsv="), TEXT("MemoryBudget"));
+}
+
+void UNazareneMemoryReportSubsystem::Deinitialize()
+{
+    if (UGameInstance* GameInstance = GetGameInstance())
+    {
+        GameInstance->GetTimerManager().ClearTimer(CaptureTimer);
+    }
+    Super::Deinitialize();
+}
+
+void UNazareneMemoryReportSubsystem::ScheduleRegionCapture(FName RegionId)
+{
+    UGameInstance* GameInstance = GetGameInstance();
+    if (!bEnabled || GameInstance == nullptr)
+    {
+        return;
+    }
+
+    PendingRegionId = RegionId;
+    GameInstance->GetTimerManager().SetTimer(
+        CaptureTimer,
+        FTimerDelegate::CreateUObject(this, &UNazareneMemoryReportSubsystem::CapturePendingRegion),
+        FMath::Max(0.1f, CaptureDelaySeconds),
+        false);
+}
+
+void UNazareneMemoryReportSubsystem::CapturePendingRegion()
+{
+    CaptureRegion(PendingRegionId);
+}
+
+int32 UNazareneMemoryReportSubsystem::CaptureRegion(FName RegionId)
+{
+    if (!bEnabled)
+    {
+        return 0;
+    }
+
+    const int32 Capture = ++CaptureCount;
+    const int32 FirstSample = Samples.Num();
+    const auto AddSample = [this, Capture, RegionId](FName System, float Megabytes)
+    {
+        FNazareneMemorySample& Sample = Samples.AddDefaulted_GetRef();
+        Sample.Capture = Capture;
+        Sample.RegionId = RegionId;
+        Sample.System = System;
+        Sample.Megabytes = Megabytes;
+        Sample.BudgetMegabytes = FindBudgetMegabytes(RegionId, System);
+    };
+
+    const float TotalMegabytes = BytesToMegabytes(FPlatformMemory::GetStats().UsedPhysical);
+    AddSample(FName(TEXT("Total")), TotalMegabytes);
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+    if (FLowLevelMemTracker::IsEnabled())
+    {
+        for (const FTrackedSystem& System : TrackedSystems)
+        {
+            const int64 Bytes = FLowLevelMemTracker::Get().GetTagAmountForTracker(ELLMTracker::Default, FName(System.LLMTag), ELLMTagSet::None);
+            AddSample(FName(System.Name), BytesToMegabytes(static_cast<uint64>(FMath::Max<int64>(0, Bytes))));
+        }
+    }
+#endif
+
+    FString Summary;
+    int32 OverBudget = 0;
+    for (int32 Index = FirstSample; Index < Samples.Num(); ++Index)
+    {
+        const FNazareneMemorySample& Sample = Samples[Index];
+        Summary += FString::Printf(TEXT(" %s=%.1f"), *Sample.System.ToString(), Sample.Megabytes);
+        if (Sample.IsOverBudget())
+        {
+            ++OverBudget;
+            UE_LOG(LogTemp, Warning, TEXT("Memory budget exceeded in %s: %s uses %.1f MB of %.1f MB"),
+                *RegionId.ToString(), *Sample.System.ToString(), Sample.Megabytes, Sample.BudgetMegabytes);
+        }
+    }
+    if (Samples.Num() - FirstSample == 1)
+    {
+        Summary += TEXT(" (run with -llm for the per-system breakdown)");
+    }
+    UE_LOG(LogTemp, Log, TEXT("MemoryReport: region=%s%s"), *RegionId.ToString(), *Summary);
+
+    SET_FLOAT_STAT(STAT_NazareneRegionMemoryTotalMB, TotalMegabytes);
+    SET_DWORD_STAT(STAT_NazareneMemoryBudgetsExceeded, OverBudget);
+
+    WriteReport();
+    return OverBudget;
+}
+
+float UNazareneMemoryReportSubsystem::FindBudgetMegabytes(FName RegionId, FName System) const
+{
+    float Megabytes = 0.0f;
+    if (!RegionId.IsNone() && TryGetBudgetValue(FString::Printf(TEXT("%s.%s"), *RegionId.ToString(), *System.ToString()), Megabytes))
+    {
+        return Megabytes;
+    }
+    return TryGetBudgetValue(System.ToString(), Megabytes) ? Megabytes : 0.0f;
+}
+
+bool UNazareneMemoryReportSubsystem::WriteReport() const
+{
+    if (ReportFilePath.IsEmpty())
+    {
+        return false;
+    }
+
+    FString Csv = FString(TEXT("Capture,Region,System,MB,BudgetMB,Over")) + LINE_TERMINATOR;
+    for (const FNazareneMemorySample& Sample : Samples)
+    {
+        Csv += FString::Printf(TEXT("%d,%s,%s,%.2f,%.2f,%d"), Sample.Capture, *Sample.RegionId.ToString(), *Sample.System.ToString(),
+            Sample.Megabytes, Sample.BudgetMegabytes, Sample.IsOverBudget() ? 1 : 0);
+        Csv += LINE_TERMINATOR;
+    }
+
+    if (!FFileHelper::SaveStringToFile(Csv, *ReportFilePath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to write memory budget report: %s"), *ReportFilePath);
+        return false;
+    }
+    return true;
+}
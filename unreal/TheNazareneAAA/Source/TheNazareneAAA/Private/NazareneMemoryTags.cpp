@@ -0,0 +1,9 @@
+#include "NazareneMemoryTags.h"
+
+LLM_DEFINE_TAG(Nazarene);
+LLM_DEFINE_TAG(Nazarene_Regions);
+LLM_DEFINE_TAG(Nazarene_Enemies);
+LLM_DEFINE_TAG(Nazarene_VFX);
+LLM_DEFINE_TAG(Nazarene_Music);
+LLM_DEFINE_TAG(Nazarene_HUD);
+LLM_DEFINE_TAG(Nazarene_Save);
@@ -0,0 +1,238 @@
+#include "NazareneMusicSubsystem.h"
+
+#include "Components/AudioComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/PackageName.h"
+#include "NazareneMemoryTags.h"
+#include "Sound/SoundBase.h"
+
+namespace
+{
+    const TCHAR* const LayerSuffixes[] = { TEXT(""), TEXT("_Tension"), TEXT("_Combat"), TEXT("_Boss"), TEXT("_Victory") };
+}
+
+void UNazareneMusicSubsystem::Deinitialize()
+{
+    for (UAudioComponent* Stem : ActiveStems)
+    {
+        if (Stem != nullptr)
+        {
+            Stem->Stop();
+        }
+    }
+    ActiveStems.Reset();
+    ActiveStemLayers.Reset();
+
+    if (PendingHandle.IsValid())
+    {
+        PendingHandle->CancelHandle();
+    }
+    PendingHandle.Reset();
+    ActiveHandle.Reset();
+    PreloadHandle.Reset();
+
+    Super::Deinitialize();
+}
+
+TArray<FSoftObjectPath> UNazareneMusicSubsystem::BuildStemPaths(const TSoftObjectPtr<USoundBase>& BaseTrack)
+{
+    TArray<FSoftObjectPath> StemPaths;
+    StemPaths.SetNum(static_cast<int32>(EMusicLayer::Count));
+
+    const FSoftObjectPath BasePath = BaseTrack.ToSoftObjectPath();
+    if (!BasePath.IsValid())
+    {
+        return StemPaths;
+    }
+
+    // Layer stems sit beside the base track: /Game/Audio/Music/S_Music_Galilee_Combat.S_Music_Galilee_Combat
+    const FString BasePackage = BasePath.GetLongPackageName();
+    const FString BaseAsset = BasePath.GetAssetName();
+    for (int32 Layer = 0; Layer < StemPaths.Num(); ++Layer)
+    {
+        const FString PackageName = BasePackage + LayerSuffixes[Layer];
+        if (FPackageName::DoesPackageExist(PackageName))
+        {
+            StemPaths[Layer] = FSoftObjectPath(FString::Printf(TEXT("%s.%s%s"), *PackageName, *BaseAsset, LayerSuffixes[Layer]));
+        }
+    }
+    return StemPaths;
+}
+
+float UNazareneMusicSubsystem::LayerVolume(EMusicLayer Layer, ENazareneMusicState State, bool bLayered)
+{
+    switch (Layer)
+    {
+    case EMusicLayer::Base:
+        // The base only ducks to make room for layer stems; a base-only region plays at full volume in every state.
+        if (!bLayered)
+        {
+            return 1.0f;
+        }
+        return State == ENazareneMusicState::Boss ? 0.6f : (State == ENazareneMusicState::Combat ? 0.75f : 1.0f);
+    case EMusicLayer::Tension:
+        return State == ENazareneMusicState::Tension ? 1.0f : (State == ENazareneMusicState::Combat || State == ENazareneMusicState::Boss ? 0.5f : 0.0f);
+    case EMusicLayer::Combat:
+        return State == ENazareneMusicState::Combat ? 1.0f : (State == ENazareneMusicState::Boss ? 0.7f : 0.0f);
+    case EMusicLayer::Boss:
+        return State == ENazareneMusicState::Boss ? 1.0f : 0.0f;
+    case EMusicLayer::Victory:
+        return State == ENazareneMusicState::Victory ? 1.0f : 0.0f;
+    default:
+        return 0.0f;
+    }
+}
+
+TSharedPtr<FStreamableHandle> UNazareneMusicSubsystem::RequestStems(const TArray<FSoftObjectPath>& StemPaths, TFunction<void()> OnLoaded) const
+{
+    TArray<FSoftObjectPath> ToLoad;
+    for (const FSoftObjectPath& StemPath : StemPaths)
+    {
+        if (StemPath.IsValid())
+        {
+            ToLoad.Add(StemPath);
+        }
+    }
+    if (ToLoad.Num() == 0)
+    {
+        return nullptr;
+    }
+
+    return UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        ToLoad,
+        FStreamableDelegate::CreateLambda(MoveTemp(OnLoaded)),
+        FStreamableManager::AsyncLoadHighPriority);
+}
+
+void UNazareneMusicSubsystem::PlayRegion(const TSoftObjectPtr<USoundBase>& BaseTrack)
+{
+    LLM_SCOPE_BYTAG(Nazarene_Music);
+    const FSoftObjectPath BasePath = BaseTrack.ToSoftObjectPath();
+    if (BasePath == ActiveBaseTrack && ActiveStems.Num() > 0)
+    {
+        // Returning to the playing region still supersedes a load started for another one.
+        ++PlayRequestId;
+        PendingHandle.Reset();
+        return;
+    }
+
+    const uint32 RequestId = ++PlayRequestId;
+    TArray<FSoftObjectPath> StemPaths = BuildStemPaths(BaseTrack);
+    if (!StemPaths[static_cast<int32>(EMusicLayer::Base)].IsValid())
+    {
+        FadeOutActiveStems();
+        ActiveBaseTrack.Reset();
+        PendingHandle.Reset();
+        return;
+    }
+
+    TWeakObjectPtr<UNazareneMusicSubsystem> WeakThis(this);
+    PendingHandle = RequestStems(StemPaths, [WeakThis, RequestId, StemPaths]()
+    {
+        if (UNazareneMusicSubsystem* Music = WeakThis.Get())
+        {
+            Music->StartStems(RequestId, StemPaths);
+        }
+    });
+
+    // A matching preload has already streamed these stems, so the request above completes at once.
+    if (BasePath == PreloadBaseTrack)
+    {
+        PreloadHandle.Reset();
+        PreloadBaseTrack.Reset();
+    }
+}
+
+void UNazareneMusicSubsystem::PreloadRegion(const TSoftObjectPtr<USoundBase>& BaseTrack)
+{
+    LLM_SCOPE_BYTAG(Nazarene_Music);
+    const FSoftObjectPath BasePath = BaseTrack.ToSoftObjectPath();
+    if (BasePath == PreloadBaseTrack || BasePath == ActiveBaseTrack)
+    {
+        return;
+    }
+
+    if (PreloadHandle.IsValid())
+    {
+        PreloadHandle->ReleaseHandle();
+    }
+    PreloadBaseTrack = BasePath;
+    PreloadHandle = RequestStems(BuildStemPaths(BaseTrack), []() {});
+}
+
+void UNazareneMusicSubsystem::StartStems(uint32 RequestId, TArray<FSoftObjectPath> StemPaths)
+{
+    LLM_SCOPE_BYTAG(Nazarene_Music);
+    // A newer region request superseded this one while it streamed.
+    if (RequestId != PlayRequestId)
+    {
+        return;
+    }
+
+    FadeOutActiveStems();
+
+    // Stems are authored PlayWhenSilent (create_audio_pack.py) so muted layers keep their place instead of restarting.
+    bActiveStemsLayered = false;
+    for (int32 Layer = static_cast<int32>(EMusicLayer::Base) + 1; Layer < StemPaths.Num(); ++Layer)
+    {
+        bActiveStemsLayered |= StemPaths[Layer].ResolveObject() != nullptr;
+    }
+
+    // Every stem starts in the same frame so the layers stay aligned; volume alone selects the mix.
+    for (int32 Layer = 0; Layer < StemPaths.Num(); ++Layer)
+    {
+        USoundBase* Sound = Cast<USoundBase>(StemPaths[Layer].ResolveObject());
+        if (Sound == nullptr)
+        {
+            continue;
+        }
+
+        UAudioComponent* Stem = UGameplayStatics::CreateSound2D(this, Sound, MusicVolume, 1.0f, 0.0f, nullptr, false, true);
+        if (Stem == nullptr)
+        {
+            continue;
+        }
+
+        const EMusicLayer MusicLayer = static_cast<EMusicLayer>(Layer);
+        Stem->FadeIn(RegionCrossfadeSeconds, LayerVolume(MusicLayer, MusicState, bActiveStemsLayered));
+        ActiveStems.Add(Stem);
+        ActiveStemLayers.Add(MusicLayer);
+    }
+
+    ActiveBaseTrack = StemPaths[static_cast<int32>(EMusicLayer::Base)];
+    ActiveHandle = MoveTemp(PendingHandle);
+}
+
+void UNazareneMusicSubsystem::FadeOutActiveStems()
+{
+    for (UAudioComponent* Stem : ActiveStems)
+    {
+        if (Stem != nullptr)
+        {
+            // Auto-destroying components clean themselves up when the fade completes.
+            Stem->FadeOut(RegionCrossfadeSeconds, 0.0f);
+        }
+    }
+    ActiveStems.Reset();
+    ActiveStemLayers.Reset();
+    bActiveStemsLayered = false;
+}
+
+void UNazareneMusicSubsystem::SetMusicState(ENazareneMusicState NewState)
+{
+    if (MusicState == NewState)
+    {
+        return;
+    }
+
+    MusicState = NewState;
+    for (int32 Index = 0; Index < ActiveStems.Num(); ++Index)
+    {
+        if (UAudioComponent* Stem = ActiveStems[Index])
+        {
+            Stem->AdjustVolume(LayerFadeSeconds, LayerVolume(ActiveStemLayers[Index], MusicState, bActiveStemsLayered));
+        }
+    }
+}
@@ -1,11 +1,13 @@
 #include "NazareneNPC.h"
 
+#include "Components/AudioComponent.h"
 #include "Components/SphereComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Engine/StaticMesh.h"
 #include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
 #include "Materials/MaterialInstanceDynamic.h"
+#include "NazareneDialogueVoiceSubsystem.h"
 #include "NazareneHUD.h"
 #include "NazarenePlayerCharacter.h"
 
@@ -90,6 +92,21 @@ void ANazareneNPC::BeginPlay()
 	}
 }
 
+void ANazareneNPC::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UNazareneDialogueVoiceSubsystem* Voice = GetWorld() != nullptr ? GetWorld()->GetSubsystem<UNazareneDialogueVoiceSubsystem>() : nullptr)
+	{
+		Voice->ReleaseVoiceSet(this);
+	}
+	if (UAudioComponent* Playing = ActiveVoice.Get())
+	{
+		Playing->Stop();
+	}
+	ActiveVoice.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ANazareneNPC::HandleOverlapBegin(UPrimitiveComponent* /*OverlappedComponent*/, AActor* OtherActor, UPrimitiveComponent* /*OtherComp*/, int32 /*OtherBodyIndex*/, bool /*bFromSweep*/, const FHitResult& /*SweepResult*/)
 {
 	ANazarenePlayerCharacter* Player = Cast<ANazarenePlayerCharacter>(OtherActor);
@@ -102,6 +119,17 @@ void ANazareneNPC::HandleOverlapBegin(UPrimitiveComponent* /*OverlappedComponent
 	CachedPlayer = Player;
 	Player->SetActiveNPC(this);
 
+	// Voice lines stream while the player closes the last few steps; most are resident before the first E press.
+	if (UNazareneDialogueVoiceSubsystem* Voice = GetWorld()->GetSubsystem<UNazareneDialogueVoiceSubsystem>())
+	{
+		TArray<TSoftObjectPtr<USoundBase>> Clips;
+		for (const FNazareneNPCDialogueLine& Line : DialogueLines)
+		{
+			Clips.Add(Line.VoiceClip);
+		}
+		Voice->AcquireVoiceSet(this, Clips);
+	}
+
 	const FString Greeting = IdleGreeting.IsEmpty() ? FString::Printf(TEXT("Press E to speak with %s"), *NPCName) : IdleGreeting;
 	Player->SetContextHint(Greeting);
 }
@@ -117,6 +145,11 @@ void ANazareneNPC::HandleOverlapEnd(UPrimitiveComponent* /*OverlappedComponent*/
 	bPlayerInRange = false;
 	Player->ClearActiveNPC(this);
 	Player->SetContextHint(TEXT(""));
+
+	if (UNazareneDialogueVoiceSubsystem* Voice = GetWorld()->GetSubsystem<UNazareneDialogueVoiceSubsystem>())
+	{
+		Voice->ReleaseVoiceSet(this);
+	}
 }
 
 void ANazareneNPC::AdvanceDialogue()
@@ -149,14 +182,37 @@ void ANazareneNPC::AdvanceDialogue()
 		}
 	}
 
-	if (Line.VoiceClip != nullptr)
+	if (UNazareneDialogueVoiceSubsystem* Voice = Line.VoiceClip.IsNull() ? nullptr : GetWorld()->GetSubsystem<UNazareneDialogueVoiceSubsystem>())
 	{
-		UGameplayStatics::PlaySoundAtLocation(this, Line.VoiceClip, GetActorLocation(), 1.0f);
+		const int32 LineIndex = CurrentDialogueIndex;
+		TWeakObjectPtr<ANazareneNPC> WeakThis(this);
+		Voice->WhenVoiceLoaded(Line.VoiceClip, [WeakThis, LineIndex](USoundBase* VoiceClip)
+		{
+			if (ANazareneNPC* NPC = WeakThis.Get())
+			{
+				NPC->PlayVoiceLine(LineIndex, VoiceClip);
+			}
+		});
 	}
 
 	++CurrentDialogueIndex;
 }
 
+void ANazareneNPC::PlayVoiceLine(int32 LineIndex, USoundBase* VoiceClip)
+{
+	// A line that finished streaming after the player skipped past it stays silent.
+	if (VoiceClip == nullptr || LineIndex != CurrentDialogueIndex - 1)
+	{
+		return;
+	}
+
+	if (UAudioComponent* Previous = ActiveVoice.Get())
+	{
+		Previous->Stop();
+	}
+	ActiveVoice = UGameplayStatics::SpawnSoundAtLocation(this, VoiceClip, GetActorLocation(), FRotator::ZeroRotator, 1.0f);
+}
+
 void ANazareneNPC::ResetDialogue()
 {
 	CurrentDialogueIndex = 0;
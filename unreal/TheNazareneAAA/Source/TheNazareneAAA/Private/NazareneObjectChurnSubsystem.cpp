@@ -0,0 +1,384 @@
+#include "NazareneObjectChurnSubsystem.h"
+
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "NazareneProfiling.h"
+#include "Stats/Stats.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectIterator.h"
+
+#include <atomic>
+
+DECLARE_STATS_GROUP(TEXT("Nazarene GC"), STATGROUP_NazareneGC, STATCAT_Advanced);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("UObjects Created / s"), STAT_NazareneObjectsCreatedPerSec, STATGROUP_NazareneGC);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("UObjects Destroyed / s"), STAT_NazareneObjectsDestroyedPerSec, STATGROUP_NazareneGC);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Churning Classes"), STAT_NazareneChurningClasses, STATGROUP_NazareneGC);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("GC Pause (ms)"), STAT_NazareneGCPauseMs, STATGROUP_NazareneGC);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("GC Reachability (ms)"), STAT_NazareneGCReachabilityMs, STATGROUP_NazareneGC);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("GC Count"), STAT_NazareneGCCount, STATGROUP_NazareneGC);
+
+/**
+ * UObject array listener counting constructions and destructions per class. Objects are created on the
+ * async loading thread as well as the game thread, so the window is guarded by a lock. Classes are keyed
+ * by pointer and named when first seen alive; a dying object's class may already be purged in the same GC.
+ */
+class FNazareneObjectChurnCounter final : public FUObjectArray::FUObjectCreateListener, public FUObjectArray::FUObjectDeleteListener
+{
+public:
+    struct FWindowCounts
+    {
+        uint32 Created = 0;
+        uint32 Destroyed = 0;
+    };
+
+    FNazareneObjectChurnCounter()
+    {
+        for (TObjectIterator<UClass> It; It; ++It)
+        {
+            ClassNames.Add(*It, It->GetFName());
+        }
+        GUObjectArray.AddUObjectCreateListener(this);
+        GUObjectArray.AddUObjectDeleteListener(this);
+        bAttached = true;
+    }
+
+    virtual ~FNazareneObjectChurnCounter() override
+    {
+        Detach();
+    }
+
+    virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override
+    {
+        const UClass* Class = Object != nullptr ? Object->GetClass() : nullptr;
+        if (Class == nullptr)
+        {
+            return;
+        }
+
+        FScopeLock Lock(&Mutex);
+        ++Window.FindOrAdd(Class).Created;
+        if (!ClassNames.Contains(Class))
+        {
+            ClassNames.Add(Class, Class->GetFName());
+        }
+    }
+
+    virtual void NotifyUObjectDeleted(const UObjectBase* Object, int32 Index) override
+    {
+        const UClass* Class = Object != nullptr ? Object->GetClass() : nullptr;
+        if (Class == nullptr)
+        {
+            return;
+        }
+
+        FScopeLock Lock(&Mutex);
+        ++Window.FindOrAdd(Class).Destroyed;
+        TotalDestroyed.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    virtual void OnUObjectArrayShutdown() override
+    {
+        Detach();
+    }
+
+    void TakeWindow(TMap<const UClass*, FWindowCounts>& OutWindow)
+    {
+        FScopeLock Lock(&Mutex);
+        OutWindow = MoveTemp(Window);
+        Window.Reset();
+    }
+
+    FName FindClassName(const UClass* Class)
+    {
+        FScopeLock Lock(&Mutex);
+        const FName* Name = ClassNames.Find(Class);
+        return Name != nullptr ? *Name : FName(TEXT("Unknown"));
+    }
+
+    uint64 GetTotalDestroyed() const
+    {
+        return TotalDestroyed.load(std::memory_order_relaxed);
+    }
+
+private:
+    void Detach()
+    {
+        if (bAttached)
+        {
+            GUObjectArray.RemoveUObjectCreateListener(this);
+            GUObjectArray.RemoveUObjectDeleteListener(this);
+            bAttached = false;
+        }
+    }
+
+    FCriticalSection Mutex;
+    TMap<const UClass*, FWindowCounts> Window;
+    TMap<const UClass*, FName> ClassNames;
+    std::atomic<uint64> TotalDestroyed{0};
+    bool bAttached = false;
+};
+
+namespace
+{
+    void HandleObjectChurnCommand(const TArray<FString>& Args, UWorld* World)
+    {
+        const UGameInstance* GameInstance = World != nullptr ? World->GetGameInstance() : nullptr;
+        UNazareneObjectChurnSubsystem* Churn = GameInstance != nullptr ? GameInstance->GetSubsystem<UNazareneObjectChurnSubsystem>() : nullptr;
+        if (Churn == nullptr)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Nazarene.ObjectChurn: no game instance in this world."));
+            return;
+        }
+
+        const FString Verb = Args.Num() > 0 ? Args[0] : TEXT("dump");
+        if (Verb.Equals(TEXT("start"), ESearchCase::IgnoreCase))
+        {
+            Churn->StartTracking();
+        }
+        else if (Verb.Equals(TEXT("stop"), ESearchCase::IgnoreCase))
+        {
+            Churn->StopTracking();
+        }
+        else if (Verb.Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+        {
+            Churn->ResetCounts();
+        }
+        else
+        {
+            Churn->DumpSummary(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 15);
+        }
+    }
+
+    FAutoConsoleCommandWithWorldAndArgs ObjectChurnCommand(
+        TEXT("Nazarene.ObjectChurn"),
+        TEXT("UObject churn and GC tracker. start | stop | reset | dump [classes]. Stop writes the CSVs under Saved/Profiling."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&HandleObjectChurnCommand));
+}
+
+UNazareneObjectChurnSubsystem::UNazareneObjectChurnSubsystem() = default;
+UNazareneObjectChurnSubsystem::~UNazareneObjectChurnSubsystem() = default;
+
+void UNazareneObjectChurnSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    ReportFilePath = NazareneProfiling::ResolveReportPath(TEXT("NazareneObjectChurnCsv="), TEXT("ObjectChurn"));
+
+    if (!UE_BUILD_SHIPPING && !IsTemplate() && FParse::Param(FCommandLine::Get(), TEXT("NazareneObjectChurn")))
+    {
+        StartTracking();
+    }
+}
+
+void UNazareneObjectChurnSubsystem::Deinitialize()
+{
+    StopTracking();
+    Super::Deinitialize();
+}
+
+void UNazareneObjectChurnSubsystem::StartTracking()
+{
+    if (IsTracking())
+    {
+        return;
+    }
+
+    Counter = MakeUnique<FNazareneObjectChurnCounter>();
+    TrackingStartSeconds = FPlatformTime::Seconds();
+    WindowStartSeconds = TrackingStartSeconds;
+    GCStartSeconds = 0.0;
+
+    EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UNazareneObjectChurnSubsystem::HandleEndFrame);
+    PreGCHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddUObject(this, &UNazareneObjectChurnSubsystem::HandlePreGarbageCollect);
+    PostReachabilityHandle = FCoreUObjectDelegates::PostReachabilityAnalysis.AddUObject(this, &UNazareneObjectChurnSubsystem::HandlePostReachabilityAnalysis);
+    PostGCHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UNazareneObjectChurnSubsystem::HandlePostGarbageCollect);
+
+    UE_LOG(LogTemp, Log, TEXT("Object churn tracking started."));
+}
+
+void UNazareneObjectChurnSubsystem::StopTracking()
+{
+    if (!IsTracking())
+    {
+        return;
+    }
+
+    FlushWindow(FPlatformTime::Seconds());
+
+    FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+    FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGCHandle);
+    FCoreUObjectDelegates::PostReachabilityAnalysis.Remove(PostReachabilityHandle);
+    FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGCHandle);
+    EndFrameHandle.Reset();
+    PreGCHandle.Reset();
+    PostReachabilityHandle.Reset();
+    PostGCHandle.Reset();
+
+    DumpSummary();
+    WriteReport();
+    Counter.Reset();
+}
+
+void UNazareneObjectChurnSubsystem::ResetCounts()
+{
+    if (IsTracking())
+    {
+        TMap<const UClass*, FNazareneObjectChurnCounter::FWindowCounts> Discarded;
+        Counter->TakeWindow(Discarded);
+    }
+
+    ChurnCsv.Reset();
+    GCSamples.Reset();
+    Totals.Reset();
+    TrackingStartSeconds = FPlatformTime::Seconds();
+    WindowStartSeconds = TrackingStartSeconds;
+}
+
+void UNazareneObjectChurnSubsystem::HandleEndFrame()
+{
+    const double Now = FPlatformTime::Seconds();
+    if (Now - WindowStartSeconds >= FMath::Max(0.1f, SampleIntervalSeconds))
+    {
+        FlushWindow(Now);
+    }
+}
+
+void UNazareneObjectChurnSubsystem::FlushWindow(double Now)
+{
+    TMap<const UClass*, FNazareneObjectChurnCounter::FWindowCounts> Window;
+    Counter->TakeWindow(Window);
+
+    const double TimeSeconds = Now - TrackingStartSeconds;
+    uint32 Created = 0;
+    uint32 Destroyed = 0;
+    for (const TPair<const UClass*, FNazareneObjectChurnCounter::FWindowCounts>& Entry : Window)
+    {
+        FNazareneClassChurn& Total = Totals.FindOrAdd(Entry.Key);
+        if (Total.ClassName.IsNone())
+        {
+            Total.ClassName = Counter->FindClassName(Entry.Key);
+        }
+        Total.Created += Entry.Value.Created;
+        Total.Destroyed += Entry.Value.Destroyed;
+        Created += Entry.Value.Created;
+        Destroyed += Entry.Value.Destroyed;
+
+        ChurnCsv += FString::Printf(TEXT("%.2f,%s,%u,%u"), TimeSeconds, *Total.ClassName.ToString(), Entry.Value.Created, Entry.Value.Destroyed);
+        ChurnCsv += LINE_TERMINATOR;
+    }
+
+    const double Elapsed = FMath::Max(Now - WindowStartSeconds, 0.001);
+    SET_FLOAT_STAT(STAT_NazareneObjectsCreatedPerSec, static_cast<float>(Created / Elapsed));
+    SET_FLOAT_STAT(STAT_NazareneObjectsDestroyedPerSec, static_cast<float>(Destroyed / Elapsed));
+    SET_DWORD_STAT(STAT_NazareneChurningClasses, Window.Num());
+    WindowStartSeconds = Now;
+}
+
+void UNazareneObjectChurnSubsystem::HandlePreGarbageCollect()
+{
+    GCStartSeconds = FPlatformTime::Seconds();
+    ReachabilityEndSeconds = 0.0;
+    DestroyedAtGCStart = Counter->GetTotalDestroyed();
+}
+
+void UNazareneObjectChurnSubsystem::HandlePostReachabilityAnalysis()
+{
+    ReachabilityEndSeconds = FPlatformTime::Seconds();
+}
+
+void UNazareneObjectChurnSubsystem::HandlePostGarbageCollect()
+{
+    if (GCStartSeconds <= 0.0)
+    {
+        return;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    FNazareneGCSample& Sample = GCSamples.AddDefaulted_GetRef();
+    Sample.TimeSeconds = GCStartSeconds - TrackingStartSeconds;
+    Sample.PauseMs = static_cast<float>((Now - GCStartSeconds) * 1000.0);
+    Sample.ReachabilityMs = ReachabilityEndSeconds > 0.0 ? static_cast<float>((ReachabilityEndSeconds - GCStartSeconds) * 1000.0) : 0.0f;
+    Sample.PurgedInPause = static_cast<int32>(Counter->GetTotalDestroyed() - DestroyedAtGCStart);
+    GCStartSeconds = 0.0;
+
+    SET_FLOAT_STAT(STAT_NazareneGCPauseMs, Sample.PauseMs);
+    SET_FLOAT_STAT(STAT_NazareneGCReachabilityMs, Sample.ReachabilityMs);
+    INC_DWORD_STAT(STAT_NazareneGCCount);
+}
+
+TArray<FNazareneClassChurn> UNazareneObjectChurnSubsystem::GetClassChurn() const
+{
+    TArray<FNazareneClassChurn> Result;
+    Totals.GenerateValueArray(Result);
+    Result.Sort([](const FNazareneClassChurn& A, const FNazareneClassChurn& B)
+    {
+        return A.Created + A.Destroyed > B.Created + B.Destroyed;
+    });
+    return Result;
+}
+
+void UNazareneObjectChurnSubsystem::DumpSummary(int32 MaxClasses) const
+{
+    const double Seconds = FMath::Max(FPlatformTime::Seconds() - TrackingStartSeconds, 0.001);
+    const TArray<FNazareneClassChurn> Churn = GetClassChurn();
+    UE_LOG(LogTemp, Log, TEXT("Object churn over %.1f s (%s), %d classes:"), Seconds, IsTracking() ? TEXT("tracking") : TEXT("stopped"), Churn.Num());
+    for (int32 Index = 0; Index < FMath::Min(Churn.Num(), FMath::Max(1, MaxClasses)); ++Index)
+    {
+        const FNazareneClassChurn& Entry = Churn[Index];
+        UE_LOG(LogTemp, Log, TEXT("  %-48s created %8llu (%7.1f/s)  destroyed %8llu (%7.1f/s)"),
+            *Entry.ClassName.ToString(), Entry.Created, Entry.Created / Seconds, Entry.Destroyed, Entry.Destroyed / Seconds);
+    }
+
+    if (GCSamples.Num() == 0)
+    {
+        return;
+    }
+
+    float PauseSumMs = 0.0f;
+    float PauseMaxMs = 0.0f;
+    float ReachabilitySumMs = 0.0f;
+    for (const FNazareneGCSample& Sample : GCSamples)
+    {
+        PauseSumMs += Sample.PauseMs;
+        PauseMaxMs = FMath::Max(PauseMaxMs, Sample.PauseMs);
+        ReachabilitySumMs += Sample.ReachabilityMs;
+    }
+    UE_LOG(LogTemp, Log, TEXT("GC: %d collections, pause mean %.2f ms max %.2f ms, reachability mean %.2f ms"),
+        GCSamples.Num(), PauseSumMs / GCSamples.Num(), PauseMaxMs, ReachabilitySumMs / GCSamples.Num());
+}
+
+bool UNazareneObjectChurnSubsystem::WriteReport() const
+{
+    if (ReportFilePath.IsEmpty())
+    {
+        return false;
+    }
+
+    const FString Churn = FString(TEXT("TimeSec,Class,Created,Destroyed")) + LINE_TERMINATOR + ChurnCsv;
+    FString GC = FString(TEXT("TimeSec,PauseMs,ReachabilityMs,PurgedInPause")) + LINE_TERMINATOR;
+    for (const FNazareneGCSample& Sample : GCSamples)
+    {
+        GC += FString::Printf(TEXT("%.2f,%.3f,%.3f,%d"), Sample.TimeSeconds, Sample.PauseMs, Sample.ReachabilityMs, Sample.PurgedInPause);
+        GC += LINE_TERMINATOR;
+    }
+
+    const FString GCFilePath = FPaths::GetBaseFilename(ReportFilePath, false) + TEXT("_GC.csv");
+    if (!FFileHelper::SaveStringToFile(Churn, *ReportFilePath) || !FFileHelper::SaveStringToFile(GC, *GCFilePath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to write object churn report: %s"), *ReportFilePath);
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Object churn report saved: %s"), *ReportFilePath);
+    return true;
+}
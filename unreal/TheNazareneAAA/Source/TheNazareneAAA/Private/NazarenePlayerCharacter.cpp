@@ -6,8 +6,11 @@
 #include "Components/StaticMeshComponent.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
+#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
 #include "Engine/LocalPlayer.h"
 #include "Engine/SkeletalMesh.h"
+#include "Engine/StreamableManager.h"
 #include "EngineUtils.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/PlayerController.h"
@@ -19,28 +22,61 @@
 #include "InputModifiers.h"
 #include "Kismet/GameplayStatics.h"
 #include "Materials/MaterialInterface.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
 #include "NiagaraFunctionLibrary.h"
 #include "NiagaraSystem.h"
 #include "NazareneAbilitySystemComponent.h"
 #include "NazareneAssetResolver.h"
 #include "NazareneAttributeSet.h"
 #include "NazareneCampaignGameMode.h"
+#include "NazareneCombatAudioSubsystem.h"
+#include "NazareneCombatEventSubsystem.h"
 #include "NazareneEnemyCharacter.h"
 #include "NazareneHUD.h"
+#include "NazareneInputLatencySubsystem.h"
 #include "NazareneNPC.h"
 #include "NazarenePlayerAnimInstance.h"
+#include "NazarenePlayerInputSubsystem.h"
 #include "NazarenePrayerSite.h"
 #include "NazareneSkillTree.h"
 #include "NazareneSettingsSubsystem.h"
+#include "NazareneStats.h"
 #include "NazareneTravelGate.h"
+#include "NazareneWeaponTraceComponent.h"
 #include "GA_NazareneHeal.h"
 #include "GA_NazareneBlessing.h"
 #include "GA_NazareneRadiance.h"
+#include "HAL/PlatformTime.h"
 #include "Sound/SoundBase.h"
 #include "UObject/ConstructorHelpers.h"
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Buffered Inputs Replayed"), STAT_NazareneBufferedInputsReplayed, STATGROUP_NazareneCombat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Buffered Inputs Expired"), STAT_NazareneBufferedInputsExpired, STATGROUP_NazareneCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Player BeginPlay (ms)"), STAT_NazarenePlayerBeginPlayMs, STATGROUP_NazareneCombat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Player Presentation Ready (ms)"), STAT_NazarenePlayerPresentationReadyMs, STATGROUP_NazareneCombat);
+
 namespace
 {
+    const TCHAR* PlayerRobeMaterialPath = TEXT("/Game/Art/Materials/MI_Character_JesusRobe.MI_Character_JesusRobe");
+
+    static ENazareneLatencyProbe LatencyProbeFor(ENazareneCombatInput Input)
+    {
+        switch (Input)
+        {
+        case ENazareneCombatInput::LightAttack:
+            return ENazareneLatencyProbe::LightAttack;
+        case ENazareneCombatInput::HeavyAttack:
+            return ENazareneLatencyProbe::HeavyAttack;
+        case ENazareneCombatInput::Dodge:
+            return ENazareneLatencyProbe::Dodge;
+        case ENazareneCombatInput::Parry:
+            return ENazareneLatencyProbe::Parry;
+        default:
+            return ENazareneLatencyProbe::Miracle;
+        }
+    }
+
     static bool ContainsModernWeaponTerm(const FString& InPath)
     {
         const FString Lower = InPath.ToLower();
@@ -71,6 +107,24 @@ namespace
         }
     }
 
+    static UInputAction* FindMappedAction(const UInputMappingContext* MappingContext, const TCHAR* Token)
+    {
+        if (MappingContext == nullptr)
+        {
+            return nullptr;
+        }
+
+        for (const FEnhancedActionKeyMapping& Mapping : MappingContext->GetMappings())
+        {
+            const UInputAction* Action = Mapping.Action.Get();
+            if (Action != nullptr && Action->GetName().Contains(Token))
+            {
+                return const_cast<UInputAction*>(Action);
+            }
+        }
+        return nullptr;
+    }
+
     static UInputAction* MakeInputAction(UObject* Owner, const TCHAR* Name, EInputActionValueType ValueType)
     {
         UInputAction* Action = NewObject<UInputAction>(Owner, Name);
@@ -88,6 +142,7 @@ ANazarenePlayerCharacter::ANazarenePlayerCharacter()
 
     AbilitySystemComponent = CreateDefaultSubobject<UNazareneAbilitySystemComponent>(TEXT("AbilitySystemComponent"));
     AttributeSet = CreateDefaultSubobject<UNazareneAttributeSet>(TEXT("AttributeSet"));
+    WeaponTrace = CreateDefaultSubobject<UNazareneWeaponTraceComponent>(TEXT("WeaponTrace"));
 
     GetCapsuleComponent()->SetCapsuleHalfHeight(96.0f);
     GetCapsuleComponent()->SetCapsuleRadius(36.0f);
@@ -206,25 +261,26 @@ ANazarenePlayerCharacter::ANazarenePlayerCharacter()
         }
     }
 
-    if (LightAttackSound == nullptr)
+    // Soft references only; the sounds stream with the rest of the presentation bundle in BeginPlay.
+    if (LightAttackSound.IsNull())
     {
-        LightAttackSound = LoadObject<USoundBase>(nullptr, TEXT("/Game/Audio/SFX/S_AttackWhoosh.S_AttackWhoosh"));
+        LightAttackSound = TSoftObjectPtr<USoundBase>(FSoftObjectPath(TEXT("/Game/Audio/SFX/S_AttackWhoosh.S_AttackWhoosh")));
     }
-    if (HeavyAttackSound == nullptr)
+    if (HeavyAttackSound.IsNull())
     {
-        HeavyAttackSound = LoadObject<USoundBase>(nullptr, TEXT("/Game/Audio/SFX/S_Impact.S_Impact"));
+        HeavyAttackSound = TSoftObjectPtr<USoundBase>(FSoftObjectPath(TEXT("/Game/Audio/SFX/S_Impact.S_Impact")));
     }
-    if (DodgeSound == nullptr)
+    if (DodgeSound.IsNull())
     {
-        DodgeSound = LoadObject<USoundBase>(nullptr, TEXT("/Game/Audio/SFX/S_Dodge.S_Dodge"));
+        DodgeSound = TSoftObjectPtr<USoundBase>(FSoftObjectPath(TEXT("/Game/Audio/SFX/S_Dodge.S_Dodge")));
     }
-    if (MiracleSound == nullptr)
+    if (MiracleSound.IsNull())
     {
-        MiracleSound = LoadObject<USoundBase>(nullptr, TEXT("/Game/Audio/SFX/S_MiracleShimmer.S_MiracleShimmer"));
+        MiracleSound = TSoftObjectPtr<USoundBase>(FSoftObjectPath(TEXT("/Game/Audio/SFX/S_MiracleShimmer.S_MiracleShimmer")));
     }
-    if (HurtSound == nullptr)
+    if (HurtSound.IsNull())
     {
-        HurtSound = LoadObject<USoundBase>(nullptr, TEXT("/Game/Audio/SFX/S_Hurt.S_Hurt"));
+        HurtSound = TSoftObjectPtr<USoundBase>(FSoftObjectPath(TEXT("/Game/Audio/SFX/S_Hurt.S_Hurt")));
     }
 
     bUseControllerRotationYaw = false;
@@ -243,11 +299,11 @@ ANazarenePlayerCharacter::ANazarenePlayerCharacter()
     CampaignBaseMaxStamina = MaxStamina;
 
     UnlockedMiracles.Add(FName(TEXT("heal")));
-    InitializeEnhancedInputDefaults();
 }
 
 void ANazarenePlayerCharacter::BeginPlay()
 {
+    BeginPlayStartSeconds = FPlatformTime::Seconds();
     Super::BeginPlay();
     DefaultActorScale = GetActorScale3D();
 
@@ -257,42 +313,21 @@ void ANazarenePlayerCharacter::BeginPlay()
         AbilitySystemComponent->GrantDefaultAbilities();
     }
 
-    bool bAppliedCharacterMesh = false;
-    if (ProductionSkeletalMesh.ToSoftObjectPath().IsValid())
-    {
-        if (USkeletalMesh* MeshAsset = ProductionSkeletalMesh.LoadSynchronous())
-        {
-            GetMesh()->SetSkeletalMesh(MeshAsset);
-            bAppliedCharacterMesh = true;
-        }
-    }
-
-    if (!bAppliedCharacterMesh && RetargetedSkeletalMesh.ToSoftObjectPath().IsValid())
+    if (WeaponTrace != nullptr)
     {
-        if (USkeletalMesh* MeshAsset = RetargetedSkeletalMesh.LoadSynchronous())
-        {
-            GetMesh()->SetSkeletalMesh(MeshAsset);
-            bAppliedCharacterMesh = true;
-        }
+        WeaponTrace->OnWeaponHit.AddUObject(this, &ANazarenePlayerCharacter::HandleWeaponHit);
     }
 
-    if (ProductionAnimBlueprint.ToSoftObjectPath().IsValid())
+    if (UWorld* World = GetWorld())
     {
-        if (UClass* AnimClass = ProductionAnimBlueprint.LoadSynchronous())
+        CombatSim = World->GetSubsystem<UNazareneCombatSimSubsystem>();
+        if (CombatSim.IsValid())
         {
-            GetMesh()->SetAnimInstanceClass(AnimClass);
+            CombatSim->RegisterParticipant(this);
         }
     }
 
-    if (bAppliedCharacterMesh)
-    {
-        if (UMaterialInterface* RobeMaterial = LoadObject<UMaterialInterface>(nullptr, TEXT("/Game/Art/Materials/MI_Character_JesusRobe.MI_Character_JesusRobe")))
-        {
-            GetMesh()->SetMaterial(0, RobeMaterial);
-        }
-    }
-
-    SetProxyVisualsHidden(bAppliedCharacterMesh);
+    RequestPresentationAssets();
 
     ApplySkillModifiers();
     CurrentHealth = MaxHealth;
@@ -339,6 +374,7 @@ void ANazarenePlayerCharacter::BeginPlay()
         }
     }
 
+    InitializeEnhancedInputDefaults();
     RegisterEnhancedInputMappingContext();
 
     if (UGameInstance* GI = GetGameInstance())
@@ -353,6 +389,141 @@ void ANazarenePlayerCharacter::BeginPlay()
     SmoothedMoveForwardAxis = MoveForwardAxis;
     SmoothedMoveRightAxis = MoveRightAxis;
     UpdateCameraState(0.0f);
+
+    BeginPlayMilliseconds = static_cast<float>((FPlatformTime::Seconds() - BeginPlayStartSeconds) * 1000.0);
+    SET_FLOAT_STAT(STAT_NazarenePlayerBeginPlayMs, BeginPlayMilliseconds);
+}
+
+void ANazarenePlayerCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (CombatSim.IsValid())
+    {
+        CombatSim->UnregisterParticipant(this);
+    }
+    if (PresentationHandle.IsValid())
+    {
+        if (PresentationHandle->HasLoadCompleted())
+        {
+            PresentationHandle->ReleaseHandle();
+        }
+        else
+        {
+            PresentationHandle->CancelHandle();
+        }
+        PresentationHandle.Reset();
+    }
+    PresentationReadyCallbacks.Reset();
+    Super::EndPlay(EndPlayReason);
+}
+
+void ANazarenePlayerCharacter::GetPresentationAssetPaths(TArray<FSoftObjectPath>& OutPaths) const
+{
+    const auto AddPath = [&OutPaths](const FSoftObjectPath& Path)
+    {
+        if (Path.IsValid())
+        {
+            OutPaths.AddUnique(Path);
+        }
+    };
+
+    // The retargeted mesh is only a fallback for when no production mesh is configured.
+    AddPath(ProductionSkeletalMesh.IsNull() ? RetargetedSkeletalMesh.ToSoftObjectPath() : ProductionSkeletalMesh.ToSoftObjectPath());
+    AddPath(ProductionAnimBlueprint.ToSoftObjectPath());
+    AddPath(FSoftObjectPath(PlayerRobeMaterialPath));
+    AddPath(LightAttackSound.ToSoftObjectPath());
+    AddPath(HeavyAttackSound.ToSoftObjectPath());
+    AddPath(DodgeSound.ToSoftObjectPath());
+    AddPath(MiracleSound.ToSoftObjectPath());
+    AddPath(HurtSound.ToSoftObjectPath());
+}
+
+void ANazarenePlayerCharacter::RequestPresentationAssets()
+{
+    TArray<FSoftObjectPath> Paths;
+    GetPresentationAssetPaths(Paths);
+    if (Paths.Num() == 0)
+    {
+        ApplyPresentationAssets();
+        return;
+    }
+
+    // The proxy shapes stand in until the bundle lands; the loading overlay waits on WhenPresentationReady.
+    PresentationHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        Paths,
+        FStreamableDelegate::CreateWeakLambda(this, [this]() { ApplyPresentationAssets(); }),
+        FStreamableManager::AsyncLoadHighPriority);
+    if (!PresentationHandle.IsValid())
+    {
+        ApplyPresentationAssets();
+        return;
+    }
+
+    // -NazareneSyncPlayerPresentation restores the old blocking spawn, for before/after benchmarks.
+    if (!bPresentationReady && FParse::Param(FCommandLine::Get(), TEXT("NazareneSyncPlayerPresentation")))
+    {
+        PresentationHandle->WaitUntilComplete();
+        ApplyPresentationAssets();
+    }
+}
+
+void ANazarenePlayerCharacter::ApplyPresentationAssets()
+{
+    if (bPresentationReady)
+    {
+        return;
+    }
+    bPresentationReady = true;
+
+    USkeletalMesh* MeshAsset = ProductionSkeletalMesh.Get();
+    if (MeshAsset == nullptr)
+    {
+        MeshAsset = RetargetedSkeletalMesh.Get();
+    }
+
+    const bool bAppliedCharacterMesh = MeshAsset != nullptr;
+    if (bAppliedCharacterMesh)
+    {
+        GetMesh()->SetSkeletalMesh(MeshAsset);
+    }
+
+    if (UClass* AnimClass = ProductionAnimBlueprint.Get())
+    {
+        GetMesh()->SetAnimInstanceClass(AnimClass);
+    }
+
+    if (bAppliedCharacterMesh)
+    {
+        if (UMaterialInterface* RobeMaterial = Cast<UMaterialInterface>(FSoftObjectPath(PlayerRobeMaterialPath).ResolveObject()))
+        {
+            GetMesh()->SetMaterial(0, RobeMaterial);
+        }
+    }
+
+    SetProxyVisualsHidden(bAppliedCharacterMesh);
+
+    PresentationReadyMilliseconds = static_cast<float>((FPlatformTime::Seconds() - BeginPlayStartSeconds) * 1000.0);
+    SET_FLOAT_STAT(STAT_NazarenePlayerPresentationReadyMs, PresentationReadyMilliseconds);
+
+    TArray<TFunction<void()>> Callbacks = MoveTemp(PresentationReadyCallbacks);
+    for (TFunction<void()>& Callback : Callbacks)
+    {
+        Callback();
+    }
+}
+
+void ANazarenePlayerCharacter::WhenPresentationReady(TFunction<void()> Callback)
+{
+    if (!Callback)
+    {
+        return;
+    }
+
+    if (bPresentationReady)
+    {
+        Callback();
+        return;
+    }
+    PresentationReadyCallbacks.Add(MoveTemp(Callback));
 }
 
 void ANazarenePlayerCharacter::ConfigureProxyVisuals()
@@ -419,20 +590,24 @@ void ANazarenePlayerCharacter::Tick(float DeltaSeconds)
 {
     Super::Tick(DeltaSeconds);
 
-    UpdateTimers(DeltaSeconds);
-    RegenStamina(DeltaSeconds);
     ValidateLockTarget();
     UpdateMovementState(DeltaSeconds);
     UpdateCameraState(DeltaSeconds);
+}
+
+void ANazarenePlayerCharacter::CombatStep(float StepSeconds)
+{
+    UpdateTimers(StepSeconds);
+    RegenStamina(StepSeconds);
 
     if (PendingAttack != ENazarenePlayerAttackType::None)
     {
         if (AttackWindupTimer > 0.0f)
         {
-            AttackWindupTimer = FMath::Max(0.0f, AttackWindupTimer - DeltaSeconds);
+            AttackWindupTimer = FMath::Max(0.0f, AttackWindupTimer - StepSeconds);
             if (AttackWindupTimer <= 0.0f && !bAttackResolved)
             {
-                ResolvePendingAttack();
+                BeginAttackSwing();
             }
         }
 
@@ -440,9 +615,9 @@ void ANazarenePlayerCharacter::Tick(float DeltaSeconds)
         {
             if (!bAttackResolved)
             {
-                ResolvePendingAttack();
+                BeginAttackSwing();
             }
-            AttackActiveTimer = FMath::Max(0.0f, AttackActiveTimer - DeltaSeconds);
+            AttackActiveTimer = FMath::Max(0.0f, AttackActiveTimer - StepSeconds);
             if (AttackActiveTimer <= 0.0f)
             {
                 PendingAttack = ENazarenePlayerAttackType::None;
@@ -450,6 +625,8 @@ void ANazarenePlayerCharacter::Tick(float DeltaSeconds)
             }
         }
     }
+
+    ProcessBufferedCombatInputs(StepSeconds);
 }
 
 void ANazarenePlayerCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -462,124 +639,135 @@ void ANazarenePlayerCharacter::SetupPlayerInputComponent(UInputComponent* Player
         UE_LOG(LogTemp, Warning, TEXT("NazarenePlayerCharacter expected UEnhancedInputComponent but received %s"), *GetNameSafe(PlayerInputComponent));
         return;
     }
+    InitializeEnhancedInputDefaults();
     BindEnhancedInput(EnhancedInputComponent);
 }
 
 void ANazarenePlayerCharacter::InitializeEnhancedInputDefaults()
 {
-    if (InputMappingContextAsset != nullptr)
+    if (RuntimeInputMappingContext != nullptr)
     {
-        RuntimeInputMappingContext = InputMappingContextAsset;
+        return;
+    }
 
-        auto FindMappedAction = [this](const TCHAR* Token) -> UInputAction*
-        {
-            if (RuntimeInputMappingContext == nullptr)
-            {
-                return nullptr;
-            }
+    struct FInputActionSlot
+    {
+        TObjectPtr<UInputAction> ANazarenePlayerCharacter::* Member;
+        const TCHAR* Token;
+        EInputActionValueType ValueType;
+        bool bRequired;
+    };
 
-            for (const FEnhancedActionKeyMapping& Mapping : RuntimeInputMappingContext->GetMappings())
-            {
-                const UInputAction* Action = Mapping.Action.Get();
-                if (Action != nullptr && Action->GetName().Contains(Token))
-                {
-                    return const_cast<UInputAction*>(Action);
-                }
-            }
-            return nullptr;
-        };
-
-        MoveForwardInputAction = FindMappedAction(TEXT("MoveForward"));
-        MoveRightInputAction = FindMappedAction(TEXT("MoveRight"));
-        TurnInputAction = FindMappedAction(TEXT("Turn"));
-        LookUpInputAction = FindMappedAction(TEXT("LookUp"));
-        InteractInputAction = FindMappedAction(TEXT("Interact"));
-        LockOnInputAction = FindMappedAction(TEXT("LockOn"));
-        PauseInputAction = FindMappedAction(TEXT("Pause"));
-        ToggleMouseCaptureInputAction = FindMappedAction(TEXT("ToggleMouseCapture"));
-        BlockInputAction = FindMappedAction(TEXT("Block"));
-        LightAttackInputAction = FindMappedAction(TEXT("LightAttack"));
-        HeavyAttackInputAction = FindMappedAction(TEXT("HeavyAttack"));
-        DodgeInputAction = FindMappedAction(TEXT("Dodge"));
-        ParryInputAction = FindMappedAction(TEXT("Parry"));
-        MiracleHealInputAction = FindMappedAction(TEXT("MiracleHeal"));
-        MiracleBlessingInputAction = FindMappedAction(TEXT("MiracleBlessing"));
-        MiracleRadianceInputAction = FindMappedAction(TEXT("MiracleRadiance"));
-        SaveSlot1InputAction = FindMappedAction(TEXT("SaveSlot1"));
-        SaveSlot2InputAction = FindMappedAction(TEXT("SaveSlot2"));
-        SaveSlot3InputAction = FindMappedAction(TEXT("SaveSlot3"));
-        LoadSlot1InputAction = FindMappedAction(TEXT("LoadSlot1"));
-        LoadSlot2InputAction = FindMappedAction(TEXT("LoadSlot2"));
-        LoadSlot3InputAction = FindMappedAction(TEXT("LoadSlot3"));
-        SkillTreeInputAction = FindMappedAction(TEXT("SkillTree"));
-
-        const bool bHasAllAssetActions =
-            MoveForwardInputAction != nullptr &&
-            MoveRightInputAction != nullptr &&
-            TurnInputAction != nullptr &&
-            LookUpInputAction != nullptr &&
-            InteractInputAction != nullptr &&
-            LockOnInputAction != nullptr &&
-            PauseInputAction != nullptr &&
-            ToggleMouseCaptureInputAction != nullptr &&
-            BlockInputAction != nullptr &&
-            LightAttackInputAction != nullptr &&
-            HeavyAttackInputAction != nullptr &&
-            DodgeInputAction != nullptr &&
-            ParryInputAction != nullptr &&
-            MiracleHealInputAction != nullptr &&
-            MiracleBlessingInputAction != nullptr &&
-            MiracleRadianceInputAction != nullptr &&
-            SaveSlot1InputAction != nullptr &&
-            SaveSlot2InputAction != nullptr &&
-            SaveSlot3InputAction != nullptr &&
-            LoadSlot1InputAction != nullptr &&
-            LoadSlot2InputAction != nullptr &&
-            LoadSlot3InputAction != nullptr;
+    static const FInputActionSlot Slots[] =
+    {
+        { &ANazarenePlayerCharacter::MoveForwardInputAction, TEXT("MoveForward"), EInputActionValueType::Axis1D, true },
+        { &ANazarenePlayerCharacter::MoveRightInputAction, TEXT("MoveRight"), EInputActionValueType::Axis1D, true },
+        { &ANazarenePlayerCharacter::TurnInputAction, TEXT("Turn"), EInputActionValueType::Axis1D, true },
+        { &ANazarenePlayerCharacter::LookUpInputAction, TEXT("LookUp"), EInputActionValueType::Axis1D, true },
+        { &ANazarenePlayerCharacter::InteractInputAction, TEXT("Interact"), EInputActionValueType::Boolean, true },
+        { &ANazarenePlayerCharacter::LockOnInputAction, TEXT("LockOn"), EInputActionValueType::Boolean, true },
+        { &ANazarenePlayerCharacter::PauseInputAction, TEXT("Pause"), EInputActionValueType::Boolean, true },
+        { &ANazarenePlayerCharacter::ToggleMouseCaptureInputAction, TEXT("ToggleMouseCapture"), EInputActionValueType::Boolean, true },
+        { &ANazarenePlayerCharacter::BlockInputAction, TEXT("Block"), EInputActionValueType::Boolean, true },
+        { &ANazarenePlayerCharacter::LightAttackInputAction, TEXT("LightAttack"), EInputActionValueType::Boolean, true },
+        { &ANazarenePlayerCharacter::HeavyAttackInputAction, TEXT("HeavyAttack"), EInputActionValueType::Boolean, true },
+        { &ANazarenePlayerCharacter::DodgeInputAction, TEXT("Dodge"), EInputActionValueType::Boolean, true },
+        { &ANazarenePlayerCharacter::ParryInputAction, TEXT("Parry"), EInputActionValueType::Boolean, true },
+        { &ANazarenePlayerCharacter::MiracleHealInputAction, TEXT("MiracleHeal"), EInputActionValueType::Boolean, true },
+        { &ANazarenePlayerCharacter::MiracleBlessingInputAction, TEXT("MiracleBlessing"), EInputActionValueType::Boolean, true },
+        { &ANazarenePlayerCharacter::MiracleRadianceInputAction, TEXT("MiracleRadiance"), EInputActionValueType::Boolean, true },
+        { &ANazarenePlayerCharacter::SaveSlot1InputAction, TEXT("SaveSlot1"), EInputActionValueType::Boolean, true },
+        { &ANazarenePlayerCharacter::SaveSlot2InputAction, TEXT("SaveSlot2"), EInputActionValueType::Boolean, true },
+        { &ANazarenePlayerCharacter::SaveSlot3InputAction, TEXT("SaveSlot3"), EInputActionValueType::Boolean, true },
+        { &ANazarenePlayerCharacter::LoadSlot1InputAction, TEXT("LoadSlot1"), EInputActionValueType::Boolean, true },
+        { &ANazarenePlayerCharacter::LoadSlot2InputAction, TEXT("LoadSlot2"), EInputActionValueType::Boolean, true },
+        { &ANazarenePlayerCharacter::LoadSlot3InputAction, TEXT("LoadSlot3"), EInputActionValueType::Boolean, true },
+        { &ANazarenePlayerCharacter::SkillTreeInputAction, TEXT("SkillTree"), EInputActionValueType::Boolean, false }
+    };
 
-        if (bHasAllAssetActions)
+    const auto AdoptSharedInput = [this](const FNazareneSharedPlayerInput& Shared)
+    {
+        RuntimeInputMappingContext = Shared.MappingContext;
+        for (int32 Index = 0; Index < static_cast<int32>(UE_ARRAY_COUNT(Slots)); ++Index)
         {
-            return;
+            this->*Slots[Index].Member = Shared.Actions[Index];
         }
+    };
 
-        UE_LOG(LogTemp, Warning, TEXT("NazarenePlayerCharacter asset mapping context is missing required actions. Falling back to runtime defaults."));
-        RuntimeInputMappingContext = nullptr;
+    FSoftObjectPath ContextPath = InputMappingContextAsset.ToSoftObjectPath();
+    if (ContextPath.IsNull())
+    {
+        // Resolved per spawn, not cached, so a changed override is picked up by the next PIE session.
+        ContextPath = FSoftObjectPath(NazareneAssetResolver::ResolveObjectPath(
+            TEXT("PlayerInputMappingContext"),
+            TEXT("/Game/Input/IMC_Nazarene.IMC_Nazarene"),
+            {}));
     }
 
-    RuntimeInputMappingContext = NewObject<UInputMappingContext>(this, TEXT("NazareneRuntimeInputMapping"));
-
-    MoveForwardInputAction = MakeInputAction(this, TEXT("NazareneMoveForward"), EInputActionValueType::Axis1D);
-    MoveRightInputAction = MakeInputAction(this, TEXT("NazareneMoveRight"), EInputActionValueType::Axis1D);
-    TurnInputAction = MakeInputAction(this, TEXT("NazareneTurn"), EInputActionValueType::Axis1D);
-    LookUpInputAction = MakeInputAction(this, TEXT("NazareneLookUp"), EInputActionValueType::Axis1D);
+    // Every later spawn in this game instance takes the resolved objects as they are; only the first one loads or builds them.
+    UGameInstance* GameInstance = GetGameInstance();
+    UNazarenePlayerInputSubsystem* InputCache = GameInstance != nullptr ? GameInstance->GetSubsystem<UNazarenePlayerInputSubsystem>() : nullptr;
+    if (const FNazareneSharedPlayerInput* Shared = InputCache != nullptr ? InputCache->FindSharedInput(ContextPath) : nullptr)
+    {
+        AdoptSharedInput(*Shared);
+        return;
+    }
 
-    InteractInputAction = MakeInputAction(this, TEXT("NazareneInteract"), EInputActionValueType::Boolean);
-    LockOnInputAction = MakeInputAction(this, TEXT("NazareneLockOn"), EInputActionValueType::Boolean);
-    PauseInputAction = MakeInputAction(this, TEXT("NazarenePause"), EInputActionValueType::Boolean);
-    ToggleMouseCaptureInputAction = MakeInputAction(this, TEXT("NazareneToggleMouseCapture"), EInputActionValueType::Boolean);
-    BlockInputAction = MakeInputAction(this, TEXT("NazareneBlock"), EInputActionValueType::Boolean);
+    FNazareneSharedPlayerInput Resolved;
+    if (!ContextPath.IsNull())
+    {
+        UInputMappingContext* MappingContext = Cast<UInputMappingContext>(ContextPath.TryLoad());
+        bool bHasAllAssetActions = MappingContext != nullptr;
+        for (const FInputActionSlot& Slot : Slots)
+        {
+            UInputAction* Action = FindMappedAction(MappingContext, Slot.Token);
+            Resolved.Actions.Add(Action);
+            bHasAllAssetActions &= Action != nullptr || !Slot.bRequired;
+        }
 
-    LightAttackInputAction = MakeInputAction(this, TEXT("NazareneLightAttack"), EInputActionValueType::Boolean);
-    HeavyAttackInputAction = MakeInputAction(this, TEXT("NazareneHeavyAttack"), EInputActionValueType::Boolean);
-    DodgeInputAction = MakeInputAction(this, TEXT("NazareneDodge"), EInputActionValueType::Boolean);
-    ParryInputAction = MakeInputAction(this, TEXT("NazareneParry"), EInputActionValueType::Boolean);
-    MiracleHealInputAction = MakeInputAction(this, TEXT("NazareneMiracleHeal"), EInputActionValueType::Boolean);
-    MiracleBlessingInputAction = MakeInputAction(this, TEXT("NazareneMiracleBlessing"), EInputActionValueType::Boolean);
-    MiracleRadianceInputAction = MakeInputAction(this, TEXT("NazareneMiracleRadiance"), EInputActionValueType::Boolean);
+        if (bHasAllAssetActions)
+        {
+            Resolved.MappingContext = MappingContext;
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("NazarenePlayerCharacter mapping context %s is missing or lacks required actions. Falling back to runtime defaults."), *ContextPath.ToString());
+            Resolved.Actions.Reset();
+        }
+    }
 
-    SaveSlot1InputAction = MakeInputAction(this, TEXT("NazareneSaveSlot1"), EInputActionValueType::Boolean);
-    SaveSlot2InputAction = MakeInputAction(this, TEXT("NazareneSaveSlot2"), EInputActionValueType::Boolean);
-    SaveSlot3InputAction = MakeInputAction(this, TEXT("NazareneSaveSlot3"), EInputActionValueType::Boolean);
-    LoadSlot1InputAction = MakeInputAction(this, TEXT("NazareneLoadSlot1"), EInputActionValueType::Boolean);
-    LoadSlot2InputAction = MakeInputAction(this, TEXT("NazareneLoadSlot2"), EInputActionValueType::Boolean);
-    LoadSlot3InputAction = MakeInputAction(this, TEXT("NazareneLoadSlot3"), EInputActionValueType::Boolean);
-    SkillTreeInputAction = MakeInputAction(this, TEXT("NazareneSkillTree"), EInputActionValueType::Boolean);
+    if (Resolved.MappingContext != nullptr)
+    {
+        if (InputCache != nullptr)
+        {
+            InputCache->AddSharedInput(ContextPath, Resolved);
+        }
+        AdoptSharedInput(Resolved);
+        return;
+    }
 
-    if (RuntimeInputMappingContext == nullptr)
+    if (const FNazareneSharedPlayerInput* Fallback = InputCache != nullptr ? InputCache->FindSharedInput(FSoftObjectPath()) : nullptr)
     {
+        Resolved = *Fallback;
+        InputCache->AddSharedInput(ContextPath, Resolved);
+        AdoptSharedInput(Resolved);
         return;
     }
 
+    // Runtime defaults are owned by the input cache (or this pawn without one), which keeps them alive as properties.
+    UObject* RuntimeOuter = InputCache != nullptr ? static_cast<UObject*>(InputCache) : this;
+    Resolved.MappingContext = NewObject<UInputMappingContext>(RuntimeOuter, TEXT("NazareneRuntimeInputMapping"));
+    for (const FInputActionSlot& Slot : Slots)
+    {
+        Resolved.Actions.Add(MakeInputAction(RuntimeOuter, *FString::Printf(TEXT("Nazarene%s"), Slot.Token), Slot.ValueType));
+    }
+    if (InputCache != nullptr)
+    {
+        InputCache->AddSharedInput(FSoftObjectPath(), Resolved);
+        InputCache->AddSharedInput(ContextPath, Resolved);
+    }
+    AdoptSharedInput(Resolved);
+
     AddScaledMapping(RuntimeInputMappingContext, MoveForwardInputAction, EKeys::W, 1.0f);
     AddScaledMapping(RuntimeInputMappingContext, MoveForwardInputAction, EKeys::S, -1.0f);
     AddScaledMapping(RuntimeInputMappingContext, MoveForwardInputAction, EKeys::Up, 1.0f);
@@ -683,13 +871,13 @@ void ANazarenePlayerCharacter::BindEnhancedInput(UEnhancedInputComponent* Enhanc
     EnhancedInputComponent->BindAction(BlockInputAction, ETriggerEvent::Started, this, &ANazarenePlayerCharacter::StartBlock);
     EnhancedInputComponent->BindAction(BlockInputAction, ETriggerEvent::Completed, this, &ANazarenePlayerCharacter::StopBlock);
 
-    EnhancedInputComponent->BindAction(LightAttackInputAction, ETriggerEvent::Started, this, &ANazarenePlayerCharacter::TryLightAttack);
-    EnhancedInputComponent->BindAction(HeavyAttackInputAction, ETriggerEvent::Started, this, &ANazarenePlayerCharacter::TryHeavyAttack);
-    EnhancedInputComponent->BindAction(DodgeInputAction, ETriggerEvent::Started, this, &ANazarenePlayerCharacter::TryDodge);
-    EnhancedInputComponent->BindAction(ParryInputAction, ETriggerEvent::Started, this, &ANazarenePlayerCharacter::TryParry);
-    EnhancedInputComponent->BindAction(MiracleHealInputAction, ETriggerEvent::Started, this, &ANazarenePlayerCharacter::TryHealingMiracle);
-    EnhancedInputComponent->BindAction(MiracleBlessingInputAction, ETriggerEvent::Started, this, &ANazarenePlayerCharacter::TryBlessingMiracle);
-    EnhancedInputComponent->BindAction(MiracleRadianceInputAction, ETriggerEvent::Started, this, &ANazarenePlayerCharacter::TryRadianceMiracle);
+    EnhancedInputComponent->BindAction(LightAttackInputAction, ETriggerEvent::Started, this, &ANazarenePlayerCharacter::OnCombatInput, ENazareneCombatInput::LightAttack);
+    EnhancedInputComponent->BindAction(HeavyAttackInputAction, ETriggerEvent::Started, this, &ANazarenePlayerCharacter::OnCombatInput, ENazareneCombatInput::HeavyAttack);
+    EnhancedInputComponent->BindAction(DodgeInputAction, ETriggerEvent::Started, this, &ANazarenePlayerCharacter::OnCombatInput, ENazareneCombatInput::Dodge);
+    EnhancedInputComponent->BindAction(ParryInputAction, ETriggerEvent::Started, this, &ANazarenePlayerCharacter::OnCombatInput, ENazareneCombatInput::Parry);
+    EnhancedInputComponent->BindAction(MiracleHealInputAction, ETriggerEvent::Started, this, &ANazarenePlayerCharacter::OnCombatInput, ENazareneCombatInput::MiracleHeal);
+    EnhancedInputComponent->BindAction(MiracleBlessingInputAction, ETriggerEvent::Started, this, &ANazarenePlayerCharacter::OnCombatInput, ENazareneCombatInput::MiracleBlessing);
+    EnhancedInputComponent->BindAction(MiracleRadianceInputAction, ETriggerEvent::Started, this, &ANazarenePlayerCharacter::OnCombatInput, ENazareneCombatInput::MiracleRadiance);
 
     EnhancedInputComponent->BindAction(SaveSlot1InputAction, ETriggerEvent::Started, this, &ANazarenePlayerCharacter::TrySaveSlot1);
     EnhancedInputComponent->BindAction(SaveSlot2InputAction, ETriggerEvent::Started, this, &ANazarenePlayerCharacter::TrySaveSlot2);
@@ -700,6 +888,19 @@ void ANazarenePlayerCharacter::BindEnhancedInput(UEnhancedInputComponent* Enhanc
     EnhancedInputComponent->BindAction(SkillTreeInputAction, ETriggerEvent::Started, this, &ANazarenePlayerCharacter::TryToggleSkillTree);
 }
 
+void ANazarenePlayerCharacter::GetReplayInputActions(TArray<UInputAction*>& OutActions) const
+{
+    OutActions = {
+        MoveForwardInputAction, MoveRightInputAction, TurnInputAction, LookUpInputAction,
+        InteractInputAction, LockOnInputAction, PauseInputAction, ToggleMouseCaptureInputAction,
+        BlockInputAction, LightAttackInputAction, HeavyAttackInputAction, DodgeInputAction, ParryInputAction,
+        MiracleHealInputAction, MiracleBlessingInputAction, MiracleRadianceInputAction,
+        SaveSlot1InputAction, SaveSlot2InputAction, SaveSlot3InputAction,
+        LoadSlot1InputAction, LoadSlot2InputAction, LoadSlot3InputAction, SkillTreeInputAction
+    };
+    OutActions.RemoveAll([](const UInputAction* Action) { return Action == nullptr; });
+}
+
 void ANazarenePlayerCharacter::OnMoveForwardInput(const FInputActionValue& Value)
 {
     MoveForward(Value.Get<float>());
@@ -737,6 +938,7 @@ void ANazarenePlayerCharacter::ReceiveEnemyAttack(ANazareneEnemyCharacter* Attac
         Attacker->OnParried(this);
         AddFaith(2.0f);
         ParryWindowTimer = 0.0f;
+        UNazareneCombatEventSubsystem::Publish(this, FNazareneCombatEvent::Make(ENazareneCombatEventType::Parry, Attacker, this));
         return;
     }
 
@@ -760,14 +962,19 @@ void ANazarenePlayerCharacter::ReceiveEnemyAttack(ANazareneEnemyCharacter* Attac
             AddFaith(1.0f);
         }
         CurrentStamina = FMath::Max(0.0f, CurrentStamina - StaminaLoss);
+
+        FNazareneCombatEvent BlockEvent = FNazareneCombatEvent::Make(ENazareneCombatEventType::Block, this, Attacker);
+        BlockEvent.Amount = StaminaLoss;
+        UNazareneCombatEventSubsystem::Publish(this, BlockEvent);
+
         if (CurrentStamina <= KINDA_SMALL_NUMBER && PerfectBlockTimer <= 0.0f)
         {
-            ApplyHealthDamage(AdjustedDamage * 0.35f);
+            ApplyHealthDamage(AdjustedDamage * 0.35f, Attacker);
         }
         return;
     }
 
-    ApplyHealthDamage(AdjustedDamage);
+    ApplyHealthDamage(AdjustedDamage, Attacker);
 }
 
 void ANazarenePlayerCharacter::AddFaith(float Amount)
@@ -806,9 +1013,16 @@ void ANazarenePlayerCharacter::SetCombatEnabled(bool bEnabled)
         AttackWindupTimer = 0.0f;
         AttackActiveTimer = 0.0f;
         bAttackResolved = false;
+        if (WeaponTrace != nullptr)
+        {
+            WeaponTrace->EndSwing();
+        }
         AttackCooldown = 0.0f;
         ParryWindowTimer = 0.0f;
         ParryStartupTimer = 0.0f;
+        UNazareneInputLatencySubsystem::Drop(this, ParryLatencyProbeId);
+        ParryLatencyProbeId = 0;
+        ClearBufferedCombatInputs();
     }
 }
 
@@ -832,11 +1046,17 @@ void ANazarenePlayerCharacter::SetBabyIntroMode(bool bEnabled)
         AttackWindupTimer = 0.0f;
         AttackActiveTimer = 0.0f;
         bAttackResolved = false;
+        if (WeaponTrace != nullptr)
+        {
+            WeaponTrace->EndSwing();
+        }
         AttackCooldown = FMath::Max(AttackCooldown, 0.2f);
         DodgeTimer = 0.0f;
         InvulnerabilityTimer = 0.0f;
         ParryWindowTimer = 0.0f;
         ParryStartupTimer = 0.0f;
+        UNazareneInputLatencySubsystem::Drop(this, ParryLatencyProbeId);
+        ParryLatencyProbeId = 0;
         if (StaffMesh != nullptr)
         {
             StaffMesh->SetHiddenInGame(true);
@@ -935,7 +1155,7 @@ bool ANazarenePlayerCharacter::IsDefeated() const
 
 float ANazarenePlayerCharacter::GetHurtTimeRemaining() const
 {
-    return HurtTimer;
+    return CombatSim.IsValid() ? CombatSim->AdvanceTimerForPresentation(HurtTimer) : HurtTimer;
 }
 
 float ANazarenePlayerCharacter::GetHealCooldownRemaining() const
@@ -977,6 +1197,7 @@ int32 ANazarenePlayerCharacter::GetXPToNextLevel() const
 void ANazarenePlayerCharacter::SetSkillTreeState(const TArray<FName>& Skills, int32 InSkillPoints, int32 InTotalXP, int32 InPlayerLevel)
 {
     UnlockedSkills = Skills;
+    CompiledSkillModifiers = UNazareneSkillTree::CompileModifiers(this, UnlockedSkills);
     UnspentSkillPoints = FMath::Max(0, InSkillPoints);
     TotalXP = FMath::Max(0, InTotalXP);
     PlayerLevel = FMath::Max(1, InPlayerLevel);
@@ -999,6 +1220,7 @@ bool ANazarenePlayerCharacter::AttemptUnlockSkill(FName SkillId)
     }
 
     UnlockedSkills.AddUnique(SkillId);
+    CompiledSkillModifiers = UNazareneSkillTree::CompileModifiers(this, UnlockedSkills);
     UnspentSkillPoints = FMath::Max(0, UnspentSkillPoints - FMath::Max(Definition.Cost, 1));
     ApplySkillModifiers();
     SetContextHint(FString::Printf(TEXT("Unlocked skill: %s"), *Definition.Name));
@@ -1036,59 +1258,20 @@ void ANazarenePlayerCharacter::DisplayDamageNumber(const FVector& WorldLocation,
 
 void ANazarenePlayerCharacter::ApplySkillModifiers()
 {
-    LightAttackDamage = 26.0f;
-    HeavyAttackDamage = 42.0f;
-    HeavyAttackPoiseDamage = 54.0f;
-    HeavyAttackRange = 340.0f;
-    WalkSpeed = 580.0f;
-    DodgeStaminaCost = 26.0f;
-    HealAmount = 45.0f;
-    RadianceDamage = 32.0f;
-    RadianceRadius = 600.0f;
-    StaminaRegen = 22.0f;
-
-    float SkillHealthBonus = 0.0f;
-    float SkillStaminaBonus = 0.0f;
-
-    if (UnlockedSkills.Contains(FName(TEXT("combat_smite"))))
-    {
-        LightAttackDamage *= 1.1f;
-        HeavyAttackDamage *= 1.1f;
-    }
-    if (UnlockedSkills.Contains(FName(TEXT("combat_crusader"))))
-    {
-        HeavyAttackPoiseDamage *= 1.12f;
-        HeavyAttackRange += 40.0f;
-    }
-    if (UnlockedSkills.Contains(FName(TEXT("movement_pilgrim_stride"))))
-    {
-        WalkSpeed *= 1.12f;
-    }
-    if (UnlockedSkills.Contains(FName(TEXT("movement_swift_vow"))))
-    {
-        DodgeStaminaCost *= 0.82f;
-    }
-    if (UnlockedSkills.Contains(FName(TEXT("miracles_abundance"))))
-    {
-        HealAmount *= 1.18f;
-    }
-    if (UnlockedSkills.Contains(FName(TEXT("miracles_radiance_lance"))))
-    {
-        RadianceDamage *= 1.2f;
-        RadianceRadius += 120.0f;
-    }
-    if (UnlockedSkills.Contains(FName(TEXT("defense_shepherd_guard"))))
-    {
-        SkillHealthBonus += 14.0f;
-    }
-    if (UnlockedSkills.Contains(FName(TEXT("defense_steadfast"))))
-    {
-        SkillStaminaBonus += 18.0f;
-        StaminaRegen *= 1.15f;
-    }
-
-    MaxHealth = CampaignBaseMaxHealth + SkillHealthBonus;
-    MaxStamina = CampaignBaseMaxStamina + SkillStaminaBonus;
+    const FNazareneCompiledSkillModifiers& Modifiers = CompiledSkillModifiers;
+    LightAttackDamage = Modifiers.Apply(ENazarenePlayerStat::LightAttackDamage, 26.0f);
+    HeavyAttackDamage = Modifiers.Apply(ENazarenePlayerStat::HeavyAttackDamage, 42.0f);
+    HeavyAttackPoiseDamage = Modifiers.Apply(ENazarenePlayerStat::HeavyAttackPoiseDamage, 54.0f);
+    HeavyAttackRange = Modifiers.Apply(ENazarenePlayerStat::HeavyAttackRange, 340.0f);
+    WalkSpeed = Modifiers.Apply(ENazarenePlayerStat::WalkSpeed, 580.0f);
+    DodgeStaminaCost = Modifiers.Apply(ENazarenePlayerStat::DodgeStaminaCost, 26.0f);
+    HealAmount = Modifiers.Apply(ENazarenePlayerStat::HealAmount, 45.0f);
+    RadianceDamage = Modifiers.Apply(ENazarenePlayerStat::RadianceDamage, 32.0f);
+    RadianceRadius = Modifiers.Apply(ENazarenePlayerStat::RadianceRadius, 600.0f);
+    StaminaRegen = Modifiers.Apply(ENazarenePlayerStat::StaminaRegen, 22.0f);
+
+    MaxHealth = Modifiers.Apply(ENazarenePlayerStat::MaxHealth, CampaignBaseMaxHealth);
+    MaxStamina = Modifiers.Apply(ENazarenePlayerStat::MaxStamina, CampaignBaseMaxStamina);
     CurrentHealth = FMath::Min(CurrentHealth, MaxHealth);
     CurrentStamina = FMath::Min(CurrentStamina, MaxStamina);
 
@@ -1131,6 +1314,8 @@ void ANazarenePlayerCharacter::ApplySnapshot(const FNazarenePlayerSnapshot& Snap
     InvulnerabilityTimer = 0.0f;
     ParryWindowTimer = 0.0f;
     ParryStartupTimer = 0.0f;
+    UNazareneInputLatencySubsystem::Drop(this, ParryLatencyProbeId);
+    ParryLatencyProbeId = 0;
     HealCooldownTimer = 0.0f;
     BlessingTimer = 0.0f;
     BlessingCooldownTimer = 0.0f;
@@ -1141,6 +1326,10 @@ void ANazarenePlayerCharacter::ApplySnapshot(const FNazarenePlayerSnapshot& Snap
     AttackWindupTimer = 0.0f;
     AttackActiveTimer = 0.0f;
     bAttackResolved = false;
+    if (WeaponTrace != nullptr)
+    {
+        WeaponTrace->EndSwing();
+    }
     ClearLockTarget();
 
     if (AttributeSet != nullptr)
@@ -1222,6 +1411,10 @@ void ANazarenePlayerCharacter::RestAtPrayerSite(ANazarenePrayerSite* Site)
     AttackWindupTimer = 0.0f;
     AttackActiveTimer = 0.0f;
     bAttackResolved = false;
+    if (WeaponTrace != nullptr)
+    {
+        WeaponTrace->EndSwing();
+    }
     LastRestSiteId = Site->SiteId;
 
     if (AttributeSet != nullptr)
@@ -1247,14 +1440,19 @@ void ANazarenePlayerCharacter::RestAtPrayerSite(ANazarenePrayerSite* Site)
     }
 
     SetContextHint(Site->GetPromptMessage());
+
+    // Restore before notifying so a first consecration fires its waves on top of the restored region.
     if (CampaignGameMode.IsValid())
     {
+        CampaignGameMode->RestoreRegionBaseline();
         CampaignGameMode->NotifyPrayerSiteRest(Site->SiteId);
     }
-
-    for (TActorIterator<ANazareneEnemyCharacter> It(GetWorld()); It; ++It)
+    else
     {
-        It->ResetToSpawn();
+        for (TActorIterator<ANazareneEnemyCharacter> It(GetWorld()); It; ++It)
+        {
+            It->ResetToSpawn();
+        }
     }
     ClearLockTarget();
 }
@@ -1455,8 +1653,10 @@ void ANazarenePlayerCharacter::ToggleMouseCapture()
 
 void ANazarenePlayerCharacter::StartBlock()
 {
+    const int32 LatencyProbeId = UNazareneInputLatencySubsystem::Begin(this, ENazareneLatencyProbe::Block);
     bIsBlocking = true;
     PerfectBlockTimer = 0.18f;
+    UNazareneInputLatencySubsystem::Acted(this, LatencyProbeId);
 }
 
 void ANazarenePlayerCharacter::StopBlock()
@@ -1464,66 +1664,206 @@ void ANazarenePlayerCharacter::StopBlock()
     bIsBlocking = false;
 }
 
-void ANazarenePlayerCharacter::TryLightAttack()
+void ANazarenePlayerCharacter::OnCombatInput(ENazareneCombatInput Input)
 {
     if (bBabyIntroMode || !bCombatEnabled)
     {
         return;
     }
 
-    if (IsBusy() || PendingAttack != ENazarenePlayerAttackType::None)
+    // Enhanced Input carries no per-event device time; the probe opens in the frame the press was pumped.
+    const int32 LatencyProbeId = UNazareneInputLatencySubsystem::Begin(this, LatencyProbeFor(Input));
+
+    // Defensive presses cancel buffered offence; a new attack or miracle replaces an older one of its kind.
+    const bool bDefensive = Input == ENazareneCombatInput::Dodge || Input == ENazareneCombatInput::Parry;
+    const int32 Priority = CombatInputPriority(Input);
+    BufferedCombatInputs.RemoveAll([this, bDefensive, Priority](const FBufferedCombatInput& Buffered)
+    {
+        const int32 BufferedPriority = CombatInputPriority(Buffered.Input);
+        const bool bDiscard = bDefensive ? BufferedPriority <= Priority : BufferedPriority == Priority;
+        if (bDiscard)
+        {
+            UNazareneInputLatencySubsystem::Drop(this, Buffered.LatencyProbeId);
+        }
+        return bDiscard;
+    });
+
+    if (TryCombatInput(Input, LatencyProbeId))
     {
+        ClearBufferedCombatInputs();
         return;
     }
-    if (!ConsumeStamina(LightAttackStaminaCost))
+
+    if (InputBufferSeconds <= 0.0f)
     {
+        UNazareneInputLatencySubsystem::Drop(this, LatencyProbeId);
         return;
     }
+
+    if (BufferedCombatInputs.Num() >= 4)
+    {
+        UNazareneInputLatencySubsystem::Drop(this, BufferedCombatInputs[0].LatencyProbeId);
+        BufferedCombatInputs.RemoveAt(0);
+    }
+    FBufferedCombatInput& Buffered = BufferedCombatInputs.AddDefaulted_GetRef();
+    Buffered.Input = Input;
+    Buffered.LatencyProbeId = LatencyProbeId;
+}
+
+bool ANazarenePlayerCharacter::TryCombatInput(ENazareneCombatInput Input, int32 LatencyProbeId)
+{
+    TGuardValue<int32> ActingProbeGuard(ActingLatencyProbeId, LatencyProbeId);
+    switch (Input)
+    {
+    case ENazareneCombatInput::LightAttack:
+        return TryLightAttack();
+    case ENazareneCombatInput::HeavyAttack:
+        return TryHeavyAttack();
+    case ENazareneCombatInput::Dodge:
+        return TryDodge();
+    case ENazareneCombatInput::Parry:
+        return TryParry();
+    case ENazareneCombatInput::MiracleHeal:
+        return TryHealingMiracle();
+    case ENazareneCombatInput::MiracleBlessing:
+        return TryBlessingMiracle();
+    case ENazareneCombatInput::MiracleRadiance:
+        return TryRadianceMiracle();
+    default:
+        return false;
+    }
+}
+
+int32 ANazarenePlayerCharacter::CombatInputPriority(ENazareneCombatInput Input)
+{
+    switch (Input)
+    {
+    case ENazareneCombatInput::Dodge:
+    case ENazareneCombatInput::Parry:
+        return 2;
+    case ENazareneCombatInput::MiracleHeal:
+    case ENazareneCombatInput::MiracleBlessing:
+    case ENazareneCombatInput::MiracleRadiance:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+void ANazarenePlayerCharacter::ProcessBufferedCombatInputs(float StepSeconds)
+{
+    if (BufferedCombatInputs.Num() == 0)
+    {
+        return;
+    }
+
+    for (int32 Index = BufferedCombatInputs.Num() - 1; Index >= 0; --Index)
+    {
+        BufferedCombatInputs[Index].AgeSeconds += StepSeconds;
+        if (BufferedCombatInputs[Index].AgeSeconds > InputBufferSeconds)
+        {
+            UNazareneInputLatencySubsystem::Drop(this, BufferedCombatInputs[Index].LatencyProbeId);
+            BufferedCombatInputs.RemoveAt(Index);
+            INC_DWORD_STAT(STAT_NazareneBufferedInputsExpired);
+        }
+    }
+
+    // Highest priority first, newest first within a priority; one action per step.
+    int32 BestIndex = INDEX_NONE;
+    for (int32 Index = 0; Index < BufferedCombatInputs.Num(); ++Index)
+    {
+        if (BestIndex == INDEX_NONE || CombatInputPriority(BufferedCombatInputs[Index].Input) >= CombatInputPriority(BufferedCombatInputs[BestIndex].Input))
+        {
+            BestIndex = Index;
+        }
+    }
+    if (BestIndex == INDEX_NONE || !TryCombatInput(BufferedCombatInputs[BestIndex].Input, BufferedCombatInputs[BestIndex].LatencyProbeId))
+    {
+        return;
+    }
+
+    // Presses made before the one that fired are spent; later ones wait to chain after it.
+    for (int32 Index = 0; Index < BestIndex; ++Index)
+    {
+        UNazareneInputLatencySubsystem::Drop(this, BufferedCombatInputs[Index].LatencyProbeId);
+    }
+    BufferedCombatInputs.RemoveAt(0, BestIndex + 1);
+    INC_DWORD_STAT(STAT_NazareneBufferedInputsReplayed);
+}
+
+void ANazarenePlayerCharacter::ClearBufferedCombatInputs()
+{
+    for (const FBufferedCombatInput& Buffered : BufferedCombatInputs)
+    {
+        UNazareneInputLatencySubsystem::Drop(this, Buffered.LatencyProbeId);
+    }
+    BufferedCombatInputs.Reset();
+}
+
+bool ANazarenePlayerCharacter::TryLightAttack()
+{
+    if (bBabyIntroMode || !bCombatEnabled)
+    {
+        return false;
+    }
+
+    if (IsBusy() || PendingAttack != ENazarenePlayerAttackType::None)
+    {
+        return false;
+    }
+    if (!ConsumeStamina(LightAttackStaminaCost))
+    {
+        return false;
+    }
     PendingAttack = ENazarenePlayerAttackType::Light;
     AttackWindupTimer = 0.15f;
     AttackActiveTimer = 0.2f;
     bAttackResolved = false;
     AttackCooldown = 0.5f;
-    TriggerPresentation(LightAttackSound, LightAttackVFX, GetActorLocation() + GetActorForwardVector() * 110.0f, 0.85f);
+    UNazareneInputLatencySubsystem::Acted(this, ActingLatencyProbeId);
+    TriggerPresentation(LightAttackSound.Get(), LightAttackVFX, GetActorLocation() + GetActorForwardVector() * 110.0f, 0.85f);
+    return true;
 }
 
-void ANazarenePlayerCharacter::TryHeavyAttack()
+bool ANazarenePlayerCharacter::TryHeavyAttack()
 {
     if (bBabyIntroMode || !bCombatEnabled)
     {
-        return;
+        return false;
     }
 
     if (IsBusy() || PendingAttack != ENazarenePlayerAttackType::None)
     {
-        return;
+        return false;
     }
     if (!ConsumeStamina(HeavyAttackStaminaCost))
     {
-        return;
+        return false;
     }
     PendingAttack = ENazarenePlayerAttackType::Heavy;
     AttackWindupTimer = 0.3f;
     AttackActiveTimer = 0.23f;
     bAttackResolved = false;
     AttackCooldown = 0.84f;
-    TriggerPresentation(HeavyAttackSound, HeavyAttackVFX, GetActorLocation() + GetActorForwardVector() * 125.0f, 0.95f);
+    UNazareneInputLatencySubsystem::Acted(this, ActingLatencyProbeId);
+    TriggerPresentation(HeavyAttackSound.Get(), HeavyAttackVFX, GetActorLocation() + GetActorForwardVector() * 125.0f, 0.95f);
+    return true;
 }
 
-void ANazarenePlayerCharacter::TryDodge()
+bool ANazarenePlayerCharacter::TryDodge()
 {
     if (bBabyIntroMode || !bCombatEnabled)
     {
-        return;
+        return false;
     }
 
     if (IsBusy())
     {
-        return;
+        return false;
     }
     if (!ConsumeStamina(DodgeStaminaCost))
     {
-        return;
+        return false;
     }
 
     FVector DodgeVector = GetActorForwardVector();
@@ -1541,39 +1881,47 @@ void ANazarenePlayerCharacter::TryDodge()
 
     DodgeDirection = DodgeVector;
     LaunchCharacter(DodgeDirection * DodgeSpeed, true, false);
+    UNazareneInputLatencySubsystem::Acted(this, ActingLatencyProbeId);
     PendingAttack = ENazarenePlayerAttackType::None;
+    if (WeaponTrace != nullptr)
+    {
+        WeaponTrace->EndSwing();
+    }
     AttackCooldown = 0.28f;
     DodgeTimer = 0.28f;
     InvulnerabilityTimer = 0.22f;
-    TriggerPresentation(DodgeSound, DodgeVFX, GetActorLocation(), 0.8f);
+    TriggerPresentation(DodgeSound.Get(), DodgeVFX, GetActorLocation(), 0.8f, ENazareneCombatAudioCategory::Movement);
+    return true;
 }
 
-void ANazarenePlayerCharacter::TryParry()
+bool ANazarenePlayerCharacter::TryParry()
 {
     if (bBabyIntroMode || !bCombatEnabled)
     {
-        return;
+        return false;
     }
 
     if (IsBusy())
     {
-        return;
+        return false;
     }
     if (!ConsumeStamina(ParryStaminaCost))
     {
-        return;
+        return false;
     }
     AttackCooldown = 0.42f;
     ParryStartupTimer = 0.08f;
     ParryWindowTimer = 0.0f;
-    TriggerPresentation(HeavyAttackSound, nullptr, GetActorLocation(), 0.45f);
+    ParryLatencyProbeId = ActingLatencyProbeId;
+    TriggerPresentation(HeavyAttackSound.Get(), nullptr, GetActorLocation(), 0.45f, ENazareneCombatAudioCategory::Guard);
+    return true;
 }
 
-void ANazarenePlayerCharacter::TryHealingMiracle()
+bool ANazarenePlayerCharacter::TryHealingMiracle()
 {
     if (bBabyIntroMode || !bCombatEnabled)
     {
-        return;
+        return false;
     }
 
     if (AbilitySystemComponent != nullptr)
@@ -1589,16 +1937,19 @@ void ANazarenePlayerCharacter::TryHealingMiracle()
             }
             HealCooldownTimer = HealCooldown;
             AttackCooldown = FMath::Max(AttackCooldown, 0.35f);
-            TriggerPresentation(MiracleSound, MiracleVFX, GetActorLocation());
+            UNazareneInputLatencySubsystem::Acted(this, ActingLatencyProbeId);
+            TriggerPresentation(MiracleSound.Get(), MiracleVFX, GetActorLocation(), 1.0f, ENazareneCombatAudioCategory::Miracle);
+            return true;
         }
     }
+    return false;
 }
 
-void ANazarenePlayerCharacter::TryBlessingMiracle()
+bool ANazarenePlayerCharacter::TryBlessingMiracle()
 {
     if (bBabyIntroMode || !bCombatEnabled)
     {
-        return;
+        return false;
     }
 
     if (AbilitySystemComponent != nullptr)
@@ -1614,16 +1965,19 @@ void ANazarenePlayerCharacter::TryBlessingMiracle()
             BlessingTimer = BlessingDuration;
             BlessingCooldownTimer = BlessingCooldown;
             AttackCooldown = FMath::Max(AttackCooldown, 0.35f);
-            TriggerPresentation(MiracleSound, MiracleVFX, GetActorLocation());
+            UNazareneInputLatencySubsystem::Acted(this, ActingLatencyProbeId);
+            TriggerPresentation(MiracleSound.Get(), MiracleVFX, GetActorLocation(), 1.0f, ENazareneCombatAudioCategory::Miracle);
+            return true;
         }
     }
+    return false;
 }
 
-void ANazarenePlayerCharacter::TryRadianceMiracle()
+bool ANazarenePlayerCharacter::TryRadianceMiracle()
 {
     if (bBabyIntroMode || !bCombatEnabled)
     {
-        return;
+        return false;
     }
 
     if (AbilitySystemComponent != nullptr)
@@ -1638,9 +1992,12 @@ void ANazarenePlayerCharacter::TryRadianceMiracle()
             }
             RadianceCooldownTimer = RadianceCooldown;
             AttackCooldown = FMath::Max(AttackCooldown, 0.45f);
-            TriggerPresentation(MiracleSound, MiracleVFX, GetActorLocation());
+            UNazareneInputLatencySubsystem::Acted(this, ActingLatencyProbeId);
+            TriggerPresentation(MiracleSound.Get(), MiracleVFX, GetActorLocation(), 1.0f, ENazareneCombatAudioCategory::Miracle);
+            return true;
         }
     }
+    return false;
 }
 
 void ANazarenePlayerCharacter::TrySaveSlot1()
@@ -1717,6 +2074,8 @@ void ANazarenePlayerCharacter::UpdateTimers(float DeltaSeconds)
         if (ParryStartupTimer <= 0.0f)
         {
             ParryWindowTimer = 0.23f;
+            UNazareneInputLatencySubsystem::Acted(this, ParryLatencyProbeId);
+            ParryLatencyProbeId = 0;
         }
     }
     else
@@ -1744,105 +2103,77 @@ void ANazarenePlayerCharacter::RegenStamina(float DeltaSeconds)
     }
 }
 
-void ANazarenePlayerCharacter::ResolvePendingAttack()
+void ANazarenePlayerCharacter::BeginAttackSwing()
 {
-    ANazareneEnemyCharacter* Enemy = nullptr;
-    if (PendingAttack == ENazarenePlayerAttackType::Light)
+    if (PendingAttack == ENazarenePlayerAttackType::None)
     {
-        Enemy = FindAttackTarget(LightAttackRange, 70.0f);
+        return;
     }
-    else if (PendingAttack == ENazarenePlayerAttackType::Heavy)
+
+    bAttackResolved = true;
+    SwingAttackType = PendingAttack;
+    if (WeaponTrace == nullptr)
     {
-        Enemy = FindAttackTarget(HeavyAttackRange, 80.0f);
+        return;
     }
-    else
+
+    const bool bHeavy = (PendingAttack == ENazarenePlayerAttackType::Heavy);
+    FNazareneWeaponSwingProfile Profile;
+    Profile.Reach = bHeavy ? HeavyAttackRange : LightAttackRange;
+    Profile.ArcDegrees = bHeavy ? HeavyAttackArcDegrees : LightAttackArcDegrees;
+    Profile.Duration = AttackActiveTimer;
+    Profile.Radius = AttackTraceRadius;
+    Profile.MaxTargets = bHeavy ? HeavyAttackMaxTargets : LightAttackMaxTargets;
+    Profile.TargetClass = ANazareneEnemyCharacter::StaticClass();
+    WeaponTrace->BeginSwing(Profile);
+
+    // The lock target takes the swing's first hit even if the blade would reach another enemy first.
+    if (LockTarget.IsValid() && !LockTarget->IsRedeemed()
+        && FVector::Dist2D(GetActorLocation(), LockTarget->GetActorLocation()) <= Profile.Reach + LockTargetReachLeniency)
     {
-        return;
+        WeaponTrace->ReportHit(LockTarget.Get());
     }
+}
 
-    bAttackResolved = true;
-    if (Enemy == nullptr)
+void ANazarenePlayerCharacter::HandleWeaponHit(AActor* HitActor, const FHitResult& Hit)
+{
+    ANazareneEnemyCharacter* Enemy = Cast<ANazareneEnemyCharacter>(HitActor);
+    if (Enemy == nullptr || Enemy->IsRedeemed() || IsDefeated())
     {
         return;
     }
 
-    if (PendingAttack == ENazarenePlayerAttackType::Light)
+    ApplyAttackHit(Enemy, SwingAttackType);
+}
+
+void ANazarenePlayerCharacter::ApplyAttackHit(ANazareneEnemyCharacter* Enemy, ENazarenePlayerAttackType AttackType)
+{
+    if (AttackType == ENazarenePlayerAttackType::Light)
     {
         if (Enemy->IsParried())
         {
             Enemy->ReceiveRiposte(HeavyAttackDamage * 1.08f, this);
-            DisplayDamageNumber(Enemy->GetActorLocation() + FVector(0.0f, 0.0f, 130.0f), HeavyAttackDamage * 1.08f, ENazareneDamageNumberType::Critical);
         }
         else
         {
             Enemy->ReceiveCombatHit(LightAttackDamage, LightAttackPoiseDamage, this);
             AddFaith(1.0f);
-            DisplayDamageNumber(Enemy->GetActorLocation() + FVector(0.0f, 0.0f, 130.0f), LightAttackDamage, ENazareneDamageNumberType::Normal);
         }
     }
-    else
+    else if (AttackType == ENazarenePlayerAttackType::Heavy)
     {
         if (Enemy->IsParried())
         {
             Enemy->ReceiveRiposte(HeavyAttackDamage * 1.5f, this);
-            DisplayDamageNumber(Enemy->GetActorLocation() + FVector(0.0f, 0.0f, 130.0f), HeavyAttackDamage * 1.5f, ENazareneDamageNumberType::Critical);
         }
         else
         {
             Enemy->ReceiveCombatHit(HeavyAttackDamage, HeavyAttackPoiseDamage, this);
             AddFaith(1.5f);
-            DisplayDamageNumber(Enemy->GetActorLocation() + FVector(0.0f, 0.0f, 130.0f), HeavyAttackDamage, ENazareneDamageNumberType::Normal);
         }
     }
 }
 
-ANazareneEnemyCharacter* ANazarenePlayerCharacter::FindAttackTarget(float MaxDistance, float ArcDegrees) const
-{
-    if (LockTarget.IsValid() && !LockTarget->IsRedeemed())
-    {
-        const float Dist = FVector::Dist2D(GetActorLocation(), LockTarget->GetActorLocation());
-        if (Dist <= MaxDistance + 70.0f)
-        {
-            return LockTarget.Get();
-        }
-    }
-
-    ANazareneEnemyCharacter* BestTarget = nullptr;
-    float BestDistance = FLT_MAX;
-    const FVector Forward = GetActorForwardVector().GetSafeNormal2D();
-
-    for (TActorIterator<ANazareneEnemyCharacter> It(GetWorld()); It; ++It)
-    {
-        ANazareneEnemyCharacter* Enemy = *It;
-        if (Enemy == nullptr || Enemy->IsRedeemed())
-        {
-            continue;
-        }
-
-        FVector ToEnemy = Enemy->GetActorLocation() - GetActorLocation();
-        ToEnemy.Z = 0.0f;
-        const float Dist = ToEnemy.Size();
-        if (Dist <= 0.1f || Dist > MaxDistance)
-        {
-            continue;
-        }
-
-        const float Dot = FVector::DotProduct(Forward, ToEnemy.GetSafeNormal());
-        const float Angle = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(Dot, -1.0f, 1.0f)));
-        if (Angle > ArcDegrees * 0.5f)
-        {
-            continue;
-        }
-
-        if (Dist < BestDistance)
-        {
-            BestDistance = Dist;
-            BestTarget = Enemy;
-        }
-    }
-    return BestTarget;
-}
-
 void ANazarenePlayerCharacter::ValidateLockTarget()
 {
     if (!LockTarget.IsValid())
@@ -1886,7 +2217,7 @@ bool ANazarenePlayerCharacter::ConsumeStamina(float Cost)
     return true;
 }
 
-void ANazarenePlayerCharacter::ApplyHealthDamage(float Amount)
+void ANazarenePlayerCharacter::ApplyHealthDamage(float Amount, AActor* DamageSource)
 {
     CurrentHealth = FMath::Max(0.0f, CurrentHealth - Amount);
     if (AttributeSet != nullptr)
@@ -1894,7 +2225,12 @@ void ANazarenePlayerCharacter::ApplyHealthDamage(float Amount)
         AttributeSet->SetHealth(CurrentHealth);
     }
     HurtTimer = 0.22f;
-    TriggerPresentation(HurtSound, HurtVFX, GetActorLocation());
+
+    FNazareneCombatEvent HurtEvent = FNazareneCombatEvent::Make(ENazareneCombatEventType::Hit, this, DamageSource);
+    HurtEvent.Amount = Amount;
+    HurtEvent.Sound = HurtSound.Get();
+    HurtEvent.Effect = HurtVFX;
+    UNazareneCombatEventSubsystem::Publish(this, HurtEvent);
     if (CurrentHealth <= 0.01f)
     {
         HandleDefeat();
@@ -2065,11 +2401,11 @@ void ANazarenePlayerCharacter::UpdateCameraState(float DeltaSeconds)
         FMath::Max(0.01f, CameraFOVInterpSpeed)));
 }
 
-void ANazarenePlayerCharacter::TriggerPresentation(USoundBase* Sound, UNiagaraSystem* Effect, const FVector& Location, float VolumeMultiplier) const
+void ANazarenePlayerCharacter::TriggerPresentation(USoundBase* Sound, UNiagaraSystem* Effect, const FVector& Location, float VolumeMultiplier, ENazareneCombatAudioCategory AudioCategory) const
 {
     if (Sound != nullptr)
     {
-        UGameplayStatics::PlaySoundAtLocation(this, Sound, GetActorLocation(), FRotator::ZeroRotator, VolumeMultiplier);
+        UNazareneCombatAudioSubsystem::Request(this, Sound, GetActorLocation(), VolumeMultiplier, AudioCategory);
     }
 
     if (Effect != nullptr && GetWorld() != nullptr)
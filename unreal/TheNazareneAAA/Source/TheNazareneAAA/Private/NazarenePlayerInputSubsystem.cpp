@@ -0,0 +1,20 @@
+#include "NazarenePlayerInputSubsystem.h"
+
+#include "InputAction.h"
+#include "InputMappingContext.h"
+
+void UNazarenePlayerInputSubsystem::Deinitialize()
+{
+    SharedInputs.Reset();
+    Super::Deinitialize();
+}
+
+const FNazareneSharedPlayerInput* UNazarenePlayerInputSubsystem::FindSharedInput(const FSoftObjectPath& ContextPath) const
+{
+    return SharedInputs.Find(ContextPath);
+}
+
+void UNazarenePlayerInputSubsystem::AddSharedInput(const FSoftObjectPath& ContextPath, const FNazareneSharedPlayerInput& Input)
+{
+    SharedInputs.Add(ContextPath, Input);
+}
@@ -0,0 +1,15 @@
+#include "NazareneProfiling.h"
+
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+FString NazareneProfiling::ResolveReportPath(const TCHAR* CommandLineKey, const TCHAR* DefaultPrefix)
+{
+    FString FilePath;
+    if (!FParse::Value(FCommandLine::Get(), CommandLineKey, FilePath))
+    {
+        FilePath = FString::Printf(TEXT("%s_%s.csv"), DefaultPrefix, *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+    }
+    return FPaths::IsRelative(FilePath) ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Profiling"), FilePath) : FilePath;
+}
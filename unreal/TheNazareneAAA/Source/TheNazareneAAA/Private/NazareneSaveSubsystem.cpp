@@ -1,10 +1,12 @@
 #include "NazareneSaveSubsystem.h"
 
 #include "Kismet/GameplayStatics.h"
+#include "NazareneMemoryTags.h"
 #include "NazareneSaveGame.h"
 
 bool UNazareneSaveSubsystem::SavePayloadToSlot(int32 SlotId, const FNazareneSavePayload& Payload)
 {
+    LLM_SCOPE_BYTAG(Nazarene_Save);
     if (SlotId < 1)
     {
         return false;
@@ -26,6 +28,7 @@ bool UNazareneSaveSubsystem::SavePayloadToSlot(int32 SlotId, const FNazareneSave
 
 bool UNazareneSaveSubsystem::LoadPayloadFromSlot(int32 SlotId, FNazareneSavePayload& OutPayload) const
 {
+    LLM_SCOPE_BYTAG(Nazarene_Save);
     OutPayload = FNazareneSavePayload();
     if (SlotId < 1)
     {
@@ -86,6 +89,7 @@ FString UNazareneSaveSubsystem::GetSlotSummary(int32 SlotId) const
 
 bool UNazareneSaveSubsystem::SaveCheckpoint(const FNazareneSavePayload& Payload)
 {
+    LLM_SCOPE_BYTAG(Nazarene_Save);
     UNazareneSaveGame* SaveGame = Cast<UNazareneSaveGame>(UGameplayStatics::CreateSaveGameObject(UNazareneSaveGame::StaticClass()));
     if (SaveGame == nullptr)
     {
@@ -102,6 +106,7 @@ bool UNazareneSaveSubsystem::SaveCheckpoint(const FNazareneSavePayload& Payload)
 
 bool UNazareneSaveSubsystem::LoadCheckpoint(FNazareneSavePayload& OutPayload) const
 {
+    LLM_SCOPE_BYTAG(Nazarene_Save);
     OutPayload = FNazareneSavePayload();
     if (!UGameplayStatics::DoesSaveGameExist(CheckpointSlotName(), 0))
     {
@@ -6,11 +6,13 @@
 #include "Misc/App.h"
 #include "NazarenePlayerCharacter.h"
 #include "NazareneSettingsSaveGame.h"
+#include "NazareneStartupProfiler.h"
 
 void UNazareneSettingsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
 
+    FNazareneStartupScope StartupScope(TEXT("Settings.Initialize"));
     LoadSettings();
     ApplySettings();
 }
@@ -1,5 +1,9 @@
 #include "NazareneSkillTree.h"
 
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "NazareneSkillTreeSubsystem.h"
+
 namespace
 {
     static TMap<FName, FNazareneSkillDefinition> BuildSkillDefinitionTable()
@@ -114,3 +118,98 @@ TArray<FName> UNazareneSkillTree::GetBranchSkills(ENazareneSkillBranch Branch)
     }
     return SkillIds;
 }
+
+FNazareneCompiledSkillModifiers::FNazareneCompiledSkillModifiers()
+{
+    for (int32 Index = 0; Index < static_cast<int32>(ENazarenePlayerStat::Count); ++Index)
+    {
+        Multipliers[Index] = 1.0f;
+        Additives[Index] = 0.0f;
+    }
+}
+
+TMap<FName, TArray<FNazareneSkillModifierRow>> UNazareneSkillTree::BuildModifierRows(const UDataTable* OverrideTable)
+{
+    TMap<FName, TArray<FNazareneSkillModifierRow>> Modifiers;
+
+    auto AddModifier = [&Modifiers](const TCHAR* SkillId, ENazarenePlayerStat Stat, float Multiplier, float Additive)
+    {
+        FNazareneSkillModifierRow Row;
+        Row.SkillId = FName(SkillId);
+        Row.Stat = Stat;
+        Row.Multiplier = Multiplier;
+        Row.Additive = Additive;
+        Modifiers.FindOrAdd(Row.SkillId).Add(Row);
+    };
+
+    AddModifier(TEXT("combat_smite"), ENazarenePlayerStat::LightAttackDamage, 1.1f, 0.0f);
+    AddModifier(TEXT("combat_smite"), ENazarenePlayerStat::HeavyAttackDamage, 1.1f, 0.0f);
+    AddModifier(TEXT("combat_crusader"), ENazarenePlayerStat::HeavyAttackPoiseDamage, 1.12f, 0.0f);
+    AddModifier(TEXT("combat_crusader"), ENazarenePlayerStat::HeavyAttackRange, 1.0f, 40.0f);
+
+    AddModifier(TEXT("movement_pilgrim_stride"), ENazarenePlayerStat::WalkSpeed, 1.12f, 0.0f);
+    AddModifier(TEXT("movement_swift_vow"), ENazarenePlayerStat::DodgeStaminaCost, 0.82f, 0.0f);
+
+    AddModifier(TEXT("miracles_abundance"), ENazarenePlayerStat::HealAmount, 1.18f, 0.0f);
+    AddModifier(TEXT("miracles_radiance_lance"), ENazarenePlayerStat::RadianceDamage, 1.2f, 0.0f);
+    AddModifier(TEXT("miracles_radiance_lance"), ENazarenePlayerStat::RadianceRadius, 1.0f, 120.0f);
+
+    AddModifier(TEXT("defense_shepherd_guard"), ENazarenePlayerStat::MaxHealth, 1.0f, 14.0f);
+    AddModifier(TEXT("defense_steadfast"), ENazarenePlayerStat::MaxStamina, 1.0f, 18.0f);
+    AddModifier(TEXT("defense_steadfast"), ENazarenePlayerStat::StaminaRegen, 1.15f, 0.0f);
+
+    // Designers tune through the data table; any skill it lists replaces the built-in rows above.
+    if (OverrideTable != nullptr && OverrideTable->GetRowStruct() == FNazareneSkillModifierRow::StaticStruct())
+    {
+        TSet<FName> OverriddenSkills;
+        OverrideTable->ForeachRow<FNazareneSkillModifierRow>(TEXT("BuildModifierRows"), [&Modifiers, &OverriddenSkills](const FName&, const FNazareneSkillModifierRow& Row)
+        {
+            if (Row.Stat >= ENazarenePlayerStat::Count)
+            {
+                return;
+            }
+            if (!OverriddenSkills.Contains(Row.SkillId))
+            {
+                OverriddenSkills.Add(Row.SkillId);
+                Modifiers.FindOrAdd(Row.SkillId).Reset();
+            }
+            Modifiers.FindOrAdd(Row.SkillId).Add(Row);
+        });
+    }
+
+    return Modifiers;
+}
+
+FNazareneCompiledSkillModifiers UNazareneSkillTree::CompileModifiers(const UObject* WorldContextObject, const TArray<FName>& UnlockedSkills)
+{
+    const UWorld* World = WorldContextObject != nullptr ? WorldContextObject->GetWorld() : nullptr;
+    const UGameInstance* GameInstance = World != nullptr ? World->GetGameInstance() : nullptr;
+    if (const UNazareneSkillTreeSubsystem* SkillTree = GameInstance != nullptr ? GameInstance->GetSubsystem<UNazareneSkillTreeSubsystem>() : nullptr)
+    {
+        return CompileModifiers(SkillTree->GetModifierRows(), UnlockedSkills);
+    }
+
+    // No game instance (editor previews): built-in rows only, without loading the table.
+    return CompileModifiers(BuildModifierRows(nullptr), UnlockedSkills);
+}
+
+FNazareneCompiledSkillModifiers UNazareneSkillTree::CompileModifiers(const TMap<FName, TArray<FNazareneSkillModifierRow>>& ModifierRows, const TArray<FName>& UnlockedSkills)
+{
+    FNazareneCompiledSkillModifiers Compiled;
+    for (const FName SkillId : UnlockedSkills)
+    {
+        const TArray<FNazareneSkillModifierRow>* Rows = ModifierRows.Find(SkillId);
+        if (Rows == nullptr)
+        {
+            continue;
+        }
+
+        for (const FNazareneSkillModifierRow& Row : *Rows)
+        {
+            const int32 Index = static_cast<int32>(Row.Stat);
+            Compiled.Multipliers[Index] *= Row.Multiplier;
+            Compiled.Additives[Index] += Row.Additive;
+        }
+    }
+    return Compiled;
+}
@@ -0,0 +1,26 @@
+#include "NazareneSkillTreeSubsystem.h"
+
+#include "Engine/DataTable.h"
+#include "Misc/PackageName.h"
+#include "NazareneAssetResolver.h"
+
+void UNazareneSkillTreeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    const FString TablePath = NazareneAssetResolver::ResolveObjectPath(
+        TEXT("SkillModifierTable"),
+        TEXT("/Game/Data/DT_SkillModifiers.DT_SkillModifiers"),
+        {});
+    // The resolver hands back the default path even when no such asset exists; the table is optional, so skip the load quietly.
+    const bool bTableExists = !TablePath.IsEmpty() && FPackageName::DoesPackageExist(FPackageName::ObjectPathToPackageName(TablePath));
+    ModifierTable = bTableExists ? LoadObject<UDataTable>(nullptr, *TablePath) : nullptr;
+    ModifierRows = UNazareneSkillTree::BuildModifierRows(ModifierTable);
+}
+
+void UNazareneSkillTreeSubsystem::Deinitialize()
+{
+    ModifierRows.Reset();
+    ModifierTable = nullptr;
+    Super::Deinitialize();
+}
@@ -0,0 +1,202 @@
+#include "NazareneStartupProfiler.h"
+
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "NazareneProfiling.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+    struct FStartupPhase
+    {
+        FString Name;
+        int32 Depth = 0;
+        double StartSeconds = 0.0;
+        double EndSeconds = 0.0;
+        TArray<FString> SyncLoads;
+    };
+
+    enum class EProfilerState : uint8
+    {
+        Unstarted,
+        Recording,
+        Finished,
+        Disabled
+    };
+
+    struct FStartupTimeline
+    {
+        EProfilerState State = EProfilerState::Unstarted;
+        double FirstPhaseSeconds = 0.0;
+        TArray<FStartupPhase> Phases;
+        TArray<int32> OpenPhases;
+        /** Loads that happened while no phase was open; they still count against boot. */
+        TArray<FString> UnscopedSyncLoads;
+        FDelegateHandle SyncLoadHandle;
+    };
+
+    FStartupTimeline& Timeline()
+    {
+        static FStartupTimeline Instance;
+        return Instance;
+    }
+
+    double SinceLaunchMs(double Seconds)
+    {
+        return (Seconds - GStartTime) * 1000.0;
+    }
+
+    void HandleSyncLoad(const FString& PackageName)
+    {
+        FStartupTimeline& Data = Timeline();
+        if (Data.State != EProfilerState::Recording || !IsInGameThread())
+        {
+            return;
+        }
+
+        if (Data.OpenPhases.Num() > 0)
+        {
+            Data.Phases[Data.OpenPhases.Last()].SyncLoads.Add(PackageName);
+        }
+        else
+        {
+            Data.UnscopedSyncLoads.Add(PackageName);
+        }
+    }
+
+    bool EnsureRecording()
+    {
+        FStartupTimeline& Data = Timeline();
+        if (Data.State == EProfilerState::Unstarted)
+        {
+            const bool bEnabled = !UE_BUILD_SHIPPING && !FParse::Param(FCommandLine::Get(), TEXT("NoNazareneStartupProfile"));
+            Data.State = bEnabled ? EProfilerState::Recording : EProfilerState::Disabled;
+            if (bEnabled)
+            {
+                Data.FirstPhaseSeconds = FPlatformTime::Seconds();
+                Data.SyncLoadHandle = FCoreUObjectDelegates::OnSyncLoadPackage.AddStatic(&HandleSyncLoad);
+            }
+        }
+        return Data.State == EProfilerState::Recording;
+    }
+
+    FString CsvField(const FString& Value)
+    {
+        return FString::Printf(TEXT("\"%s\""), *Value.Replace(TEXT("\""), TEXT("\"\"")));
+    }
+
+    void WriteReport(const FStartupTimeline& Data, double InteractiveSeconds)
+    {
+        int32 TotalSyncLoads = Data.UnscopedSyncLoads.Num();
+        for (const FStartupPhase& Phase : Data.Phases)
+        {
+            TotalSyncLoads += Phase.SyncLoads.Num();
+        }
+
+        // Phases all run on the game thread, so start order is the critical path; depth shows nesting.
+        FString Csv = TEXT("Phase,Depth,StartMs,WallMs,SyncLoads,Assets");
+        Csv += LINE_TERMINATOR;
+        for (const FStartupPhase& Phase : Data.Phases)
+        {
+            const double WallMs = (Phase.EndSeconds - Phase.StartSeconds) * 1000.0;
+            Csv += FString::Printf(TEXT("%s,%d,%.3f,%.3f,%d,%s"), *CsvField(Phase.Name), Phase.Depth, SinceLaunchMs(Phase.StartSeconds), WallMs, Phase.SyncLoads.Num(), *CsvField(FString::Join(Phase.SyncLoads, TEXT(";"))));
+            Csv += LINE_TERMINATOR;
+
+            UE_LOG(LogTemp, Log, TEXT("Startup %s%-32s start %9.1f ms  wall %8.2f ms  sync loads %d"),
+                *FString::ChrN(Phase.Depth * 2, TEXT(' ')), *Phase.Name, SinceLaunchMs(Phase.StartSeconds), WallMs, Phase.SyncLoads.Num());
+            for (const FString& Asset : Phase.SyncLoads)
+            {
+                UE_LOG(LogTemp, Log, TEXT("Startup %s    sync load %s"), *FString::ChrN(Phase.Depth * 2, TEXT(' ')), *Asset);
+            }
+        }
+        Csv += FString::Printf(TEXT("%s,0,0.000,0.000,%d,%s"), *CsvField(TEXT("(unscoped)")), Data.UnscopedSyncLoads.Num(), *CsvField(FString::Join(Data.UnscopedSyncLoads, TEXT(";"))));
+        Csv += LINE_TERMINATOR;
+        Csv += FString::Printf(TEXT("%s,0,%.3f,0.000,%d,"), *CsvField(TEXT("Interactive")), SinceLaunchMs(InteractiveSeconds), TotalSyncLoads);
+        Csv += LINE_TERMINATOR;
+
+        UE_LOG(
+            LogTemp,
+            Display,
+            TEXT("StartupReport: interactive_ms=%.3f engine_init_ms=%.3f game_ms=%.3f sync_loads=%d unscoped_sync_loads=%d"),
+            SinceLaunchMs(InteractiveSeconds),
+            SinceLaunchMs(Data.FirstPhaseSeconds),
+            (InteractiveSeconds - Data.FirstPhaseSeconds) * 1000.0,
+            TotalSyncLoads,
+            Data.UnscopedSyncLoads.Num()
+        );
+
+        const FString FilePath = NazareneProfiling::ResolveReportPath(TEXT("NazareneStartupCsv="), TEXT("Startup"));
+        if (FFileHelper::SaveStringToFile(Csv, *FilePath))
+        {
+            UE_LOG(LogTemp, Log, TEXT("Startup report saved: %s"), *FilePath);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Failed to write startup report: %s"), *FilePath);
+        }
+    }
+}
+
+void NazareneStartupProfiler::BeginPhase(const TCHAR* PhaseName)
+{
+    if (!IsInGameThread() || !EnsureRecording())
+    {
+        return;
+    }
+
+    FStartupTimeline& Data = Timeline();
+    FStartupPhase& Phase = Data.Phases.AddDefaulted_GetRef();
+    Phase.Name = PhaseName;
+    Phase.Depth = Data.OpenPhases.Num();
+    Phase.StartSeconds = FPlatformTime::Seconds();
+    Data.OpenPhases.Add(Data.Phases.Num() - 1);
+}
+
+void NazareneStartupProfiler::EndPhase()
+{
+    FStartupTimeline& Data = Timeline();
+    if (!IsInGameThread() || Data.State != EProfilerState::Recording || Data.OpenPhases.Num() == 0)
+    {
+        return;
+    }
+
+    Data.Phases[Data.OpenPhases.Pop()].EndSeconds = FPlatformTime::Seconds();
+}
+
+void NazareneStartupProfiler::MarkInteractive()
+{
+    FStartupTimeline& Data = Timeline();
+    if (Data.State == EProfilerState::Finished)
+    {
+        return;
+    }
+
+    if (Data.State == EProfilerState::Recording)
+    {
+        const double InteractiveSeconds = FPlatformTime::Seconds();
+        for (const int32 OpenIndex : Data.OpenPhases)
+        {
+            Data.Phases[OpenIndex].EndSeconds = InteractiveSeconds;
+        }
+        Data.OpenPhases.Reset();
+        FCoreUObjectDelegates::OnSyncLoadPackage.Remove(Data.SyncLoadHandle);
+
+        WriteReport(Data, InteractiveSeconds);
+    }
+    // Finished even when profiling is disabled, so -NazareneStartupQuit still exits exactly once.
+    Data.State = EProfilerState::Finished;
+
+    if (FParse::Param(FCommandLine::Get(), TEXT("NazareneStartupQuit")))
+    {
+        FPlatformMisc::RequestExit(false);
+    }
+}
+
+bool NazareneStartupProfiler::IsRecording()
+{
+    return Timeline().State == EProfilerState::Recording;
+}
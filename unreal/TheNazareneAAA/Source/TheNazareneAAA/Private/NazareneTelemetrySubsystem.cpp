@@ -0,0 +1,351 @@
+#include "NazareneTelemetrySubsystem.h"
+
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "NazareneCombatEventSubsystem.h"
+#include "NazareneEnemyCharacter.h"
+#include "NazarenePlayerCharacter.h"
+#include <atomic>
+
+namespace
+{
+    constexpr uint32 TelemetryMagic = 0x4C545A4E; // "NZTL"
+    constexpr uint16 TelemetryVersion = 1;
+    constexpr int64 TelemetryHeaderSize = 64;
+    constexpr uint32 TelemetryQueueSize = 16384;
+
+    /** Mirrors the header struct in Tools/read_combat_telemetry.py. */
+    struct FTelemetryFileHeader
+    {
+        uint32 Magic = TelemetryMagic;
+        uint16 Version = TelemetryVersion;
+        uint16 RecordSize = sizeof(FNazareneTelemetryRecord);
+        uint32 Capacity = 0;
+        int32 Seed = 0;
+        uint64 TotalWritten = 0;
+        uint64 Dropped = 0;
+        int64 StartUnixSeconds = 0;
+        uint8 Reserved[24] = {};
+    };
+    static_assert(sizeof(FTelemetryFileHeader) == TelemetryHeaderSize, "Telemetry header is fixed at 64 bytes.");
+
+    static uint32 ArchetypeOf(const TWeakObjectPtr<AActor>& Actor)
+    {
+        const ANazareneEnemyCharacter* Enemy = Cast<ANazareneEnemyCharacter>(Actor.Get());
+        return Enemy != nullptr ? static_cast<uint32>(Enemy->Archetype) : UNazareneTelemetrySubsystem::NoArchetype;
+    }
+}
+
+/** Drains the record queue into the ring file; the game thread never touches the file handle. */
+class FNazareneTelemetryWriter : public FRunnable
+{
+public:
+    FNazareneTelemetryWriter(TCircularQueue<FNazareneTelemetryRecord>& InQueue, IFileHandle* InFile, uint32 InCapacity)
+        : Queue(InQueue)
+        , File(InFile)
+        , WakeEvent(FPlatformProcess::GetSynchEventFromPool(false))
+    {
+        Header.Capacity = InCapacity;
+        Header.StartUnixSeconds = FDateTime::UtcNow().ToUnixTimestamp();
+        Staging.Reserve(TelemetryQueueSize);
+        Thread = FRunnableThread::Create(this, TEXT("NazareneTelemetryWriter"), 0, TPri_BelowNormal);
+    }
+
+    virtual ~FNazareneTelemetryWriter() override
+    {
+        if (Thread != nullptr)
+        {
+            Thread->Kill(true);
+            delete Thread;
+        }
+        FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+        delete File;
+    }
+
+    virtual uint32 Run() override
+    {
+        Preallocate();
+        while (!bStopping.load(std::memory_order_acquire))
+        {
+            WakeEvent->Wait(50);
+            Drain();
+        }
+        Drain();
+        File->Flush();
+        return 0;
+    }
+
+    virtual void Stop() override
+    {
+        bStopping.store(true, std::memory_order_release);
+        WakeEvent->Trigger();
+    }
+
+    void NoteDropped() { Dropped.fetch_add(1, std::memory_order_relaxed); }
+    void SetSeed(int32 Seed) { PendingSeed.store(Seed, std::memory_order_relaxed); }
+
+private:
+    void Preallocate()
+    {
+        // Reserve the whole ring up front so steady-state writes never grow the file.
+        TArray<uint8> Zeroes;
+        Zeroes.SetNumZeroed(64 * 1024);
+        int64 Remaining = static_cast<int64>(Header.Capacity) * sizeof(FNazareneTelemetryRecord);
+        File->Seek(TelemetryHeaderSize);
+        while (Remaining > 0)
+        {
+            const int64 Chunk = FMath::Min<int64>(Remaining, Zeroes.Num());
+            File->Write(Zeroes.GetData(), Chunk);
+            Remaining -= Chunk;
+        }
+        WriteHeader();
+    }
+
+    void Drain()
+    {
+        Staging.Reset();
+        FNazareneTelemetryRecord Record;
+        while (Queue.Dequeue(Record))
+        {
+            Staging.Add(Record);
+        }
+        if (Staging.Num() == 0)
+        {
+            return;
+        }
+
+        int32 Offset = 0;
+        while (Offset < Staging.Num())
+        {
+            const uint32 Slot = static_cast<uint32>(Header.TotalWritten % Header.Capacity);
+            const int32 Count = FMath::Min<int32>(Staging.Num() - Offset, static_cast<int32>(Header.Capacity - Slot));
+            File->Seek(TelemetryHeaderSize + static_cast<int64>(Slot) * sizeof(FNazareneTelemetryRecord));
+            File->Write(reinterpret_cast<const uint8*>(Staging.GetData() + Offset), static_cast<int64>(Count) * sizeof(FNazareneTelemetryRecord));
+            Offset += Count;
+            Header.TotalWritten += Count;
+        }
+        WriteHeader();
+    }
+
+    void WriteHeader()
+    {
+        Header.Seed = PendingSeed.load(std::memory_order_relaxed);
+        Header.Dropped = Dropped.load(std::memory_order_relaxed);
+        File->Seek(0);
+        File->Write(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+    }
+
+    TCircularQueue<FNazareneTelemetryRecord>& Queue;
+    IFileHandle* File = nullptr;
+    FEvent* WakeEvent = nullptr;
+    FRunnableThread* Thread = nullptr;
+    FTelemetryFileHeader Header;
+    TArray<FNazareneTelemetryRecord> Staging;
+    std::atomic<bool> bStopping{false};
+    std::atomic<uint64> Dropped{0};
+    std::atomic<int32> PendingSeed{0};
+};
+
+UNazareneTelemetrySubsystem::UNazareneTelemetrySubsystem() = default;
+UNazareneTelemetrySubsystem::~UNazareneTelemetrySubsystem() = default;
+
+void UNazareneTelemetrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    bool bEnabled = !UE_BUILD_SHIPPING && !FParse::Param(FCommandLine::Get(), TEXT("NoNazareneTelemetry"));
+    bEnabled |= FParse::Param(FCommandLine::Get(), TEXT("NazareneTelemetry"));
+    if (!bEnabled || IsTemplate() || !FPlatformProcess::SupportsMultithreading())
+    {
+        return;
+    }
+
+    const FString Directory = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Telemetry"));
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    PlatformFile.CreateDirectoryTree(*Directory);
+    TelemetryFilePath = FPaths::Combine(Directory, FString::Printf(TEXT("Combat_%s.nztl"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"))));
+
+    IFileHandle* File = PlatformFile.OpenWrite(*TelemetryFilePath, false, true);
+    if (File == nullptr)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("NazareneTelemetry: could not open %s"), *TelemetryFilePath);
+        TelemetryFilePath.Reset();
+        return;
+    }
+
+    SessionStartSeconds = FPlatformTime::Seconds();
+    Queue = MakeUnique<TCircularQueue<FNazareneTelemetryRecord>>(TelemetryQueueSize);
+    Writer = MakeUnique<FNazareneTelemetryWriter>(*Queue, File, static_cast<uint32>(FMath::Max(1024, RingCapacity)));
+    Record(ENazareneTelemetryRecordType::SessionStart);
+    UE_LOG(LogTemp, Log, TEXT("NazareneTelemetry: recording to %s"), *TelemetryFilePath);
+}
+
+void UNazareneTelemetrySubsystem::Deinitialize()
+{
+    BindCombatEvents(nullptr);
+    // Destroying the writer stops its thread after a final drain.
+    Writer.Reset();
+    Queue.Reset();
+    Super::Deinitialize();
+}
+
+TStatId UNazareneTelemetrySubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UNazareneTelemetrySubsystem, STATGROUP_Tickables);
+}
+
+ETickableTickType UNazareneTelemetrySubsystem::GetTickableTickType() const
+{
+    return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+UWorld* UNazareneTelemetrySubsystem::GetTickableGameObjectWorld() const
+{
+    const UGameInstance* GameInstance = GetGameInstance();
+    return GameInstance != nullptr ? GameInstance->GetWorld() : nullptr;
+}
+
+void UNazareneTelemetrySubsystem::Tick(float DeltaTime)
+{
+    BindCombatEvents(GetTickableGameObjectWorld());
+
+    // Real frame time, not the dilated game delta.
+    const float FrameMilliseconds = static_cast<float>(FApp::GetDeltaTime() * 1000.0);
+    FrameSampleElapsed += static_cast<float>(FApp::GetDeltaTime());
+    FrameSampleWorstMs = FMath::Max(FrameSampleWorstMs, FrameMilliseconds);
+    ++FrameSampleCount;
+
+    if (FrameSampleElapsed >= FrameSampleInterval)
+    {
+        const float AverageMilliseconds = FrameSampleElapsed * 1000.0f / static_cast<float>(FrameSampleCount);
+        Record(ENazareneTelemetryRecordType::FrameSample, AverageMilliseconds, FrameSampleWorstMs, FrameSampleCount);
+        FrameSampleElapsed = 0.0f;
+        FrameSampleWorstMs = 0.0f;
+        FrameSampleCount = 0;
+    }
+}
+
+void UNazareneTelemetrySubsystem::Record(ENazareneTelemetryRecordType Type, float Value, float Aux, uint32 Subject, uint32 Flags)
+{
+    if (!Writer.IsValid())
+    {
+        return;
+    }
+    checkSlow(IsInGameThread());
+
+    FNazareneTelemetryRecord Entry;
+    Entry.TimeSeconds = FPlatformTime::Seconds() - SessionStartSeconds;
+    Entry.Frame = static_cast<uint32>(GFrameCounter);
+    Entry.Type = static_cast<uint16>(Type);
+    Entry.RegionIndex = CurrentRegion;
+    Entry.Value = Value;
+    Entry.Aux = Aux;
+    Entry.Subject = Subject;
+    Entry.Flags = Flags;
+
+    if (!Queue->Enqueue(Entry))
+    {
+        Writer->NoteDropped();
+    }
+}
+
+void UNazareneTelemetrySubsystem::RecordRegionEnter(int32 InRegionIndex, int32 RetryCount)
+{
+    CurrentRegion = static_cast<int16>(InRegionIndex);
+    RegionEnterSeconds = FPlatformTime::Seconds();
+    Record(ENazareneTelemetryRecordType::RegionEnter, 0.0f, 0.0f, static_cast<uint32>(InRegionIndex), static_cast<uint32>(RetryCount));
+}
+
+void UNazareneTelemetrySubsystem::RecordRegionComplete()
+{
+    const float RegionSeconds = static_cast<float>(FPlatformTime::Seconds() - RegionEnterSeconds);
+    Record(ENazareneTelemetryRecordType::RegionComplete, RegionSeconds, 0.0f, static_cast<uint32>(CurrentRegion));
+}
+
+void UNazareneTelemetrySubsystem::RecordPlayerDefeated(int32 RetryCount)
+{
+    const float RegionSeconds = static_cast<float>(FPlatformTime::Seconds() - RegionEnterSeconds);
+    Record(ENazareneTelemetryRecordType::PlayerDeath, RegionSeconds, 0.0f, LastDamageArchetype);
+    Record(ENazareneTelemetryRecordType::Retry, static_cast<float>(RetryCount));
+}
+
+void UNazareneTelemetrySubsystem::SetSessionSeed(int32 Seed)
+{
+    if (Writer.IsValid())
+    {
+        Writer->SetSeed(Seed);
+    }
+}
+
+void UNazareneTelemetrySubsystem::BindCombatEvents(UWorld* World)
+{
+    UNazareneCombatEventSubsystem* CombatEvents = World != nullptr ? World->GetSubsystem<UNazareneCombatEventSubsystem>() : nullptr;
+    if (CombatEvents == BoundCombatEvents.Get())
+    {
+        return;
+    }
+
+    if (UNazareneCombatEventSubsystem* Previous = BoundCombatEvents.Get())
+    {
+        Previous->OnEventsFlushed.Remove(CombatEventsHandle);
+    }
+    CombatEventsHandle.Reset();
+    BoundCombatEvents = CombatEvents;
+
+    if (CombatEvents != nullptr && IsRecording())
+    {
+        CombatEventsHandle = CombatEvents->OnEventsFlushed.AddUObject(this, &UNazareneTelemetrySubsystem::HandleCombatEvents);
+    }
+}
+
+void UNazareneTelemetrySubsystem::HandleCombatEvents(TConstArrayView<FNazareneCombatEvent> Events)
+{
+    for (const FNazareneCombatEvent& Event : Events)
+    {
+        switch (Event.Type)
+        {
+        case ENazareneCombatEventType::Hit:
+            if (Cast<ANazarenePlayerCharacter>(Event.Target.Get()) != nullptr)
+            {
+                LastDamageArchetype = ArchetypeOf(Event.Instigator);
+                Record(ENazareneTelemetryRecordType::PlayerHit, Event.Amount, static_cast<float>(Event.Count), LastDamageArchetype);
+            }
+            else
+            {
+                Record(ENazareneTelemetryRecordType::EnemyHit, Event.Amount, static_cast<float>(Event.Count), ArchetypeOf(Event.Target), static_cast<uint32>(Event.NumberType));
+            }
+            break;
+        case ENazareneCombatEventType::Block:
+        {
+            // Flags bit 0: the player blocked; otherwise an enemy shield blocked the player.
+            const bool bPlayerBlocked = Cast<ANazarenePlayerCharacter>(Event.Target.Get()) != nullptr;
+            Record(ENazareneTelemetryRecordType::Block, Event.Amount, static_cast<float>(Event.Count),
+                ArchetypeOf(bPlayerBlocked ? Event.Instigator : Event.Target), bPlayerBlocked ? 1u : 0u);
+            break;
+        }
+        case ENazareneCombatEventType::Parry:
+            Record(ENazareneTelemetryRecordType::Parry, 0.0f, static_cast<float>(Event.Count), ArchetypeOf(Event.Target));
+            break;
+        case ENazareneCombatEventType::PoiseBreak:
+            Record(ENazareneTelemetryRecordType::PoiseBreak, Event.Amount, static_cast<float>(Event.Count), ArchetypeOf(Event.Target));
+            break;
+        case ENazareneCombatEventType::Redeem:
+            Record(ENazareneTelemetryRecordType::EnemyRedeemed, Event.Amount, static_cast<float>(Event.Count), ArchetypeOf(Event.Target));
+            break;
+        case ENazareneCombatEventType::PhaseChange:
+            Record(ENazareneTelemetryRecordType::BossPhase, static_cast<float>(Event.Param), 0.0f, ArchetypeOf(Event.Target));
+            break;
+        default:
+            break;
+        }
+    }
+}
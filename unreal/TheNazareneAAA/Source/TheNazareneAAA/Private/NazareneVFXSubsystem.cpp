@@ -1,13 +1,35 @@
 #include "NazareneVFXSubsystem.h"
 
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "NazareneFrameBudgetSubsystem.h"
+#include "NazareneMemoryTags.h"
+#include "NazareneStartupProfiler.h"
+#include "NazareneStats.h"
 #include "NiagaraComponent.h"
 #include "NiagaraFunctionLibrary.h"
 #include "NiagaraSystem.h"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ambient VFX Placed"), STAT_NazareneAmbientPlaced, STATGROUP_NazareneScalability);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ambient VFX Active"), STAT_NazareneAmbientActive, STATGROUP_NazareneScalability);
+
+namespace
+{
+    struct FAmbientCandidate
+    {
+        int32 AnchorIndex = INDEX_NONE;
+        float Distance = 0.0f;
+    };
+}
+
 void UNazareneVFXSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
+    LLM_SCOPE_BYTAG(Nazarene_VFX);
     Super::Initialize(Collection);
 
+    FNazareneStartupScope StartupScope(TEXT("VFX.Initialize"));
+
     // Combat VFX systems
     HealBurstSystem = LoadObject<UNiagaraSystem>(nullptr, TEXT("/Game/Art/VFX/NS_HealBurst.NS_HealBurst"));
     BlessingAuraSystem = LoadObject<UNiagaraSystem>(nullptr, TEXT("/Game/Art/VFX/NS_BlessingAura.NS_BlessingAura"));
@@ -93,6 +115,7 @@ UNiagaraSystem* UNazareneVFXSubsystem::ResolveSystem(ENazareneVFXType Type) cons
 
 void UNazareneVFXSubsystem::SpawnEffectAtLocation(ENazareneVFXType Type, const FVector& Location, const FRotator& Rotation)
 {
+    LLM_SCOPE_BYTAG(Nazarene_VFX);
     UNiagaraSystem* System = ResolveSystem(Type);
     if (System == nullptr)
     {
@@ -105,6 +128,7 @@ void UNazareneVFXSubsystem::SpawnEffectAtLocation(ENazareneVFXType Type, const F
 
 void UNazareneVFXSubsystem::SpawnEffectAttached(ENazareneVFXType Type, USceneComponent* AttachTo)
 {
+    LLM_SCOPE_BYTAG(Nazarene_VFX);
     if (AttachTo == nullptr)
     {
         UE_LOG(LogTemp, Warning, TEXT("NazareneVFXSubsystem: SpawnEffectAttached called with null component"));
@@ -131,6 +155,7 @@ void UNazareneVFXSubsystem::SpawnEffectAttached(ENazareneVFXType Type, USceneCom
 
 void UNazareneVFXSubsystem::SpawnRegionAmbientVFX(const TArray<ENazareneVFXType>& AmbientTypes, const FVector& RegionCenter, float RegionRadius)
 {
+    LLM_SCOPE_BYTAG(Nazarene_VFX);
     ClearAmbientVFX();
 
     UWorld* World = GetWorld();
@@ -139,6 +164,11 @@ void UNazareneVFXSubsystem::SpawnRegionAmbientVFX(const TArray<ENazareneVFXType>
         return;
     }
 
+    if (const FNazareneQualityTier* Tier = UNazareneFrameBudgetSubsystem::FindActiveTier(World))
+    {
+        AmbientInstancesPerType = Tier->AmbientVFXPerType;
+    }
+
     for (const ENazareneVFXType& Type : AmbientTypes)
     {
         UNiagaraSystem* System = ResolveSystem(Type);
@@ -148,7 +178,8 @@ void UNazareneVFXSubsystem::SpawnRegionAmbientVFX(const TArray<ENazareneVFXType>
             continue;
         }
 
-        // Spawn ambient VFX at multiple points across the region for full atmospheric coverage
+        // Anchors are placed across the region for full coverage but spawned inactive; the camera
+        // pass in Tick activates the nearest visible ones so only what the player sees simulates.
         const int32 SpawnCount = 5;
         for (int32 Index = 0; Index < SpawnCount; ++Index)
         {
@@ -162,28 +193,147 @@ void UNazareneVFXSubsystem::SpawnRegionAmbientVFX(const TArray<ENazareneVFXType>
             );
 
             UNiagaraComponent* SpawnedComp = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-                World, System, SpawnLoc, FRotator::ZeroRotator, FVector(1.0f), true, true);
+                World, System, SpawnLoc, FRotator::ZeroRotator, FVector(1.0f), false, false);
 
             if (SpawnedComp != nullptr)
             {
-                ActiveAmbientComponents.Add(SpawnedComp);
+                FNazareneAmbientVFXAnchor& Anchor = AmbientAnchors.AddDefaulted_GetRef();
+                Anchor.Component = SpawnedComp;
+                Anchor.Type = Type;
             }
         }
     }
+
+    SET_DWORD_STAT(STAT_NazareneAmbientPlaced, AmbientAnchors.Num());
+    RefreshAmbientAnchors();
 }
 
 void UNazareneVFXSubsystem::ClearAmbientVFX()
 {
-    for (TObjectPtr<USceneComponent>& Comp : ActiveAmbientComponents)
+    for (FNazareneAmbientVFXAnchor& Anchor : AmbientAnchors)
     {
-        if (Comp != nullptr)
+        if (Anchor.Component != nullptr)
         {
-            if (UNiagaraComponent* NiagaraComp = Cast<UNiagaraComponent>(Comp))
+            Anchor.Component->DeactivateImmediate();
+            Anchor.Component->DestroyComponent();
+        }
+    }
+    AmbientAnchors.Empty();
+    AmbientRefreshTimer = 0.0f;
+    SET_DWORD_STAT(STAT_NazareneAmbientPlaced, 0);
+    SET_DWORD_STAT(STAT_NazareneAmbientActive, 0);
+}
+
+void UNazareneVFXSubsystem::SetAmbientInstanceBudget(int32 InstancesPerType)
+{
+    AmbientInstancesPerType = FMath::Max(0, InstancesPerType);
+    RefreshAmbientAnchors();
+}
+
+void UNazareneVFXSubsystem::Tick(float DeltaTime)
+{
+    AmbientRefreshTimer -= DeltaTime;
+    if (AmbientRefreshTimer <= 0.0f)
+    {
+        RefreshAmbientAnchors();
+    }
+}
+
+TStatId UNazareneVFXSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UNazareneVFXSubsystem, STATGROUP_Tickables);
+}
+
+void UNazareneVFXSubsystem::RefreshAmbientAnchors()
+{
+    AmbientRefreshTimer = AmbientRefreshSeconds;
+
+    UWorld* World = GetWorld();
+    APlayerController* PlayerController = World != nullptr ? World->GetFirstPlayerController() : nullptr;
+    const APlayerCameraManager* CameraManager = PlayerController != nullptr ? PlayerController->PlayerCameraManager.Get() : nullptr;
+    if (CameraManager == nullptr)
+    {
+        return;
+    }
+
+    const FVector ViewLocation = CameraManager->GetCameraLocation();
+    const FVector ViewForward = CameraManager->GetCameraRotation().Vector();
+    const float HalfFOVRadians = FMath::DegreesToRadians(CameraManager->GetFOVAngle() * 0.5f);
+
+    // Collect anchors the camera could see: inside the anchor's own volume, or within range and
+    // inside the view cone widened by the anchor's extent. Active anchors get the hysteresis margin.
+    TArray<FAmbientCandidate> Candidates;
+    for (int32 Index = 0; Index < AmbientAnchors.Num(); ++Index)
+    {
+        const FNazareneAmbientVFXAnchor& Anchor = AmbientAnchors[Index];
+        if (Anchor.Component == nullptr)
+        {
+            continue;
+        }
+
+        const bool bActive = Anchor.Component->IsActive();
+        const FVector ToAnchor = Anchor.Component->GetComponentLocation() - ViewLocation;
+        const float Distance = ToAnchor.Size();
+        const float Range = AmbientActivationDistance + (bActive ? AmbientDeactivationMargin : 0.0f);
+        if (Distance > Range)
+        {
+            continue;
+        }
+
+        if (Distance > AmbientAnchorRadius)
+        {
+            const float AngleToAnchor = FMath::Acos(FMath::Clamp(FVector::DotProduct(ToAnchor / Distance, ViewForward), -1.0f, 1.0f));
+            const float AngularRadius = FMath::Asin(FMath::Clamp(AmbientAnchorRadius / Distance, 0.0f, 1.0f));
+            const float Slack = bActive ? FMath::DegreesToRadians(10.0f) : 0.0f;
+            if (AngleToAnchor - AngularRadius > HalfFOVRadians + Slack)
             {
-                NiagaraComp->DeactivateImmediate();
+                continue;
             }
-            Comp->DestroyComponent();
         }
+
+        FAmbientCandidate& Candidate = Candidates.AddDefaulted_GetRef();
+        Candidate.AnchorIndex = Index;
+        Candidate.Distance = Distance;
     }
-    ActiveAmbientComponents.Empty();
+
+    // Nearest first, under both the per-type budget and the global cap.
+    Candidates.Sort([](const FAmbientCandidate& A, const FAmbientCandidate& B) { return A.Distance < B.Distance; });
+
+    TBitArray<> Wanted(false, AmbientAnchors.Num());
+    TMap<ENazareneVFXType, int32> ActivePerType;
+    int32 ActiveCount = 0;
+    for (const FAmbientCandidate& Candidate : Candidates)
+    {
+        if (ActiveCount >= MaxActiveAmbientSystems)
+        {
+            break;
+        }
+
+        FNazareneAmbientVFXAnchor& Anchor = AmbientAnchors[Candidate.AnchorIndex];
+        int32& TypeCount = ActivePerType.FindOrAdd(Anchor.Type);
+        if (TypeCount >= AmbientInstancesPerType)
+        {
+            continue;
+        }
+        ++TypeCount;
+        ++ActiveCount;
+        Wanted[Candidate.AnchorIndex] = true;
+
+        if (!Anchor.Component->IsActive())
+        {
+            Anchor.Component->Activate(true);
+        }
+    }
+
+    // Deactivate rather than destroy so live particles fade out and reactivation needs no spawn.
+    for (int32 Index = 0; Index < AmbientAnchors.Num(); ++Index)
+    {
+        UNiagaraComponent* Component = AmbientAnchors[Index].Component;
+        if (!Wanted[Index] && Component != nullptr && Component->IsActive())
+        {
+            Component->Deactivate();
+        }
+    }
+
+    SET_DWORD_STAT(STAT_NazareneAmbientActive, ActiveCount);
 }
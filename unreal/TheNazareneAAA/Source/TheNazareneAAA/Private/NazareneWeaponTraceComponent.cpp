@@ -0,0 +1,241 @@
+#include "NazareneWeaponTraceComponent.h"
+
+#include "CollisionQueryParams.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+
+UNazareneWeaponTraceComponent::UNazareneWeaponTraceComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+    // Sample after movement and animation so sockets reflect this frame's pose.
+    PrimaryComponentTick.TickGroup = TG_PostPhysics;
+
+    TraceDelegate.BindUObject(this, &UNazareneWeaponTraceComponent::HandleTraceDone);
+}
+
+void UNazareneWeaponTraceComponent::BeginSwing(const FNazareneWeaponSwingProfile& Profile)
+{
+    ActiveProfile = Profile;
+    ActiveProfile.Duration = FMath::Max(0.01f, Profile.Duration);
+    ActiveProfile.MaxTargets = FMath::Max(1, Profile.MaxTargets);
+
+    ++SwingId;
+    if (SwingId == 0)
+    {
+        SwingId = 1;
+    }
+    AcceptingSwingId = SwingId;
+    SwingHitActors.Reset();
+    SwingElapsed = 0.0f;
+    LastSampledProgress = -1.0f;
+    bHasSocketSample = false;
+    bAnimationDriven = bNotifyWindowOpen;
+    bSwingActive = true;
+    SetComponentTickEnabled(true);
+}
+
+void UNazareneWeaponTraceComponent::EndSwing()
+{
+    AcceptingSwingId = 0;
+    FinishSwing();
+}
+
+void UNazareneWeaponTraceComponent::SetNotifyWindowActive(bool bActive)
+{
+    bAnimationDriven |= bActive;
+    bNotifyWindowOpen = bActive;
+    bHasSocketSample = false;
+}
+
+void UNazareneWeaponTraceComponent::ReportHit(AActor* Actor)
+{
+    if (!bSwingActive || Actor == nullptr || Actor == GetOwner() || SwingHitActors.Contains(Actor) || SwingHitActors.Num() >= ActiveProfile.MaxTargets)
+    {
+        return;
+    }
+
+    SwingHitActors.Add(Actor);
+    FHitResult Hit(Actor, nullptr, Actor->GetActorLocation(), (GetOwner()->GetActorLocation() - Actor->GetActorLocation()).GetSafeNormal());
+    OnWeaponHit.Broadcast(Actor, Hit);
+}
+
+void UNazareneWeaponTraceComponent::FinishSwing()
+{
+    bSwingActive = false;
+    bHasSocketSample = false;
+    SetComponentTickEnabled(false);
+}
+
+void UNazareneWeaponTraceComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    if (!bSwingActive || GetOwner() == nullptr)
+    {
+        FinishSwing();
+        return;
+    }
+
+    SwingElapsed += DeltaTime;
+    const float Progress = FMath::Clamp(SwingElapsed / ActiveProfile.Duration, 0.0f, 1.0f);
+
+    // Authored attacks only sweep inside their notify window.
+    if (!bAnimationDriven || bNotifyWindowOpen)
+    {
+        FVector SocketBase;
+        FVector SocketTip;
+        if (bAnimationDriven && SampleSocketSegment(SocketBase, SocketTip))
+        {
+            SweepSocketPath(SocketBase, SocketTip);
+        }
+        else
+        {
+            SweepArcPath(Progress);
+        }
+    }
+    LastSampledProgress = Progress;
+
+    if (Progress >= 1.0f)
+    {
+        // Results for the final sweeps still land next frame; only EndSwing discards them.
+        FinishSwing();
+    }
+}
+
+void UNazareneWeaponTraceComponent::SweepSocketPath(const FVector& SocketBase, const FVector& SocketTip)
+{
+    if (!bHasSocketSample)
+    {
+        RequestSweep(SocketBase, SocketTip);
+    }
+    else
+    {
+        const float Travel = FMath::Max(FVector::Dist(LastSocketTip, SocketTip), FVector::Dist(LastSocketBase, SocketBase));
+        const int32 Steps = FMath::Clamp(FMath::CeilToInt(Travel / FMath::Max(1.0f, MaxSubstepDistance)), 1, MaxSubstepsPerFrame);
+        for (int32 Step = 1; Step <= Steps; ++Step)
+        {
+            const float Alpha = static_cast<float>(Step) / static_cast<float>(Steps);
+            RequestSweep(FMath::Lerp(LastSocketBase, SocketBase, Alpha), FMath::Lerp(LastSocketTip, SocketTip, Alpha));
+        }
+    }
+
+    LastSocketBase = SocketBase;
+    LastSocketTip = SocketTip;
+    bHasSocketSample = true;
+}
+
+void UNazareneWeaponTraceComponent::SweepArcPath(float Progress)
+{
+    FVector Base;
+    FVector Tip;
+    if (LastSampledProgress < 0.0f)
+    {
+        SampleArcSegment(0.0f, Base, Tip);
+        RequestSweep(Base, Tip);
+    }
+
+    const float FromProgress = FMath::Max(0.0f, LastSampledProgress);
+    if (Progress <= FromProgress)
+    {
+        return;
+    }
+
+    const float SweptDegrees = ActiveProfile.ArcDegrees * (Progress - FromProgress);
+    const int32 Steps = FMath::Clamp(FMath::CeilToInt(SweptDegrees / FMath::Max(1.0f, MaxSubstepDegrees)), 1, MaxSubstepsPerFrame);
+    for (int32 Step = 1; Step <= Steps; ++Step)
+    {
+        SampleArcSegment(FMath::Lerp(FromProgress, Progress, static_cast<float>(Step) / static_cast<float>(Steps)), Base, Tip);
+        RequestSweep(Base, Tip);
+    }
+}
+
+bool UNazareneWeaponTraceComponent::SampleSocketSegment(FVector& OutBase, FVector& OutTip) const
+{
+    const ACharacter* CharacterOwner = Cast<ACharacter>(GetOwner());
+    const USkeletalMeshComponent* Mesh = CharacterOwner != nullptr ? CharacterOwner->GetMesh() : nullptr;
+    if (Mesh == nullptr || Mesh->GetSkeletalMeshAsset() == nullptr || !Mesh->DoesSocketExist(WeaponBaseSocket))
+    {
+        return false;
+    }
+
+    const FTransform BaseTransform = Mesh->GetSocketTransform(WeaponBaseSocket);
+    OutBase = BaseTransform.GetLocation();
+    OutTip = Mesh->DoesSocketExist(WeaponTipSocket)
+        ? Mesh->GetSocketLocation(WeaponTipSocket)
+        : OutBase + BaseTransform.GetUnitAxis(EAxis::X) * ActiveProfile.Reach * 0.5f;
+    return true;
+}
+
+void UNazareneWeaponTraceComponent::SampleArcSegment(float Progress, FVector& OutBase, FVector& OutTip) const
+{
+    const AActor* Owner = GetOwner();
+    const float HalfArc = ActiveProfile.ArcDegrees * 0.5f;
+    const float Yaw = FMath::Lerp(HalfArc, -HalfArc, Progress);
+    const FVector Direction = Owner->GetActorForwardVector().GetSafeNormal2D().RotateAngleAxis(Yaw, FVector::UpVector);
+
+    OutBase = Owner->GetActorLocation() + FVector(0.0f, 0.0f, ProceduralSweepHeight);
+    OutTip = OutBase + Direction * ActiveProfile.Reach;
+}
+
+void UNazareneWeaponTraceComponent::RequestSweep(const FVector& Base, const FVector& Tip)
+{
+    UWorld* World = GetWorld();
+    if (World == nullptr)
+    {
+        return;
+    }
+
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(NazareneWeaponTrace), false, GetOwner());
+    // Object-type multi sweeps report every pawn along the blade, which blocking channel sweeps would stop at.
+    World->AsyncSweepByObjectType(
+        EAsyncTraceType::Multi,
+        Base,
+        Tip,
+        FQuat::Identity,
+        FCollisionObjectQueryParams(ECC_Pawn),
+        FCollisionShape::MakeSphere(ActiveProfile.Radius),
+        Params,
+        &TraceDelegate,
+        SwingId);
+}
+
+void UNazareneWeaponTraceComponent::HandleTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+    if (Datum.UserData != AcceptingSwingId || AcceptingSwingId == 0)
+    {
+        return;
+    }
+
+    for (const FHitResult& Hit : Datum.OutHits)
+    {
+        if (SwingHitActors.Num() >= ActiveProfile.MaxTargets)
+        {
+            return;
+        }
+
+        AActor* HitActor = Hit.GetActor();
+        if (HitActor == nullptr || HitActor == GetOwner())
+        {
+            continue;
+        }
+        if (ActiveProfile.TargetClass != nullptr && !HitActor->IsA(ActiveProfile.TargetClass))
+        {
+            continue;
+        }
+        if (SwingHitActors.Contains(HitActor))
+        {
+            continue;
+        }
+
+        SwingHitActors.Add(HitActor);
+        OnWeaponHit.Broadcast(HitActor, Hit);
+
+        // A hit reaction may have interrupted or restarted the swing.
+        if (Datum.UserData != AcceptingSwingId)
+        {
+            return;
+        }
+    }
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffect.h"
+#include "GE_NazareneMiracleDamage.generated.h"
+
+UCLASS()
+class THENAZARENEAAA_API UGE_NazareneMiracleDamage : public UGameplayEffect
+{
+    GENERATED_BODY()
+
+public:
+    UGE_NazareneMiracleDamage();
+};
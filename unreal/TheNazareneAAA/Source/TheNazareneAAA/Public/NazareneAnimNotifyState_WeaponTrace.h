@@ -0,0 +1,17 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimNotifies/AnimNotifyState.h"
+#include "NazareneAnimNotifyState_WeaponTrace.generated.h"
+
+/** Marks the live frames of an authored attack; the owner's weapon trace sweeps from mesh sockets inside it. */
+UCLASS(meta = (DisplayName = "Nazarene Weapon Trace"))
+class THENAZARENEAAA_API UNazareneAnimNotifyState_WeaponTrace : public UAnimNotifyState
+{
+    GENERATED_BODY()
+
+public:
+    virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
+    virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+    virtual FString GetNotifyName_Implementation() const override;
+};
@@ -11,6 +11,8 @@
     GAMEPLAYATTRIBUTE_VALUE_SETTER(PropertyName) \
     GAMEPLAYATTRIBUTE_VALUE_INITTER(PropertyName)
 
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FNazareneIncomingDamageSignature, float /*Damage*/, float /*PoiseDamage*/, AActor* /*Instigator*/);
+
 UCLASS(BlueprintType)
 class THENAZARENEAAA_API UNazareneAttributeSet : public UAttributeSet
 {
@@ -40,4 +42,12 @@ public:
     UPROPERTY(BlueprintReadOnly, Category = "Attributes")
     FGameplayAttributeData Faith;
     NAZARENE_ATTRIBUTE_ACCESSORS(UNazareneAttributeSet, Faith);
+
+    /** Meta attribute: damage delivered by a gameplay effect, handed to the owner and reset to zero. */
+    UPROPERTY(BlueprintReadOnly, Category = "Attributes")
+    FGameplayAttributeData IncomingDamage;
+    NAZARENE_ATTRIBUTE_ACCESSORS(UNazareneAttributeSet, IncomingDamage);
+
+    /** Fired when an effect lands IncomingDamage; poise damage rides along as a SetByCaller on the spec. */
+    FNazareneIncomingDamageSignature OnIncomingDamage;
 };
@@ -11,8 +11,9 @@ class ANazareneMenuCameraActor;
 class ANazareneNPC;
 class ANazarenePlayerCharacter;
 class ANazareneTravelGate;
-class UAudioComponent;
+class UAnimationSharingSetup;
 class UBehaviorTree;
+class ULevelStreamingDynamic;
 class UNazareneGameInstance;
 class UNazareneRegionDataAsset;
 class UNazareneSaveSubsystem;
@@ -27,15 +28,25 @@ enum class ENazareneChapterStage : uint8
     Completed = 3
 };
 
-
-UENUM(BlueprintType)
-enum class ENazareneMusicState : uint8
+/**
+ * Region state as it stood right after load: the enemy roster at its spawn vitals and the
+ * encounter waves still armed. Rest, death-retry and load restore from this instead of
+ * re-deriving each enemy and wave; the travel gate follows progression and is re-synced.
+ * Props are not captured: region environment actors are static meshes and lights with no
+ * runtime state, and the prayer site's consecration lives in the session flags.
+ */
+USTRUCT()
+struct FNazareneRegionBaseline
 {
-    Peace = 0,
-    Tension = 1,
-    Combat = 2,
-    Boss = 3,
-    Victory = 4
+    GENERATED_BODY()
+
+    int32 RegionIndex = INDEX_NONE;
+
+    UPROPERTY()
+    TArray<FNazareneEnemySnapshot> Enemies;
+
+    UPROPERTY()
+    TArray<FNazareneEncounterWave> DeferredWaves;
 };
 
 UCLASS()
@@ -47,7 +58,6 @@ public:
     ANazareneCampaignGameMode();
 
     virtual void BeginPlay() override;
-    virtual void Tick(float DeltaSeconds) override;
 
     UFUNCTION(BlueprintCallable, Category = "Campaign")
     void RequestTravel(int32 TargetRegionIndex);
@@ -70,12 +80,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Campaign")
     void NotifyPlayerDefeated();
 
+    /** Return the region's enemies and waves to their post-load baseline, touching only what changed. */
+    void RestoreRegionBaseline();
+
     UFUNCTION(BlueprintCallable, Category = "Campaign")
     void NotifyNPCDialogue(FName CharacterSlug);
 
     UFUNCTION(BlueprintPure, Category = "Audio")
     ENazareneMusicState GetMusicState() const { return MusicState; }
 
+    UFUNCTION(BlueprintPure, Category = "Campaign|Determinism")
+    int32 GetSimulationSeed() const { return ResolvedSimulationSeed; }
+
     UPROPERTY(EditDefaultsOnly, Category = "Campaign")
     TObjectPtr<UNazareneRegionDataAsset> RegionDataAsset;
 
@@ -86,8 +102,17 @@ private:
     void SpawnMenuCamera();
     void DestroyMenuCamera();
     void SpawnMenuSetpiece(const FVector& CameraCenter);
+    void BuildMenuSetpieceActors(const FVector& CameraCenter);
+    void CheckMenuSetpieceStreaming();
     void DestroyMenuSetpiece();
+    FVector GetMenuStageCenter() const;
     void BuildDefaultRegions();
+    void InitializeEnemyAnimationSharing();
+    void ResolveSimulationSeed();
+    FRandomStream MakeEnemyDecisionStream(FName SpawnId) const;
+    void StartInputReplayIfArmed();
+    /** -NazareneSpawnBenchmark: log the first player's spawn cost and a warm respawn's, then quit. */
+    void StartSpawnBenchmarkIfArmed();
     void LoadRegion(int32 TargetRegionIndex);
     void ClearRegionActors();
     bool IsStartMenuVisible() const;
@@ -101,6 +126,9 @@ private:
     bool TryLoadRegionSublevel(const FNazareneRegionDefinition& Region);
     void UnloadRegionSublevel();
     void SpawnRegionActors(const FNazareneRegionDefinition& Region);
+    void BuildRegionFlowField(const FNazareneRegionDefinition& Region) const;
+    void CaptureRegionBaseline();
+    void CancelPendingWaveTimers();
     void ApplySavePayload(const FNazareneSavePayload& Payload);
     FNazareneSavePayload BuildSavePayload() const;
     void SyncCompletionState();
@@ -118,8 +146,9 @@ private:
     FString BuildObjectiveText(const FNazareneRegionDefinition& Region, bool bCompleted) const;
     void EnableTravelGate(bool bEnabled);
     void UpdateHUDForRegion(const FNazareneRegionDefinition& Region, bool bCompleted) const;
+    void HideLoadingOverlay() const;
     void SetMusicState(ENazareneMusicState NewState, bool bAnnounceOnHUD = false);
-    USoundBase* ResolveRegionMusic(const FNazareneRegionDefinition& Region) const;
+    TSoftObjectPtr<USoundBase> ResolveRegionMusic(const FNazareneRegionDefinition& Region) const;
     FString GetRandomLoreTip() const;
     void ConfigureEnemyBehaviorTree(ANazareneEnemyCharacter* Enemy) const;
     void ApplyRegionalEnemyTuning(ANazareneEnemyCharacter* Enemy, const FNazareneRegionDefinition& Region, bool bIsWaveEnemy) const;
@@ -128,6 +157,10 @@ private:
     UFUNCTION()
     void HandleEnemyRedeemed(ANazareneEnemyCharacter* Enemy, float FaithReward);
 
+    /** The overlay waits on the player's presentation; a pawn that ends play before it is ready must still lift it. */
+    UFUNCTION()
+    void HandlePlayerEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
     void SpawnWaveEnemies(const FNazareneEncounterWave& Wave);
     void CheckDeferredWaves(ENazareneSpawnTrigger Trigger, int32 Param = 0);
 
@@ -153,9 +186,6 @@ private:
     UPROPERTY()
     TObjectPtr<ANazareneEnemyCharacter> BossEnemy;
 
-    UPROPERTY()
-    TObjectPtr<UAudioComponent> RegionMusicComponent;
-
     UPROPERTY()
     TMap<FName, TObjectPtr<ANazareneEnemyCharacter>> EnemyBySpawnId;
 
@@ -165,6 +195,12 @@ private:
     UPROPERTY()
     TArray<FNazareneEncounterWave> DeferredWaves;
 
+    UPROPERTY()
+    FNazareneRegionBaseline RegionBaseline;
+
+    /** Delayed wave spawns still pending, cancelled when the region is reloaded or restored. */
+    TArray<FTimerHandle> PendingWaveTimers;
+
     UPROPERTY(EditAnywhere, Category = "Audio")
     TSoftObjectPtr<USoundBase> GalileeMusic;
 
@@ -201,6 +237,13 @@ private:
     UPROPERTY(EditAnywhere, Category = "AI")
     TSoftObjectPtr<UBehaviorTree> BTBossAsset;
 
+    UPROPERTY(EditAnywhere, Category = "Animation")
+    TSoftObjectPtr<UAnimationSharingSetup> EnemyAnimationSharingSetup;
+
+    /** Seed for every enemy decision stream; 0 picks a fresh seed per session. -NazareneSeed=N and input replays override it. */
+    UPROPERTY(EditAnywhere, Category = "Determinism")
+    int32 SimulationSeed = 0;
+
     UPROPERTY(EditAnywhere, Category = "Progression")
     float ChapterHealthScaleStep = 0.08f;
 
@@ -222,6 +265,7 @@ private:
     FName LoadedRegionLevelPackage = NAME_None;
 
     int32 RegionIndex = 0;
+    int32 ResolvedSimulationSeed = 0;
     bool bRegionCompleted = false;
     bool bPrayerSiteConsecrated = false;
     bool bSuppressRedeemedCallbacks = false;
@@ -250,17 +294,14 @@ private:
     UPROPERTY()
     TObjectPtr<ANazareneMenuCameraActor> MenuCamera;
 
+    /** Streamed title diorama; MenuSetpieceActors only holds the runtime-built fallback. */
     UPROPERTY()
-    TObjectPtr<UAudioComponent> CrossfadeAudioComponent;
+    TObjectPtr<ULevelStreamingDynamic> MenuSetpieceLevel;
+
+    /** Polls MenuSetpieceLevel until it loads or fails; a failed load falls back to the runtime build. */
+    FTimerHandle MenuSetpieceStreamTimer;
+    FVector MenuSetpieceCenter = FVector::ZeroVector;
 
     UPROPERTY()
     TArray<TObjectPtr<AActor>> MenuSetpieceActors;
-
-    float MusicCrossfadeDuration = 2.0f;
-    float CrossfadeElapsed = 0.0f;
-    bool bCrossfading = false;
-    float CrossfadeStartVolume = 1.0f;
-
-    void CrossfadeToMusic(USoundBase* NewMusic);
-    void TickCrossfade(float DeltaSeconds);
 };
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NazareneTypes.h"
+#include "NazareneCombatAudioSubsystem.generated.h"
+
+class UAudioComponent;
+class USoundBase;
+
+/**
+ * Combat one-shot dispatcher. Requests made during a frame are merged (same sound close
+ * together plays once), ranked by category priority, volume and listener distance, and then
+ * played on pooled audio components within a per-frame voice budget and per-category
+ * concurrency limits. When the pool is full, a request steals the lowest-ranked playing voice
+ * (the oldest among equals) if it outranks it.
+ */
+UCLASS()
+class THENAZARENEAAA_API UNazareneCombatAudioSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UNazareneCombatAudioSubsystem();
+
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    void RequestSound(USoundBase* Sound, const FVector& Location, float VolumeMultiplier, ENazareneCombatAudioCategory Category);
+
+    static void Request(const UObject* WorldContextObject, USoundBase* Sound, const FVector& Location, float VolumeMultiplier, ENazareneCombatAudioCategory Category);
+
+    int32 GetActiveVoiceCount() const;
+
+    UPROPERTY(EditAnywhere, Category = "Audio|Combat")
+    int32 PoolSize = 16;
+
+    /** New voices started per frame, across all categories. */
+    UPROPERTY(EditAnywhere, Category = "Audio|Combat")
+    int32 MaxVoicesPerFrame = 6;
+
+    /** Same-sound requests closer than this in one frame merge into one voice. */
+    UPROPERTY(EditAnywhere, Category = "Audio|Combat")
+    float MergeDistance = 250.0f;
+
+    /** Distance at which a request's ranking score halves. */
+    UPROPERTY(EditAnywhere, Category = "Audio|Combat")
+    float PriorityFalloffDistance = 1500.0f;
+
+    UPROPERTY(EditAnywhere, Category = "Audio|Combat")
+    TMap<ENazareneCombatAudioCategory, int32> CategoryVoiceLimits;
+
+    UPROPERTY(EditAnywhere, Category = "Audio|Combat")
+    TMap<ENazareneCombatAudioCategory, float> CategoryPriorities;
+
+private:
+    struct FSoundRequest
+    {
+        TWeakObjectPtr<USoundBase> Sound;
+        FVector Location = FVector::ZeroVector;
+        float VolumeMultiplier = 1.0f;
+        float Score = 0.0f;
+        ENazareneCombatAudioCategory Category = ENazareneCombatAudioCategory::Attack;
+    };
+
+    struct FVoiceSlot
+    {
+        ENazareneCombatAudioCategory Category = ENazareneCombatAudioCategory::Attack;
+        /** Ranking score of the request the voice is playing, as of when it started. */
+        float Score = 0.0f;
+        double StartSeconds = 0.0;
+    };
+
+    /** Index of a free voice, a new one while the pool can grow, or a stolen one Score outranks; INDEX_NONE otherwise. */
+    int32 AcquireVoice(float Score);
+    bool ResolveListener(FVector& OutLocation) const;
+    int32 CountPlaying(ENazareneCombatAudioCategory Category) const;
+
+    TArray<FSoundRequest> PendingRequests;
+
+    UPROPERTY()
+    TArray<TObjectPtr<UAudioComponent>> Voices;
+
+    /** Parallel to Voices. */
+    TArray<FVoiceSlot> VoiceSlots;
+};
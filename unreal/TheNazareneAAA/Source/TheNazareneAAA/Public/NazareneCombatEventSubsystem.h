@@ -0,0 +1,109 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NazareneTypes.h"
+#include <atomic>
+#include "NazareneCombatEventSubsystem.generated.h"
+
+class USoundBase;
+class UNiagaraSystem;
+
+UENUM(BlueprintType)
+enum class ENazareneCombatEventType : uint8
+{
+    Hit = 0,
+    Block = 1,
+    Parry = 2,
+    PoiseBreak = 3,
+    Redeem = 4,
+    PhaseChange = 5
+};
+
+/** One gameplay outcome, recorded for presentation and telemetry to pick up at the end of the frame. */
+struct FNazareneCombatEvent
+{
+    /** Event placed and oriented at the target actor. */
+    static FNazareneCombatEvent Make(ENazareneCombatEventType InType, const AActor* InTarget, const AActor* InInstigator);
+
+    ENazareneCombatEventType Type = ENazareneCombatEventType::Hit;
+    FVector Location = FVector::ZeroVector;
+    FRotator Rotation = FRotator::ZeroRotator;
+    float Amount = 0.0f;
+    int32 Param = 0;
+
+    /** Published events merged into this one by coalescing. */
+    int32 Count = 1;
+
+    TWeakObjectPtr<AActor> Instigator;
+    TWeakObjectPtr<AActor> Target;
+
+    bool bDisplayNumber = false;
+    ENazareneDamageNumberType NumberType = ENazareneDamageNumberType::Normal;
+    float NumberHeight = 130.0f;
+
+    TWeakObjectPtr<USoundBase> Sound;
+    TWeakObjectPtr<UNiagaraSystem> Effect;
+    float VolumeMultiplier = 1.0f;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FNazareneCombatEventsFlushedSignature, TConstArrayView<FNazareneCombatEvent> /*Events*/);
+
+/**
+ * Per-frame combat event bus. Gameplay publishes into a preallocated page through an atomic
+ * cursor and never waits; once per frame the page is swapped, same-type events on the same
+ * target are coalesced, and consumers (HUD, presentation, telemetry) receive the batch.
+ * Event sounds go through UNazareneCombatAudioSubsystem, which owns the voice budget.
+ */
+UCLASS()
+class THENAZARENEAAA_API UNazareneCombatEventSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** Safe from any thread; drops the event when this frame's page is full. */
+    void Publish(const FNazareneCombatEvent& Event);
+
+    static void Publish(const UObject* WorldContextObject, const FNazareneCombatEvent& Event);
+
+    FNazareneCombatEventsFlushedSignature OnEventsFlushed;
+
+    int32 GetEventsLastFrame() const { return EventsLastFrame; }
+    int32 GetDroppedEventsTotal() const { return DroppedEventsTotal; }
+
+    /** Slots per frame page; events past this are dropped and counted. */
+    UPROPERTY(EditAnywhere, Category = "Combat|Events")
+    int32 EventCapacity = 256;
+
+    /** Coalesced events delivered per frame; the rest are culled from presentation. */
+    UPROPERTY(EditAnywhere, Category = "Combat|Events")
+    int32 MaxEventsPerFrame = 64;
+
+    UPROPERTY(EditAnywhere, Category = "Combat|Events")
+    int32 MaxEffectsPerFrame = 8;
+
+private:
+    struct FEventPage
+    {
+        TArray<FNazareneCombatEvent> Events;
+        TUniquePtr<std::atomic<uint32>[]> Stamps;
+        std::atomic<int32> WriteCursor{0};
+        std::atomic<uint32> Serial{0};
+    };
+
+    void CoalescePage(FEventPage& Page);
+    void RunPresentationPass(TConstArrayView<FNazareneCombatEvent> Events) const;
+
+    FEventPage Pages[2];
+    std::atomic<int32> ActivePage{0};
+    std::atomic<int32> DroppedThisFrame{0};
+    uint32 NextSerial = 1;
+
+    TArray<FNazareneCombatEvent> FrameEvents;
+    int32 EventsLastFrame = 0;
+    int32 DroppedEventsTotal = 0;
+};
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/Interface.h"
+#include "NazareneCombatSimSubsystem.generated.h"
+
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UNazareneCombatSimulated : public UInterface
+{
+    GENERATED_BODY()
+};
+
+/** Actors whose combat timers and state machines advance on the fixed combat step. */
+class THENAZARENEAAA_API INazareneCombatSimulated
+{
+    GENERATED_BODY()
+
+public:
+    virtual void CombatStep(float StepSeconds) = 0;
+};
+
+/**
+ * Fixed-rate combat clock. Frame time is accumulated and drained in whole steps so windups,
+ * parry windows and poise regen behave the same at any framerate; presentation reads timers
+ * through AdvanceTimerForPresentation to cover the unsimulated remainder.
+ */
+UCLASS()
+class THENAZARENEAAA_API UNazareneCombatSimSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    void RegisterParticipant(UObject* Participant);
+    void UnregisterParticipant(UObject* Participant);
+
+    float GetStepSeconds() const { return 1.0f / FMath::Max(1.0f, StepRateHz); }
+
+    /** Countdown timer value as of render time rather than the last completed step. */
+    float AdvanceTimerForPresentation(float TimerSeconds) const { return FMath::Max(0.0f, TimerSeconds - Accumulator); }
+
+    int32 GetStepsLastFrame() const { return StepsLastFrame; }
+    double GetAverageStepMilliseconds() const { return AverageStepMilliseconds; }
+
+    UPROPERTY(EditAnywhere, Category = "Combat")
+    float StepRateHz = 120.0f;
+
+    /** Steps past this in one frame are dropped so a hitch cannot snowball into a longer one. */
+    UPROPERTY(EditAnywhere, Category = "Combat")
+    int32 MaxStepsPerFrame = 12;
+
+private:
+    TArray<TWeakObjectPtr<UObject>> Participants;
+    float Accumulator = 0.0f;
+    int32 StepsLastFrame = 0;
+    double AverageStepMilliseconds = 0.0;
+};
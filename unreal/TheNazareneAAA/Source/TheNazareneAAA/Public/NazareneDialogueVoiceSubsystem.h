@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NazareneDialogueVoiceSubsystem.generated.h"
+
+class USoundBase;
+struct FStreamableHandle;
+
+/**
+ * Streams NPC voice lines by proximity. An NPC's clips start loading when the player enters its
+ * interaction sphere and stay pinned while the player is near. After the player leaves they are
+ * kept for ReleaseDelaySeconds so a quick return does not reload, and at most MaxCachedVoiceSets
+ * unpinned sets stay resident, least recently used dropped first.
+ */
+UCLASS()
+class THENAZARENEAAA_API UNazareneDialogueVoiceSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    /** Start streaming Owner's clips and pin them until ReleaseVoiceSet. */
+    void AcquireVoiceSet(const UObject* Owner, const TArray<TSoftObjectPtr<USoundBase>>& Clips);
+
+    /** Unpin Owner's clips; they are dropped after ReleaseDelaySeconds or when evicted. */
+    void ReleaseVoiceSet(const UObject* Owner);
+
+    /** Call OnLoaded with Clip once it is resident, streaming it first if Owner's set has not. */
+    void WhenVoiceLoaded(const TSoftObjectPtr<USoundBase>& Clip, TFunction<void(USoundBase*)> OnLoaded);
+
+    int32 GetResidentVoiceSetCount() const { return VoiceSets.Num(); }
+
+    UPROPERTY(EditAnywhere, Category = "Audio|Dialogue")
+    float ReleaseDelaySeconds = 20.0f;
+
+    /** Unpinned voice sets kept resident; sets of NPCs the player is standing near do not count. */
+    UPROPERTY(EditAnywhere, Category = "Audio|Dialogue")
+    int32 MaxCachedVoiceSets = 3;
+
+private:
+    struct FVoiceSet
+    {
+        TWeakObjectPtr<const UObject> Owner;
+        TSharedPtr<FStreamableHandle> Handle;
+        double ReleaseAtSeconds = 0.0;
+        bool bPinned = false;
+    };
+
+    int32 FindVoiceSet(const UObject* Owner) const;
+    void DropVoiceSet(int32 Index);
+    void EvictUnpinnedVoiceSets();
+    void SweepReleasedVoiceSets();
+    void ScheduleSweep();
+
+    /** Least recently used first. */
+    TArray<FVoiceSet> VoiceSets;
+
+    FTimerHandle SweepTimer;
+};
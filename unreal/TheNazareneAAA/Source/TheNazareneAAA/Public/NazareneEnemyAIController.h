@@ -31,6 +31,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AI")
     AActor* GetCurrentTargetActor() const;
 
+    /** Forget perceived actors and clear the target; the pawn's next sync pushes a fallback again. */
+    void ResetTarget();
+
 private:
     void PushTargetToBlackboard(AActor* TargetActor);
     void PushDistanceToBlackboard() const;
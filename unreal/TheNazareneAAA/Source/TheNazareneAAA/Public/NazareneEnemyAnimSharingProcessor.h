@@ -0,0 +1,17 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AnimationSharingTypes.h"
+#include "NazareneEnemyAnimSharingProcessor.generated.h"
+
+/** Maps enemy combat state onto AnimationSharing states so crowd members share master pose evaluations. */
+UCLASS()
+class THENAZARENEAAA_API UNazareneEnemyAnimSharingProcessor : public UAnimationSharingStateProcessor
+{
+    GENERATED_BODY()
+
+public:
+    UNazareneEnemyAnimSharingProcessor();
+
+    virtual void ProcessActorState_Implementation(int32& OutState, AActor* InActor, uint8 CurrentState, uint8 OnDemandState, bool& bShouldProcess) override;
+};
@@ -1,32 +1,75 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "AbilitySystemInterface.h"
 #include "GameFramework/Character.h"
+#include "NazareneCombatSimSubsystem.h"
+#include "NazareneFrameBudgetSubsystem.h"
 #include "NazareneTypes.h"
 #include "NazareneEnemyCharacter.generated.h"
 
 class ANazarenePlayerCharacter;
 class UBehaviorTree;
 class UAnimInstance;
+class UNazareneAbilitySystemComponent;
+class UNazareneAttributeSet;
 class UNiagaraSystem;
 class USkeletalMesh;
 class USoundBase;
 class UStaticMeshComponent;
+class UNazareneWeaponTraceComponent;
+struct FAnimUpdateRateParameters;
+
+/** Combat values after archetype, boss phase and regional tuning; rebuilt by RefreshDerivedStats. */
+USTRUCT(BlueprintType)
+struct FNazareneEnemyDerivedStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Derived")
+    float MoveSpeed = 0.0f;
+
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Derived")
+    float AttackDamage = 0.0f;
+
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Derived")
+    float PostureDamage = 0.0f;
+
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Derived")
+    float Windup = 0.0f;
+
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Derived")
+    float Recovery = 0.0f;
+
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Derived")
+    float ParryStartRatio = 0.0f;
+
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Derived")
+    float ParryEndRatio = 0.0f;
+
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Derived")
+    float PhaseSpeedScale = 1.0f;
+};
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FNazareneEnemyRedeemedSignature, ANazareneEnemyCharacter*, Enemy, float, FaithReward);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FNazareneEnemyPhaseChangedSignature, ANazareneEnemyCharacter*, Enemy, int32, Phase);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FNazareneBossHazardSignature, ANazareneEnemyCharacter*, Boss, FVector, HazardCenter);
 
 UCLASS()
-class THENAZARENEAAA_API ANazareneEnemyCharacter : public ACharacter
+class THENAZARENEAAA_API ANazareneEnemyCharacter : public ACharacter, public INazareneCombatSimulated, public IAbilitySystemInterface
 {
     GENERATED_BODY()
 
 public:
     ANazareneEnemyCharacter();
 
+    virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override;
+
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void Tick(float DeltaSeconds) override;
+    virtual void CombatStep(float StepSeconds) override;
+    virtual void LaunchCharacter(FVector LaunchVelocity, bool bXYOverride, bool bZOverride) override;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Identity")
     FString EnemyName = TEXT("Roman Patrol");
@@ -76,6 +119,12 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
     float StrikeTimingRatio = 0.72f;
 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+    float MeleeArcDegrees = 100.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+    float MeleeTraceRadius = 26.0f;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
     float ParryWindowStartRatio = 0.35f;
 
@@ -97,6 +146,26 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
     float ShieldBlockChance = 0.45f;
 
+    /** Past this distance idle or chasing enemies skip CharacterMovement and glide on a cached navmesh height. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
+    bool bUseKinematicMovementWhenDistant = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
+    float KinematicMovementDistance = 2200.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
+    float KinematicGroundRefreshInterval = 0.35f;
+
+    /** Inside this range enemies steer straight at the player instead of following the region flow field. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
+    float FlowFieldDirectRange = 350.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
+    float SeparationRadius = 140.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
+    float SeparationWeight = 0.65f;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
     TObjectPtr<UBehaviorTree> BehaviorTreeAsset;
 
@@ -109,6 +178,20 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Presentation|Animation")
     TSoftClassPtr<UAnimInstance> ProductionAnimBlueprint;
 
+    /** Skip anim evaluations by screen size, and more aggressively past the near/far distances. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Presentation|Animation")
+    bool bUseAnimUpdateRateOptimization = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Presentation|Animation")
+    float AnimURONearDistance = 1500.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Presentation|Animation")
+    float AnimUROFarDistance = 3600.0f;
+
+    /** Register with the AnimationSharing manager so crowd members follow shared master poses. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Presentation|Animation")
+    bool bAllowAnimationSharing = true;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Presentation|Audio")
     TObjectPtr<USoundBase> AttackSound;
 
@@ -139,6 +222,9 @@ public:
     UPROPERTY(BlueprintReadOnly, Category = "Runtime")
     int32 BossPhase = 1;
 
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Runtime")
+    FNazareneEnemyDerivedStats DerivedStats;
+
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FNazareneEnemyRedeemedSignature OnRedeemed;
 
@@ -175,6 +261,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Enemy")
     ENazareneEnemyState GetState() const;
 
+    UFUNCTION(BlueprintCallable, Category = "Enemy")
+    bool IsUsingKinematicMovement() const;
+
     UFUNCTION(BlueprintCallable, Category = "Enemy")
     float GetStateTimerRemaining() const;
 
@@ -199,12 +288,38 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Enemy")
     void ApplySnapshot(const FNazareneEnemySnapshot& Snapshot);
 
+    /**
+     * True when applying Snapshot would change nothing: same vitals, in place, idle and at rest, no timers
+     * or cooldowns running, no active gameplay effects, decision stream unused.
+     */
+    bool MatchesSnapshot(const FNazareneEnemySnapshot& Snapshot) const;
+
+    /** Drop the aggro target and return to the full tick rate; both re-derive on the next step, so restores always do this. */
+    void ResetAwareness();
+
+    /** Mirror health into the attribute set after it is changed from outside the enemy (regional tuning). */
+    void SyncAttributeVitals();
+
+    /** Rebuild DerivedStats; call after changing archetype, tuning or BossPhase. */
+    void RefreshDerivedStats();
+
+    /** Seeded stream for every random combat decision; rewound on reset so retries replay identically. */
+    void SetDecisionStream(const FRandomStream& Stream);
+
+    /** Freeze the fixed-step combat state machine (intro, cutscenes); the sim keeps the enemy registered. */
+    void SetCombatSuppressed(bool bSuppressed) { bCombatSuppressed = bSuppressed; }
+    bool IsCombatSuppressed() const { return bCombatSuppressed; }
+
 private:
     void SyncTargetFromAIController();
     void ConfigureProxyVisuals();
     void SetProxyVisualsHidden(bool bHideProxy);
+    void HandleAnimUpdateRateParamsCreated(FAnimUpdateRateParameters* Params);
+    void UpdateAnimUpdateRateTier(float DistanceToPlayer);
+    void RegisterWithAnimationSharing();
+    void UnregisterFromAnimationSharing();
     void ApplyProxyArchetypeVisualStyle();
-    void TriggerPresentation(USoundBase* Sound, UNiagaraSystem* Effect, const FVector& Location, float VolumeMultiplier = 1.0f) const;
+    void TriggerPresentation(USoundBase* Sound, UNiagaraSystem* Effect, const FVector& Location, float VolumeMultiplier = 1.0f, ENazareneCombatAudioCategory AudioCategory = ENazareneCombatAudioCategory::Attack) const;
     void UpdateBossPhase();
     void CheckReinforcementTrigger();
     void TriggerArenaHazard();
@@ -212,25 +327,31 @@ private:
     void ProcessChaseBehavior(float DistanceToPlayer, float DeltaSeconds);
     void BeginMeleeAttack();
     void BeginCastAttack();
-    void ProcessWindup(float DeltaSeconds, bool bCasting);
+    void ProcessWindup(float StepSeconds, bool bCasting);
     void ResolveMeleeAttack();
+    void HandleWeaponHit(AActor* HitActor, const FHitResult& Hit);
+    void CancelWeaponSwing();
     void ResolveCastAttack();
     void FaceTarget(float DeltaSeconds);
     void MoveTowardTarget(float DeltaSeconds, float Speed);
     void MoveAwayFromTarget(float DeltaSeconds);
     void StrafeAroundTarget(float DeltaSeconds);
     void SlowToStop(float DeltaSeconds);
+    void ApplyMovementInput(const FVector& Direction, float Speed, float DeltaSeconds);
+    FVector SampleFlowForward(const FVector& DirectDirection) const;
+    FVector ApplySeparation(const FVector& Desired) const;
+    void SetFlowFieldAgentRegistered(bool bRegistered);
+    void UpdateMovementFidelity(float DistanceToPlayer, float DeltaSeconds);
+    void UpdateTickSignificance(float DistanceToPlayer);
+    const FNazareneQualityTier* ActiveQualityTier() const;
+    void EnterKinematicMovement();
+    void ExitKinematicMovement();
+    bool RefreshKinematicGroundHeight();
+    bool IsKinematicBodyBlocked() const;
     bool TryShieldBlock(ANazarenePlayerCharacter* Source, float PoiseDamage);
     void BecomeRedeemed(ANazarenePlayerCharacter* Source, bool bGrantReward);
-
-    float EffectiveMoveSpeed() const;
-    float EffectiveAttackDamage() const;
-    float EffectivePostureDamage() const;
-    float EffectiveWindup() const;
-    float EffectiveRecovery() const;
-    float EffectiveParryStartRatio() const;
-    float EffectiveParryEndRatio() const;
-    float PhaseSpeedScale() const;
+    void ResetTransientState();
+    void HandleIncomingDamage(float Damage, float PoiseDamage, AActor* DamageInstigator);
 
 private:
     UPROPERTY(VisibleAnywhere, Category = "Components")
@@ -254,12 +375,29 @@ private:
     UPROPERTY(VisibleAnywhere, Category = "Components")
     TObjectPtr<UStaticMeshComponent> CrownMesh;
 
+    UPROPERTY(VisibleAnywhere, Category = "Components")
+    TObjectPtr<UNazareneWeaponTraceComponent> WeaponTrace;
+
     UPROPERTY()
     TWeakObjectPtr<ANazarenePlayerCharacter> TargetPlayer;
 
+    UPROPERTY()
+    TWeakObjectPtr<UNazareneCombatSimSubsystem> CombatSim;
+
+    UPROPERTY()
+    TWeakObjectPtr<UNazareneFrameBudgetSubsystem> FrameBudget;
+
+    /** Target-only ability system: no abilities, no replication, no tick; it exists so miracles can apply effects. */
+    UPROPERTY(VisibleAnywhere, Category = "Abilities")
+    TObjectPtr<UNazareneAbilitySystemComponent> AbilitySystemComponent;
+
+    UPROPERTY()
+    TObjectPtr<UNazareneAttributeSet> AttributeSet;
+
     FVector SpawnLocation = FVector::ZeroVector;
     FRotator SpawnRotation = FRotator::ZeroRotator;
 
+    FRandomStream DecisionStream;
     float StateTimer = 0.0f;
     float WindupDuration = 0.0f;
     float WindupElapsed = 0.0f;
@@ -270,5 +408,13 @@ private:
     bool bPhase2WaveSpawned = false;
     bool bPhase3WaveSpawned = false;
     float DoubleStrikeCooldown = 0.0f;
+    int32 AnimUpdateRateTier = INDEX_NONE;
+    bool bRegisteredForAnimationSharing = false;
+    bool bKinematicMovement = false;
+    bool bCombatSuppressed = false;
+    float KinematicGroundZ = 0.0f;
+    float KinematicGroundRefreshTimer = 0.0f;
+    /** Last glide position confirmed clear of static geometry; ExitKinematicMovement falls back to it. */
+    FVector KinematicClearLocation = FVector::ZeroVector;
 };
 
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Task.h"
+#include "NazareneFlowFieldSubsystem.generated.h"
+
+/** Result of one integration pass toward the player; built on a worker and swapped in whole. */
+struct FNazareneFlowFieldBuild
+{
+    FIntPoint GoalCell = FIntPoint(INDEX_NONE, INDEX_NONE);
+    TArray<int32> Integration;
+    TArray<FVector2f> Directions;
+};
+
+/**
+ * Shared flow field toward the player for every chasing enemy in the region.
+ * Walkability is sampled once per region (time-sliced, nav queries stay on the game thread);
+ * integration and direction passes run on a worker whenever the player changes cell.
+ */
+UCLASS()
+class THENAZARENEAAA_API UNazareneFlowFieldSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** Rebuild the walkability grid covering the given region bounds. */
+    void BuildRegionGrid(const FBox& RegionBounds);
+
+    /** Drop the grid and any pending build (region unload). */
+    void ClearRegionGrid();
+
+    void RegisterAgent(AActor* Agent);
+    void UnregisterAgent(AActor* Agent);
+
+    /** Unit 2D direction toward the player along the field, or zero if the cell is unknown/unreachable. */
+    FVector SampleFlowDirection(const FVector& Location) const;
+
+    /** Push-apart steering from agents in the neighbouring separation buckets. */
+    FVector ComputeSeparation(const AActor* Agent, const FVector& Location, float Radius) const;
+
+    bool HasFlowField() const { return FrontField.IsValid(); }
+
+    UPROPERTY(EditAnywhere, Category = "Navigation")
+    float CellSize = 100.0f;
+
+    UPROPERTY(EditAnywhere, Category = "Navigation")
+    int32 WalkabilitySamplesPerTick = 768;
+
+    UPROPERTY(EditAnywhere, Category = "Navigation")
+    float MinRebuildInterval = 0.15f;
+
+    UPROPERTY(EditAnywhere, Category = "Navigation")
+    float SeparationBucketSize = 200.0f;
+
+private:
+    void SampleWalkability(int32 Budget);
+    void KickRebuild(const FIntPoint& GoalCell);
+    void RebuildSeparationBuckets();
+    bool WorldToCell(const FVector& Location, FIntPoint& OutCell) const;
+    FIntPoint ToBucket(const FVector& Location) const;
+
+    static void BuildIntegrationField(const TArray<uint8>& Walkable, int32 Width, int32 Height, FNazareneFlowFieldBuild& Build);
+
+private:
+    FVector GridOrigin = FVector::ZeroVector;
+    int32 GridWidth = 0;
+    int32 GridHeight = 0;
+    int32 WalkabilityCursor = 0;
+    bool bWalkabilityReady = false;
+    TArray<uint8> Walkable;
+
+    TSharedPtr<FNazareneFlowFieldBuild, ESPMode::ThreadSafe> FrontField;
+    TSharedPtr<FNazareneFlowFieldBuild, ESPMode::ThreadSafe> PendingField;
+    UE::Tasks::FTask BuildTask;
+    FIntPoint RequestedGoalCell = FIntPoint(INDEX_NONE, INDEX_NONE);
+    float TimeSinceRebuild = 0.0f;
+
+    /** Snapshot taken when the buckets are rebuilt; Agents may change before the next rebuild. */
+    struct FSeparationEntry
+    {
+        /** Identity only, never dereferenced. */
+        const AActor* Agent = nullptr;
+        FVector Location = FVector::ZeroVector;
+    };
+
+    TArray<TWeakObjectPtr<AActor>> Agents;
+    TMultiMap<FIntPoint, FSeparationEntry> AgentBuckets;
+};
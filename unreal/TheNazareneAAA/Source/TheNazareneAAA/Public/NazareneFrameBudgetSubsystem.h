@@ -0,0 +1,125 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NazareneFrameBudgetSubsystem.generated.h"
+
+class UPointLightComponent;
+
+/** One step of gameplay-side scalability. Tier 0 is full quality; later tiers shed load. */
+USTRUCT(BlueprintType)
+struct FNazareneQualityTier
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Scalability")
+    FName Name;
+
+    /** Ambient Niagara instances kept running per ambient type in a region. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Scalability")
+    int32 AmbientVFXPerType = 5;
+
+    /** Point lights left enabled, nearest to the view first. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Scalability")
+    int32 MaxPointLights = 32;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Scalability")
+    int32 MaxEnemyHealthBars = 12;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Scalability")
+    int32 MaxDamageNumbersPerFrame = 6;
+
+    /** Scales the distances at which enemies go kinematic, tick less often and evaluate anims less often. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Scalability")
+    float EnemySignificanceScale = 1.0f;
+
+    /** Actor tick interval for calm enemies past their significance distance; 0 ticks every frame. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Scalability")
+    float DistantEnemyTickInterval = 0.0f;
+
+    /** Added to each enemy's distance-based anim update-rate tier. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Scalability")
+    int32 AnimUROTierBias = 0;
+};
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FNazareneQualityTierChangedSignature, int32 /*TierIndex*/, const FNazareneQualityTier& /*Tier*/);
+
+/**
+ * Frame-budget governor. Watches smoothed game- and render-thread frame times against the
+ * target frame budget and steps through QualityTiers: down quickly when the budget is blown,
+ * back up slowly once there is clear headroom, never more often than MinSecondsBetweenChanges.
+ * Ambient VFX and point lights are pushed a budget on change; HUD caps and enemy thresholds
+ * read the active tier when they need it.
+ */
+UCLASS()
+class THENAZARENEAAA_API UNazareneFrameBudgetSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UNazareneFrameBudgetSubsystem();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    int32 GetActiveTierIndex() const { return ActiveTier; }
+    const FNazareneQualityTier& GetActiveTier() const;
+
+    /** Active tier of the world's governor, or null outside a game world. */
+    static const FNazareneQualityTier* FindActiveTier(const UObject* WorldContextObject);
+
+    /** Pin a tier (for captures and benchmarks); INDEX_NONE returns to adaptive control. */
+    void SetTierOverride(int32 TierIndex);
+
+    FNazareneQualityTierChangedSignature OnQualityTierChanged;
+
+    UPROPERTY(EditAnywhere, Category = "Scalability")
+    TArray<FNazareneQualityTier> QualityTiers;
+
+    /** Frame rate the governor defends; the player's frame rate limit wins when it is lower. */
+    UPROPERTY(EditAnywhere, Category = "Scalability")
+    float TargetFrameRate = 60.0f;
+
+    /** Step down once the slower thread stays above this fraction of the budget for DowngradeHoldSeconds. */
+    UPROPERTY(EditAnywhere, Category = "Scalability")
+    float DowngradeBudgetFraction = 1.05f;
+
+    /** Step up once the slower thread stays below this fraction of the budget for UpgradeHoldSeconds. */
+    UPROPERTY(EditAnywhere, Category = "Scalability")
+    float UpgradeBudgetFraction = 0.75f;
+
+    UPROPERTY(EditAnywhere, Category = "Scalability")
+    float DowngradeHoldSeconds = 1.5f;
+
+    UPROPERTY(EditAnywhere, Category = "Scalability")
+    float UpgradeHoldSeconds = 8.0f;
+
+    UPROPERTY(EditAnywhere, Category = "Scalability")
+    float MinSecondsBetweenChanges = 3.0f;
+
+    /** Frames longer than this (loads, travel) are not counted against the budget. */
+    UPROPERTY(EditAnywhere, Category = "Scalability")
+    float IgnoreFramesLongerThanSeconds = 0.25f;
+
+    UPROPERTY(EditAnywhere, Category = "Scalability")
+    float PointLightRefreshSeconds = 1.0f;
+
+private:
+    float ResolveFrameBudgetMilliseconds() const;
+    void SetActiveTier(int32 NewTier);
+    void ApplyTierBudgets();
+    void ApplyPointLightBudget();
+
+    TArray<TWeakObjectPtr<UPointLightComponent>> BudgetDisabledLights;
+
+    double SmoothedGameThreadMilliseconds = 0.0;
+    double SmoothedRenderThreadMilliseconds = 0.0;
+    float OverBudgetSeconds = 0.0f;
+    float UnderBudgetSeconds = 0.0f;
+    float SecondsSinceTierChange = 0.0f;
+    float PointLightRefreshTimer = 0.0f;
+    int32 ActiveTier = 0;
+    int32 TierOverride = INDEX_NONE;
+};
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NativeGameplayTags.h"
+
+/** Gameplay tags registered at module load, so lookups are resolved once instead of by string per cast. */
+namespace NazareneGameplayTags
+{
+    THENAZARENEAAA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Miracle_FaithCost);
+    THENAZARENEAAA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Miracle_Cooldown);
+    THENAZARENEAAA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Miracle_Damage);
+    THENAZARENEAAA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Miracle_PoiseDamage);
+
+    THENAZARENEAAA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Cooldown_Miracle_Heal);
+    THENAZARENEAAA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Cooldown_Miracle_Blessing);
+    THENAZARENEAAA_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Cooldown_Miracle_Radiance);
+}
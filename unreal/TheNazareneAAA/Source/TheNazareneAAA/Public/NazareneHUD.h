@@ -7,6 +7,7 @@
 
 class UNazareneHUDWidget;
 class UNazareneCursorWidget;
+struct FNazareneCombatEvent;
 
 UCLASS()
 class THENAZARENEAAA_API ANazareneHUD : public AHUD
@@ -15,6 +16,7 @@ class THENAZARENEAAA_API ANazareneHUD : public AHUD
 
 public:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void DrawHUD() override;
 
     UFUNCTION(BlueprintCallable, Category = "HUD")
@@ -56,9 +58,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "HUD")
     bool ToggleSkillTree();
 
+    /** Damage numbers shown per frame from the combat event bus; coalesced hits count once. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HUD")
+    int32 MaxDamageNumbersPerFrame = 6;
+
 private:
     void ApplyInitialMenuState();
     void ApplyMenuInputMode(bool bMenuVisible);
+    void HandleCombatEvents(TConstArrayView<FNazareneCombatEvent> Events);
 
 private:
     UPROPERTY()
@@ -67,6 +74,8 @@ private:
     UPROPERTY()
     TObjectPtr<UNazareneCursorWidget> CursorWidget;
 
+    FDelegateHandle CombatEventsHandle;
+
     FString RegionName = TEXT("Chapter 1: Galilee Shores");
     FString Objective = TEXT("Redeem the guardian.");
 };
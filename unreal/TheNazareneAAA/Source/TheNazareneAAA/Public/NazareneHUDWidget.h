@@ -9,9 +9,11 @@ class ANazareneEnemyCharacter;
 class ANazarenePlayerCharacter;
 class UButton;
 class UBorder;
+class UCanvasPanel;
 class UCanvasPanelSlot;
 class UProgressBar;
 class UTextBlock;
+class UWidget;
 class UNazareneDamageNumberWidget;
 class UNazareneEnemyHealthBarWidget;
 class UNazareneSkillTreeWidget;
@@ -147,10 +149,39 @@ private:
     void HandleSkillTreeClosePressed();
 
 private:
+    /** Menu panels built on first open or on idle frames rather than in NativeOnInitialized. */
+    enum class EMenuPanel : uint8
+    {
+        Start,
+        Pause,
+        Options,
+        Death,
+        Loading,
+        SkillTree,
+        Count
+    };
+
     void RefreshResponsiveMenuLayout();
     void SetGameplayHUDVisible(bool bVisible);
     void RefreshOptionsSummary();
 
+    bool IsPanelBuilt(EMenuPanel Panel) const;
+    void EnsurePanelBuilt(EMenuPanel Panel);
+    void BuildStartMenu();
+    void BuildPauseMenu();
+    void BuildOptionsMenu();
+    void BuildDeathOverlay();
+    void BuildLoadingOverlay();
+    void BuildSkillTree();
+    void TickMenuPrewarm(float DeltaTime);
+
+    /** -NazareneHUDBenchmark: log init/first-frame cost and the deferred panel cost, then quit. */
+    void ReportStartupBenchmark();
+    int32 CountWidgets() const;
+
+    UPROPERTY()
+    TObjectPtr<UCanvasPanel> RootCanvas;
+
     UPROPERTY()
     TObjectPtr<UTextBlock> HealthText;
 
@@ -187,15 +218,21 @@ private:
     UPROPERTY()
     TObjectPtr<UTextBlock> MessageText;
 
+    /** Invalidation box around the vitals panel. */
     UPROPERTY()
-    TObjectPtr<UBorder> PlayerPanelRoot;
+    TObjectPtr<UWidget> PlayerPanelRoot;
 
+    /** Invalidation box around the region/objective panel. */
     UPROPERTY()
-    TObjectPtr<UBorder> ObjectivePanelRoot;
+    TObjectPtr<UWidget> ObjectivePanelRoot;
 
     UPROPERTY()
     TObjectPtr<UTextBlock> ControlsTextRoot;
 
+    /** Retainer box holding the controls strip. */
+    UPROPERTY()
+    TObjectPtr<UWidget> ControlsPanelRoot;
+
     UPROPERTY()
     TObjectPtr<UBorder> StartMenuOverlay;
 
@@ -305,6 +342,14 @@ private:
     float MessageTimer = 0.0f;
     bool bOptionsOpenedFromStartMenu = true;
 
+    double InitializeStartSeconds = 0.0;
+    double InitializeMilliseconds = 0.0;
+    double PanelBuildMilliseconds[static_cast<int32>(EMenuPanel::Count)] = {};
+    float MenuPrewarmDelayRemaining = 2.0f;
+    int32 PrewarmCursor = 0;
+    bool bStartupBenchmark = false;
+    bool bFirstFrameTicked = false;
+
     float DisplayedHealthPercent = 1.0f;
     float DisplayedStaminaPercent = 1.0f;
     float BarLerpSpeed = 4.5f;
@@ -314,6 +359,15 @@ private:
     bool bHealthCritical = false;
     bool bStaminaCritical = false;
 
+    // Last strings pushed to the vitals text blocks; unchanged values skip SetText and its invalidation.
+    FString DisplayedHealthLabel;
+    FString DisplayedStaminaLabel;
+    FString DisplayedFaithLabel;
+    FString DisplayedLockTargetLabel;
+    FString DisplayedContextHint;
+    FString DisplayedCriticalState;
+    FString DisplayedCombatState;
+
     UPROPERTY()
     TObjectPtr<UProgressBar> FaithBar;
 
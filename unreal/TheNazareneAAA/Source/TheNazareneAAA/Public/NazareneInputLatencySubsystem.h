@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "NazareneInputLatencySubsystem.generated.h"
+
+/** Player actions with an end-to-end latency probe; values index the CSV rows. */
+UENUM()
+enum class ENazareneLatencyProbe : uint8
+{
+    LightAttack = 0,
+    HeavyAttack = 1,
+    Dodge = 2,
+    Parry = 3,
+    Block = 4,
+    Miracle = 5,
+    Count UMETA(Hidden)
+};
+
+/** Fixed-bucket latency histogram in milliseconds. */
+struct FNazareneLatencyHistogram
+{
+    static constexpr int32 NumBuckets = 11;
+
+    /** Upper edge of each bucket but the last, which is open-ended. */
+    static const float BucketEdgesMs[NumBuckets - 1];
+
+    void Add(float Milliseconds);
+
+    uint32 Buckets[NumBuckets] = {};
+    uint32 Count = 0;
+    double SumMs = 0.0;
+    float MaxMs = 0.0f;
+};
+
+/**
+ * End-to-end input latency probes. Each combat press opens a probe stamped with the platform
+ * time of its Enhanced Input callback; the probe is closed in two stages, when gameplay state
+ * acts on it (attack windup start, dodge impulse, block flag, parry window open) and when the
+ * first frame showing that state has been rendered. Results go to per-probe histograms, the
+ * NazareneCombat stats and a CSV under Saved/Profiling written on shutdown and when an input
+ * replay finishes, so a headless replay (-nullrhi -NazareneReplayInput=...) yields a report.
+ * On by default outside shipping builds; -NoNazareneLatencyProbes disables it and
+ * -NazareneLatencyCsv=<file> names the report.
+ */
+UCLASS()
+class THENAZARENEAAA_API UNazareneInputLatencySubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** Open a probe for one press. Returns its id, or 0 when probes are off. */
+    int32 BeginProbe(ENazareneLatencyProbe Probe);
+
+    /** Gameplay acted on the press that opened ProbeId. */
+    void MarkActed(int32 ProbeId);
+
+    /** The press was discarded (replaced, cancelled, flushed or expired) before gameplay acted on it. */
+    void DropProbe(int32 ProbeId);
+
+    static int32 Begin(const UObject* WorldContextObject, ENazareneLatencyProbe Probe);
+    static void Acted(const UObject* WorldContextObject, int32 ProbeId);
+    static void Drop(const UObject* WorldContextObject, int32 ProbeId);
+
+    const FNazareneLatencyHistogram& GetHistogram(ENazareneLatencyProbe Probe, bool bDisplayStage) const;
+
+    /** Write the CSV report and log a summary line per probe. */
+    bool WriteReport() const;
+
+    void ResetHistograms();
+
+    /** Probes neither acted on nor dropped by their owner are discarded after this long. */
+    UPROPERTY(EditAnywhere, Category = "Profiling")
+    float MaxPendingSeconds = 1.0f;
+
+private:
+    struct FPendingProbe
+    {
+        int32 Id = 0;
+        ENazareneLatencyProbe Probe = ENazareneLatencyProbe::LightAttack;
+        double PressedSeconds = 0.0;
+        double ActedSeconds = 0.0;
+        /** Frame ends seen since gameplay acted; the render thread trails the game thread by one frame. */
+        int32 FrameEndsSinceActed = INDEX_NONE;
+    };
+
+    void HandleEndFrame();
+
+    TArray<FPendingProbe> PendingProbes;
+    int32 LastProbeId = 0;
+    FNazareneLatencyHistogram ActedHistograms[static_cast<int32>(ENazareneLatencyProbe::Count)];
+    FNazareneLatencyHistogram DisplayHistograms[static_cast<int32>(ENazareneLatencyProbe::Count)];
+
+    FString ReportFilePath;
+    FDelegateHandle EndFrameHandle;
+    bool bEnabled = false;
+};
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "NazareneInputReplaySubsystem.generated.h"
+
+class ANazarenePlayerCharacter;
+class UInputAction;
+
+/** One change of an action's value; values persist until the next event for the same action. */
+struct FNazareneInputReplayEvent
+{
+    uint32 Frame = 0;
+    uint8 ActionIndex = 0;
+    float Value = 0.0f;
+};
+
+UENUM()
+enum class ENazareneInputReplayMode : uint8
+{
+    Idle = 0,
+    RecordArmed = 1,
+    Recording = 2,
+    ReplayArmed = 3,
+    Replaying = 4
+};
+
+/**
+ * Captures the player's Enhanced Input action values per frame into a compact change list
+ * and injects them back for benchmark replays. Armed from the command line with
+ * -NazareneRecordInput=<file> or -NazareneReplayInput=<file> (add -NazareneReplayQuit to exit
+ * when playback ends); capture and playback start when the start menu is dismissed.
+ * Run replays with -benchmark -fps=60 (optionally -nullrhi) for identical frame timing.
+ */
+UCLASS()
+class THENAZARENEAAA_API UNazareneInputReplaySubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+    virtual ETickableTickType GetTickableTickType() const override;
+    virtual bool IsTickable() const override;
+    virtual bool IsTickableWhenPaused() const override { return true; }
+    virtual UWorld* GetTickableGameObjectWorld() const override;
+
+    UFUNCTION(BlueprintCallable, Category = "Replay")
+    bool StartRecording(const FString& FilePath);
+
+    UFUNCTION(BlueprintCallable, Category = "Replay")
+    bool StopRecording();
+
+    UFUNCTION(BlueprintCallable, Category = "Replay")
+    bool StartReplay(const FString& FilePath);
+
+    UFUNCTION(BlueprintPure, Category = "Replay")
+    bool IsReplayActive() const { return Mode == ENazareneInputReplayMode::ReplayArmed || Mode == ENazareneInputReplayMode::Replaying; }
+
+    /** Called when gameplay takes input (start menu dismissed); armed captures and replays begin here. */
+    void NotifyGameplayStarted(ANazarenePlayerCharacter* Player);
+
+    /** Seed stored in the loaded replay, which the campaign must reuse for enemy decision streams. */
+    bool GetReplaySeed(int32& OutSeed) const;
+
+    /** Seed written into the capture header. */
+    void SetRecordingSeed(int32 Seed) { RecordingSeed = Seed; }
+
+private:
+    bool BindPlayer(ANazarenePlayerCharacter* Player);
+    void TickRecording();
+    void TickReplay();
+    void FinishReplay();
+    bool WriteCapture() const;
+    bool ReadCapture(const FString& FilePath);
+
+private:
+    ENazareneInputReplayMode Mode = ENazareneInputReplayMode::Idle;
+    FString CaptureFilePath;
+
+    TWeakObjectPtr<ANazarenePlayerCharacter> BoundPlayer;
+
+    UPROPERTY()
+    TArray<TObjectPtr<UInputAction>> TrackedActions;
+
+    TArray<FName> CaptureActionNames;
+    TArray<int32> ReplayToTracked;
+    TArray<float> CurrentValues;
+    TArray<FNazareneInputReplayEvent> Events;
+
+    int32 RecordingSeed = 0;
+    int32 ReplaySeed = 0;
+    bool bHasReplaySeed = false;
+    bool bQuitWhenReplayEnds = false;
+
+    uint32 Frame = 0;
+    int32 ReplayCursor = 0;
+    uint32 ReplayFrameCount = 0;
+    double ReplayStartSeconds = 0.0;
+    double LastFrameSeconds = 0.0;
+    double WorstFrameMilliseconds = 0.0;
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "NazareneMemoryReportSubsystem.generated.h"
+
+/** One system's memory in one region capture. */
+struct FNazareneMemorySample
+{
+    int32 Capture = 0;
+    FName RegionId;
+    FName System;
+    float Megabytes = 0.0f;
+    /** Zero when no budget is configured. */
+    float BudgetMegabytes = 0.0f;
+
+    bool IsOverBudget() const { return BudgetMegabytes > 0.0f && Megabytes > BudgetMegabytes; }
+};
+
+/**
+ * Per-region memory budget report. A capture is scheduled after every LoadRegion and taken once the
+ * region has settled: process memory as "Total", plus the Nazarene/ LLM tags when running with -llm.
+ * Each sample is compared against the [NazareneMemoryBudgets] section of Config/NazareneMemoryBudgets.ini
+ * (or the game ini), where "<System>=MB" sets a default and "<RegionId>.<System>=MB" overrides it for
+ * one region. Results are logged, over-budget systems warn, and the session's captures go to a CSV under
+ * Saved/Profiling. On by default outside shipping builds; -NoNazareneMemoryReport disables it and
+ * -NazareneMemoryCsv=<file> names the report.
+ */
+UCLASS()
+class THENAZARENEAAA_API UNazareneMemoryReportSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** Capture RegionId after CaptureDelaySeconds; a newer request replaces a pending one. */
+    void ScheduleRegionCapture(FName RegionId);
+
+    /** Capture now, log it, compare against budgets and rewrite the CSV. Returns the number of systems over budget. */
+    int32 CaptureRegion(FName RegionId);
+
+    const TArray<FNazareneMemorySample>& GetSamples() const { return Samples; }
+
+    /** Lets streamed region content, presentation assets and ambient VFX settle before measuring. */
+    UPROPERTY(EditAnywhere, Category = "Profiling")
+    float CaptureDelaySeconds = 3.0f;
+
+private:
+    void CapturePendingRegion();
+    float FindBudgetMegabytes(FName RegionId, FName System) const;
+    bool WriteReport() const;
+
+    TArray<FNazareneMemorySample> Samples;
+    int32 CaptureCount = 0;
+    FString ReportFilePath;
+    FTimerHandle CaptureTimer;
+    FName PendingRegionId;
+    bool bEnabled = false;
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+/**
+ * Low-level memory tracker tags for the game's systems, reported under Nazarene/ when running with -llm
+ * ("stat LLMFULL", -llmcsv). Allocation sites open LLM_SCOPE_BYTAG(Nazarene_Regions) and friends; the
+ * innermost scope wins, so an enemy spawned while placing region actors is charged to Enemies. Assets
+ * streamed on the loading thread are not under these scopes and show up in the engine's asset tags.
+ * Everything here compiles out when LLM is disabled.
+ */
+LLM_DECLARE_TAG_API(Nazarene, THENAZARENEAAA_API);
+LLM_DECLARE_TAG_API(Nazarene_Regions, THENAZARENEAAA_API);
+LLM_DECLARE_TAG_API(Nazarene_Enemies, THENAZARENEAAA_API);
+LLM_DECLARE_TAG_API(Nazarene_VFX, THENAZARENEAAA_API);
+LLM_DECLARE_TAG_API(Nazarene_Music, THENAZARENEAAA_API);
+LLM_DECLARE_TAG_API(Nazarene_HUD, THENAZARENEAAA_API);
+LLM_DECLARE_TAG_API(Nazarene_Save, THENAZARENEAAA_API);
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NazareneTypes.h"
+#include "NazareneMusicSubsystem.generated.h"
+
+class UAudioComponent;
+class USoundBase;
+struct FStreamableHandle;
+
+/**
+ * Region music as synchronized stems. A region's base track may have layer stems next to it
+ * named <Base>_Tension, <Base>_Combat, <Base>_Boss and <Base>_Victory; all of them start together
+ * and the music state only changes layer volumes through audio-thread fades, so nothing here
+ * ticks. Stems are streamed asynchronously, and the next region's set can be preloaded.
+ */
+UCLASS()
+class THENAZARENEAAA_API UNazareneMusicSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    /** Crossfade to a region's stems once they finish streaming; a null track fades music out. */
+    void PlayRegion(const TSoftObjectPtr<USoundBase>& BaseTrack);
+
+    /** Start streaming a region's stems ahead of travel; the previous preload is released. */
+    void PreloadRegion(const TSoftObjectPtr<USoundBase>& BaseTrack);
+
+    void SetMusicState(ENazareneMusicState NewState);
+
+    UPROPERTY(EditAnywhere, Category = "Audio|Music")
+    float RegionCrossfadeSeconds = 2.0f;
+
+    UPROPERTY(EditAnywhere, Category = "Audio|Music")
+    float LayerFadeSeconds = 1.5f;
+
+    UPROPERTY(EditAnywhere, Category = "Audio|Music")
+    float MusicVolume = 0.75f;
+
+private:
+    enum class EMusicLayer : uint8
+    {
+        Base,
+        Tension,
+        Combat,
+        Boss,
+        Victory,
+        Count
+    };
+
+    static TArray<FSoftObjectPath> BuildStemPaths(const TSoftObjectPtr<USoundBase>& BaseTrack);
+    static float LayerVolume(EMusicLayer Layer, ENazareneMusicState State, bool bLayered);
+
+    TSharedPtr<FStreamableHandle> RequestStems(const TArray<FSoftObjectPath>& StemPaths, TFunction<void()> OnLoaded) const;
+    void StartStems(uint32 RequestId, TArray<FSoftObjectPath> StemPaths);
+    void FadeOutActiveStems();
+
+    UPROPERTY()
+    TArray<TObjectPtr<UAudioComponent>> ActiveStems;
+
+    TArray<EMusicLayer> ActiveStemLayers;
+    /** True when any layer besides the base is playing. */
+    bool bActiveStemsLayered = false;
+    FSoftObjectPath ActiveBaseTrack;
+
+    TSharedPtr<FStreamableHandle> ActiveHandle;
+    TSharedPtr<FStreamableHandle> PendingHandle;
+    TSharedPtr<FStreamableHandle> PreloadHandle;
+    FSoftObjectPath PreloadBaseTrack;
+
+    ENazareneMusicState MusicState = ENazareneMusicState::Peace;
+    uint32 PlayRequestId = 0;
+};
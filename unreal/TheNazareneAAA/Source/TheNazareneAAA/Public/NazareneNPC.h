@@ -6,6 +6,8 @@
 #include "NazareneNPC.generated.h"
 
 class ANazarenePlayerCharacter;
+class UAudioComponent;
+class USoundBase;
 class USphereComponent;
 class UStaticMeshComponent;
 
@@ -43,6 +45,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
 	UPROPERTY(VisibleAnywhere, Category = "Components")
@@ -60,6 +63,10 @@ private:
 	UFUNCTION()
 	void HandleOverlapEnd(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
 
+	void PlayVoiceLine(int32 LineIndex, USoundBase* VoiceClip);
+
+	TWeakObjectPtr<UAudioComponent> ActiveVoice;
+
 	int32 CurrentDialogueIndex = 0;
 	bool bPlayerInRange = false;
 
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "NazareneObjectChurnSubsystem.generated.h"
+
+class FNazareneObjectChurnCounter;
+
+/** One garbage collection as seen from the game thread. */
+struct FNazareneGCSample
+{
+    double TimeSeconds = 0.0;
+    float PauseMs = 0.0f;
+    float ReachabilityMs = 0.0f;
+    /** Objects destroyed inside the pause; with incremental purge the rest follow over later frames. */
+    int32 PurgedInPause = 0;
+};
+
+/** Cumulative churn of one class since tracking started. */
+struct FNazareneClassChurn
+{
+    FName ClassName;
+    uint64 Created = 0;
+    uint64 Destroyed = 0;
+};
+
+/**
+ * UObject churn and GC pressure tracker. While tracking, every UObject construction and destruction
+ * is counted per class; once a second the window is folded into the NazareneGC stats and appended to
+ * a CSV under Saved/Profiling, and every garbage collection's pause and reachability time goes to a
+ * second CSV next to it. Tracking costs a lock per object, so it is off unless started with
+ * -NazareneObjectChurn or the console command "Nazarene.ObjectChurn start|stop|dump|reset".
+ * -NazareneObjectChurnCsv=<file> names the report.
+ */
+UCLASS()
+class THENAZARENEAAA_API UNazareneObjectChurnSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UNazareneObjectChurnSubsystem();
+    virtual ~UNazareneObjectChurnSubsystem() override;
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    void StartTracking();
+
+    /** Stop counting and write the reports. */
+    void StopTracking();
+
+    /** Clear counts and GC samples; tracking state is unchanged. */
+    void ResetCounts();
+
+    /** Log the classes with the most churn since tracking started and the GC summary. */
+    void DumpSummary(int32 MaxClasses = 15) const;
+
+    /** Write the churn and GC CSVs. */
+    bool WriteReport() const;
+
+    bool IsTracking() const { return Counter.IsValid(); }
+
+    /** Game thread only; sorted by created plus destroyed, highest first. */
+    TArray<FNazareneClassChurn> GetClassChurn() const;
+
+    const TArray<FNazareneGCSample>& GetGCSamples() const { return GCSamples; }
+
+    /** Length of one churn window in seconds. */
+    UPROPERTY(EditAnywhere, Category = "Profiling")
+    float SampleIntervalSeconds = 1.0f;
+
+private:
+    void HandleEndFrame();
+    void HandlePreGarbageCollect();
+    void HandlePostReachabilityAnalysis();
+    void HandlePostGarbageCollect();
+
+    void FlushWindow(double Now);
+
+    TUniquePtr<FNazareneObjectChurnCounter> Counter;
+
+    /** One row per class and window: TimeSec,Class,Created,Destroyed. */
+    FString ChurnCsv;
+    TArray<FNazareneGCSample> GCSamples;
+    TMap<const UClass*, FNazareneClassChurn> Totals;
+
+    FString ReportFilePath;
+    FDelegateHandle EndFrameHandle;
+    FDelegateHandle PreGCHandle;
+    FDelegateHandle PostReachabilityHandle;
+    FDelegateHandle PostGCHandle;
+
+    double TrackingStartSeconds = 0.0;
+    double WindowStartSeconds = 0.0;
+    double GCStartSeconds = 0.0;
+    double ReachabilityEndSeconds = 0.0;
+    uint64 DestroyedAtGCStart = 0;
+};
@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
+#include "NazareneCombatSimSubsystem.h"
+#include "NazareneSkillTree.h"
 #include "NazareneTypes.h"
 #include "NazarenePlayerCharacter.generated.h"
 
@@ -22,7 +24,9 @@ class UNiagaraSystem;
 class UEnhancedInputComponent;
 class UNazareneAbilitySystemComponent;
 class UNazareneAttributeSet;
+class UNazareneWeaponTraceComponent;
 struct FInputActionValue;
+struct FStreamableHandle;
 
 UENUM()
 enum class ENazarenePlayerAttackType : uint8
@@ -32,8 +36,21 @@ enum class ENazarenePlayerAttackType : uint8
     Heavy = 2
 };
 
+/** Buffered combat actions, one per Enhanced Input action that can be retried. */
+UENUM()
+enum class ENazareneCombatInput : uint8
+{
+    LightAttack = 0,
+    HeavyAttack = 1,
+    Dodge = 2,
+    Parry = 3,
+    MiracleHeal = 4,
+    MiracleBlessing = 5,
+    MiracleRadiance = 6
+};
+
 UCLASS()
-class THENAZARENEAAA_API ANazarenePlayerCharacter : public ACharacter
+class THENAZARENEAAA_API ANazarenePlayerCharacter : public ACharacter, public INazareneCombatSimulated
 {
     GENERATED_BODY()
 
@@ -41,7 +58,9 @@ public:
     ANazarenePlayerCharacter();
 
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void Tick(float DeltaSeconds) override;
+    virtual void CombatStep(float StepSeconds) override;
     virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vitals")
@@ -113,6 +132,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Presentation|Animation")
     TSoftClassPtr<UAnimInstance> ProductionAnimBlueprint;
 
+    /** A combat press that arrives while the player is busy is retried each combat step for this long; 0 disables buffering. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Input")
+    float InputBufferSeconds = 0.2f;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
     float LightAttackDamage = 26.0f;
 
@@ -146,6 +169,26 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
     float HeavyAttackRange = 340.0f;
 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+    float LightAttackArcDegrees = 70.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+    float HeavyAttackArcDegrees = 80.0f;
+
+    /** Enemies one light swing can cleave through. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+    int32 LightAttackMaxTargets = 2;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+    int32 HeavyAttackMaxTargets = 4;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+    float AttackTraceRadius = 30.0f;
+
+    /** A locked-on target this far past the attack range is still struck when the swing opens. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+    float LockTargetReachLeniency = 70.0f;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Miracles")
     float HealAmount = 45.0f;
 
@@ -320,6 +363,20 @@ public:
     void SetActiveNPC(ANazareneNPC* NPC);
     void ClearActiveNPC(ANazareneNPC* NPC);
 
+    /** Every bound gameplay action, in a stable order, for input capture and replay. */
+    void GetReplayInputActions(TArray<UInputAction*>& OutActions) const;
+
+    /** Run Callback once the streamed presentation bundle has been applied; at once if it already has. */
+    void WhenPresentationReady(TFunction<void()> Callback);
+
+    bool IsPresentationReady() const { return bPresentationReady; }
+
+    /** Game-thread cost of BeginPlay, the part of the spawn the spawning frame pays for. */
+    float GetBeginPlayMilliseconds() const { return BeginPlayMilliseconds; }
+
+    /** BeginPlay start to the presentation bundle being applied. */
+    float GetPresentationReadyMilliseconds() const { return PresentationReadyMilliseconds; }
+
     UFUNCTION(BlueprintCallable, Category = "Abilities")
     UNazareneAbilitySystemComponent* GetNazareneAbilitySystemComponent() const { return AbilitySystemComponent; }
 
@@ -327,9 +384,12 @@ public:
     UNazareneAttributeSet* GetNazareneAttributeSet() const { return AttributeSet; }
 
 private:
-    void TriggerPresentation(USoundBase* Sound, UNiagaraSystem* Effect, const FVector& Location, float VolumeMultiplier = 1.0f) const;
+    void TriggerPresentation(USoundBase* Sound, UNiagaraSystem* Effect, const FVector& Location, float VolumeMultiplier = 1.0f, ENazareneCombatAudioCategory AudioCategory = ENazareneCombatAudioCategory::Attack) const;
     void ConfigureProxyVisuals();
     void SetProxyVisualsHidden(bool bHideProxy);
+    void GetPresentationAssetPaths(TArray<FSoftObjectPath>& OutPaths) const;
+    void RequestPresentationAssets();
+    void ApplyPresentationAssets();
 
     void InitializeEnhancedInputDefaults();
     void RegisterEnhancedInputMappingContext() const;
@@ -353,13 +413,19 @@ private:
     void StartBlock();
     void StopBlock();
 
-    void TryLightAttack();
-    void TryHeavyAttack();
-    void TryDodge();
-    void TryParry();
-    void TryHealingMiracle();
-    void TryBlessingMiracle();
-    void TryRadianceMiracle();
+    void OnCombatInput(ENazareneCombatInput Input);
+    bool TryCombatInput(ENazareneCombatInput Input, int32 LatencyProbeId);
+    void ProcessBufferedCombatInputs(float StepSeconds);
+    void ClearBufferedCombatInputs();
+    static int32 CombatInputPriority(ENazareneCombatInput Input);
+
+    bool TryLightAttack();
+    bool TryHeavyAttack();
+    bool TryDodge();
+    bool TryParry();
+    bool TryHealingMiracle();
+    bool TryBlessingMiracle();
+    bool TryRadianceMiracle();
 
     void TrySaveSlot1();
     void TrySaveSlot2();
@@ -374,13 +440,14 @@ private:
     void RegenStamina(float DeltaSeconds);
     void UpdateMovementState(float DeltaSeconds);
     void UpdateCameraState(float DeltaSeconds);
-    void ResolvePendingAttack();
-    ANazareneEnemyCharacter* FindAttackTarget(float MaxDistance, float ArcDegrees) const;
+    void BeginAttackSwing();
+    void HandleWeaponHit(AActor* HitActor, const FHitResult& Hit);
+    void ApplyAttackHit(ANazareneEnemyCharacter* Enemy, ENazarenePlayerAttackType AttackType);
     void ValidateLockTarget();
     void ClearLockTarget();
     bool IsBusy() const;
     bool ConsumeStamina(float Cost);
-    void ApplyHealthDamage(float Amount);
+    void ApplyHealthDamage(float Amount, AActor* DamageSource = nullptr);
     void HandleDefeat();
     void ApplySkillModifiers();
     static int32 XPForLevel(int32 LevelValue);
@@ -392,12 +459,16 @@ private:
     UPROPERTY(VisibleAnywhere, Category = "Abilities")
     TObjectPtr<UNazareneAttributeSet> AttributeSet;
 
+    UPROPERTY(VisibleAnywhere, Category = "Combat")
+    TObjectPtr<UNazareneWeaponTraceComponent> WeaponTrace;
+
 private:
     UPROPERTY()
     TObjectPtr<UInputMappingContext> RuntimeInputMappingContext;
 
+    /** Cooked mapping context; empty resolves PlayerInputMappingContext, falling back to mappings built once at runtime. */
     UPROPERTY(EditDefaultsOnly, Category = "Input|Assets")
-    TObjectPtr<UInputMappingContext> InputMappingContextAsset;
+    TSoftObjectPtr<UInputMappingContext> InputMappingContextAsset;
 
     UPROPERTY()
     TObjectPtr<UInputAction> MoveForwardInputAction;
@@ -493,20 +564,27 @@ private:
     TObjectPtr<UStaticMeshComponent> StaffMesh;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Presentation|Audio", meta = (AllowPrivateAccess = "true"))
-    TObjectPtr<USoundBase> LightAttackSound;
+    TSoftObjectPtr<USoundBase> LightAttackSound;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Presentation|Audio", meta = (AllowPrivateAccess = "true"))
-    TObjectPtr<USoundBase> HeavyAttackSound;
+    TSoftObjectPtr<USoundBase> HeavyAttackSound;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Presentation|Audio", meta = (AllowPrivateAccess = "true"))
-    TObjectPtr<USoundBase> DodgeSound;
+    TSoftObjectPtr<USoundBase> DodgeSound;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Presentation|Audio", meta = (AllowPrivateAccess = "true"))
-    TObjectPtr<USoundBase> MiracleSound;
+    TSoftObjectPtr<USoundBase> MiracleSound;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Presentation|Audio", meta = (AllowPrivateAccess = "true"))
-    TObjectPtr<USoundBase> HurtSound;
-
+    TSoftObjectPtr<USoundBase> HurtSound;
+
+    /** Mesh, anim class, robe material and combat sounds, streamed as one bundle on spawn and held for the pawn's lifetime. */
+    TSharedPtr<FStreamableHandle> PresentationHandle;
+    TArray<TFunction<void()>> PresentationReadyCallbacks;
+    double BeginPlayStartSeconds = 0.0;
+    float BeginPlayMilliseconds = 0.0f;
+    float PresentationReadyMilliseconds = 0.0f;
+    bool bPresentationReady = false;
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Presentation|VFX", meta = (AllowPrivateAccess = "true"))
     TObjectPtr<UNiagaraSystem> LightAttackVFX;
 
@@ -537,6 +615,9 @@ private:
     UPROPERTY()
     TWeakObjectPtr<ANazareneCampaignGameMode> CampaignGameMode;
 
+    UPROPERTY()
+    TWeakObjectPtr<UNazareneCombatSimSubsystem> CombatSim;
+
     UPROPERTY()
     float CurrentHealth = 0.0f;
 
@@ -550,6 +631,9 @@ private:
     float CampaignBaseMaxStamina = 100.0f;
 
     TArray<FName> UnlockedSkills;
+
+    /** UnlockedSkills folded into per-stat modifiers; rebuilt whenever UnlockedSkills changes. */
+    FNazareneCompiledSkillModifiers CompiledSkillModifiers;
     int32 TotalXP = 0;
     int32 PlayerLevel = 1;
     int32 UnspentSkillPoints = 0;
@@ -564,6 +648,7 @@ private:
     float AttackWindupTimer = 0.0f;
     float AttackActiveTimer = 0.0f;
     bool bAttackResolved = false;
+    ENazarenePlayerAttackType SwingAttackType = ENazarenePlayerAttackType::None;
 
     float AttackCooldown = 0.0f;
     float DodgeTimer = 0.0f;
@@ -577,6 +662,24 @@ private:
     float PerfectBlockTimer = 0.0f;
     float HurtTimer = 0.0f;
 
+    struct FBufferedCombatInput
+    {
+        ENazareneCombatInput Input = ENazareneCombatInput::LightAttack;
+        /** Combat-step time spent waiting, so expiry does not depend on frame rate. */
+        float AgeSeconds = 0.0f;
+        /** Latency probe opened by this press; dropped if the press is discarded. */
+        int32 LatencyProbeId = 0;
+    };
+
+    /** Oldest first. */
+    TArray<FBufferedCombatInput, TInlineAllocator<4>> BufferedCombatInputs;
+
+    /** Probe of the press TryCombatInput is serving; the Try* actions mark it acted. */
+    int32 ActingLatencyProbeId = 0;
+
+    /** Parry probe waiting for its window to open after startup. */
+    int32 ParryLatencyProbeId = 0;
+
     bool bIsBlocking = false;
     FVector DodgeDirection = FVector::ZeroVector;
     float MoveForwardAxis = 0.0f;
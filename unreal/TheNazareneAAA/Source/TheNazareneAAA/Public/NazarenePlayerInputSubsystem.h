@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "NazarenePlayerInputSubsystem.generated.h"
+
+class UInputAction;
+class UInputMappingContext;
+
+/** Input objects resolved for one mapping context, in the player character's action slot order. */
+USTRUCT()
+struct FNazareneSharedPlayerInput
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TObjectPtr<UInputMappingContext> MappingContext;
+
+    UPROPERTY()
+    TArray<TObjectPtr<UInputAction>> Actions;
+};
+
+/**
+ * Player input objects resolved once per game instance and shared by every player spawn, keyed by
+ * mapping context path; the null path holds the runtime-built defaults, which are outered here.
+ * Holding them as properties keeps them alive without rooting, and they go away with the game
+ * instance, so one PIE session never hands its objects to the next.
+ */
+UCLASS()
+class THENAZARENEAAA_API UNazarenePlayerInputSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    const FNazareneSharedPlayerInput* FindSharedInput(const FSoftObjectPath& ContextPath) const;
+    void AddSharedInput(const FSoftObjectPath& ContextPath, const FNazareneSharedPlayerInput& Input);
+
+private:
+    UPROPERTY()
+    TMap<FSoftObjectPath, FNazareneSharedPlayerInput> SharedInputs;
+};
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace NazareneProfiling
+{
+    /**
+     * Path for a profiling CSV: the value of CommandLineKey (e.g. "NazareneMemoryCsv=") if given, otherwise
+     * <DefaultPrefix>_<timestamp>.csv. Relative paths land under Saved/Profiling.
+     */
+    FString ResolveReportPath(const TCHAR* CommandLineKey, const TCHAR* DefaultPrefix);
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Engine/DataTable.h"
 #include "UObject/Object.h"
 #include "NazareneSkillTree.generated.h"
 
@@ -40,6 +41,59 @@ struct FNazareneSkillDefinition
     TArray<FName> Requires;
 };
 
+/** Player stats a skill can modify. */
+UENUM(BlueprintType)
+enum class ENazarenePlayerStat : uint8
+{
+    LightAttackDamage = 0,
+    HeavyAttackDamage = 1,
+    HeavyAttackPoiseDamage = 2,
+    HeavyAttackRange = 3,
+    WalkSpeed = 4,
+    DodgeStaminaCost = 5,
+    HealAmount = 6,
+    RadianceDamage = 7,
+    RadianceRadius = 8,
+    StaminaRegen = 9,
+    MaxHealth = 10,
+    MaxStamina = 11,
+    Count UMETA(Hidden)
+};
+
+/** One stat change granted by a skill. Rows in DT_SkillModifiers replace the built-in rows of the same skill. */
+USTRUCT(BlueprintType)
+struct FNazareneSkillModifierRow : public FTableRowBase
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly)
+    FName SkillId = NAME_None;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly)
+    ENazarenePlayerStat Stat = ENazarenePlayerStat::LightAttackDamage;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly)
+    float Multiplier = 1.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly)
+    float Additive = 0.0f;
+};
+
+/** Every unlocked skill folded into one multiplier and one addend per stat. */
+struct FNazareneCompiledSkillModifiers
+{
+    FNazareneCompiledSkillModifiers();
+
+    float Apply(ENazarenePlayerStat Stat, float BaseValue) const
+    {
+        const int32 Index = static_cast<int32>(Stat);
+        return BaseValue * Multipliers[Index] + Additives[Index];
+    }
+
+    float Multipliers[static_cast<int32>(ENazarenePlayerStat::Count)];
+    float Additives[static_cast<int32>(ENazarenePlayerStat::Count)];
+};
+
 UCLASS(BlueprintType)
 class THENAZARENEAAA_API UNazareneSkillTree : public UObject
 {
@@ -57,4 +111,14 @@ public:
 
     UFUNCTION(BlueprintCallable, Category = "Skills")
     static TArray<FName> GetBranchSkills(ENazareneSkillBranch Branch);
+
+    /**
+     * Fold the modifiers of UnlockedSkills using the rows held by the game instance's UNazareneSkillTreeSubsystem;
+     * recompile only when the unlocked set changes.
+     */
+    static FNazareneCompiledSkillModifiers CompileModifiers(const UObject* WorldContextObject, const TArray<FName>& UnlockedSkills);
+    static FNazareneCompiledSkillModifiers CompileModifiers(const TMap<FName, TArray<FNazareneSkillModifierRow>>& ModifierRows, const TArray<FName>& UnlockedSkills);
+
+    /** Built-in modifier rows per skill; rows in OverrideTable replace those of every skill it lists. */
+    static TMap<FName, TArray<FNazareneSkillModifierRow>> BuildModifierRows(const UDataTable* OverrideTable);
 };
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NazareneSkillTree.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "NazareneSkillTreeSubsystem.generated.h"
+
+class UDataTable;
+
+/**
+ * Skill modifier rows for the game instance: the built-in rows with DT_SkillModifiers (override key
+ * SkillModifierTable) applied. The table is loaded once on Initialize and held here, so it is
+ * released with the game instance instead of living in a function-local static.
+ */
+UCLASS()
+class THENAZARENEAAA_API UNazareneSkillTreeSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    const TMap<FName, TArray<FNazareneSkillModifierRow>>& GetModifierRows() const { return ModifierRows; }
+
+private:
+    UPROPERTY()
+    TObjectPtr<UDataTable> ModifierTable;
+
+    TMap<FName, TArray<FNazareneSkillModifierRow>> ModifierRows;
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Boot-to-menu timeline. Phases opened with FNazareneStartupScope are recorded from engine launch until
+ * the first start-menu frame, and synchronous package loads are attributed to the innermost open phase.
+ * MarkInteractive writes the critical-path report to the log and to a CSV under Saved/Profiling
+ * (-NazareneStartupCsv=<file>) once per boot. On by default outside shipping builds; -NoNazareneStartupProfile
+ * disables it. -NazareneStartupQuit exits at that frame either way.
+ */
+namespace NazareneStartupProfiler
+{
+    void BeginPhase(const TCHAR* PhaseName);
+    void EndPhase();
+
+    /** Close the timeline at the first interactive menu frame and write the report. Later calls do nothing. */
+    void MarkInteractive();
+
+    bool IsRecording();
+}
+
+/** Records one startup phase for the lifetime of the scope. */
+struct FNazareneStartupScope
+{
+    explicit FNazareneStartupScope(const TCHAR* PhaseName)
+    {
+        NazareneStartupProfiler::BeginPhase(PhaseName);
+    }
+
+    ~FNazareneStartupScope()
+    {
+        NazareneStartupProfiler::EndPhase();
+    }
+
+    FNazareneStartupScope(const FNazareneStartupScope&) = delete;
+    FNazareneStartupScope& operator=(const FNazareneStartupScope&) = delete;
+};
@@ -0,0 +1,8 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+/** Stat groups shared by several translation units; declare them only here so unity builds do not redefine them. */
+DECLARE_STATS_GROUP(TEXT("Nazarene Combat"), STATGROUP_NazareneCombat, STATCAT_Advanced);
+DECLARE_STATS_GROUP(TEXT("Nazarene Scalability"), STATGROUP_NazareneScalability, STATCAT_Advanced);
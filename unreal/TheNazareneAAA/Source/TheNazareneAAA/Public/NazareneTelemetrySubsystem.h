@@ -0,0 +1,118 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/CircularQueue.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "NazareneTelemetrySubsystem.generated.h"
+
+class FNazareneTelemetryWriter;
+class UNazareneCombatEventSubsystem;
+struct FNazareneCombatEvent;
+
+/** Record kinds; values are part of the file format. */
+enum class ENazareneTelemetryRecordType : uint16
+{
+    None = 0,
+    SessionStart = 1,
+    FrameSample = 2,
+    EnemyHit = 3,
+    PlayerHit = 4,
+    Block = 5,
+    Parry = 6,
+    PoiseBreak = 7,
+    EnemyRedeemed = 8,
+    PlayerDeath = 9,
+    Retry = 10,
+    RegionEnter = 11,
+    RegionComplete = 12,
+    BossPhase = 13
+};
+
+/**
+ * Fixed 32-byte telemetry record, written to disk as-is (little-endian).
+ * Layout is mirrored by Tools/read_combat_telemetry.py; bump the file version when it changes.
+ */
+struct FNazareneTelemetryRecord
+{
+    double TimeSeconds = 0.0;
+    uint32 Frame = 0;
+    uint16 Type = 0;
+    int16 RegionIndex = -1;
+    float Value = 0.0f;
+    float Aux = 0.0f;
+    uint32 Subject = 0;
+    uint32 Flags = 0;
+};
+static_assert(sizeof(FNazareneTelemetryRecord) == 32, "Telemetry records are fixed at 32 bytes.");
+
+/**
+ * Playtest combat telemetry. Records are stamped on the game thread and pushed into a
+ * single-producer queue; a background writer drains them into a preallocated ring file under
+ * Saved/Telemetry that keeps the newest records once full. On by default outside shipping
+ * builds; -NoNazareneTelemetry disables it and -NazareneTelemetry forces it on.
+ */
+UCLASS()
+class THENAZARENEAAA_API UNazareneTelemetrySubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+public:
+    UNazareneTelemetrySubsystem();
+    virtual ~UNazareneTelemetrySubsystem() override;
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+    virtual ETickableTickType GetTickableTickType() const override;
+    virtual bool IsTickable() const override { return IsRecording(); }
+    virtual UWorld* GetTickableGameObjectWorld() const override;
+
+    /** Game thread only. */
+    void Record(ENazareneTelemetryRecordType Type, float Value = 0.0f, float Aux = 0.0f, uint32 Subject = 0, uint32 Flags = 0);
+
+    void RecordRegionEnter(int32 InRegionIndex, int32 RetryCount);
+    void RecordRegionComplete();
+    void RecordPlayerDefeated(int32 RetryCount);
+
+    void SetSessionSeed(int32 Seed);
+
+    /** Subject written for damage with no enemy instigator; read_combat_telemetry.py shows it as "None". */
+    static constexpr uint32 NoArchetype = 0xFF;
+
+    UFUNCTION(BlueprintPure, Category = "Telemetry")
+    bool IsRecording() const { return Writer.IsValid(); }
+
+    UFUNCTION(BlueprintPure, Category = "Telemetry")
+    FString GetTelemetryFilePath() const { return TelemetryFilePath; }
+
+    /** Ring size in records; 65536 records is 2 MB of disk. */
+    UPROPERTY(EditAnywhere, Category = "Telemetry")
+    int32 RingCapacity = 65536;
+
+    UPROPERTY(EditAnywhere, Category = "Telemetry")
+    float FrameSampleInterval = 0.5f;
+
+private:
+    void BindCombatEvents(UWorld* World);
+    void HandleCombatEvents(TConstArrayView<FNazareneCombatEvent> Events);
+
+private:
+    TUniquePtr<TCircularQueue<FNazareneTelemetryRecord>> Queue;
+    TUniquePtr<FNazareneTelemetryWriter> Writer;
+    FString TelemetryFilePath;
+
+    TWeakObjectPtr<UNazareneCombatEventSubsystem> BoundCombatEvents;
+    FDelegateHandle CombatEventsHandle;
+
+    double SessionStartSeconds = 0.0;
+    double RegionEnterSeconds = 0.0;
+    int16 CurrentRegion = -1;
+    uint32 LastDamageArchetype = NoArchetype;
+
+    float FrameSampleElapsed = 0.0f;
+    float FrameSampleWorstMs = 0.0f;
+    uint32 FrameSampleCount = 0;
+};
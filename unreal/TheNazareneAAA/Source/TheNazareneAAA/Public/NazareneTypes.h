@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "UObject/SoftObjectPtr.h"
 #include "NazareneTypes.generated.h"
 
 class USoundBase;
@@ -220,8 +221,9 @@ struct FNazareneNPCDialogueLine
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     float DisplayDuration = 4.0f;
 
+    /** Streamed in while the player is near the speaking NPC; see UNazareneDialogueVoiceSubsystem. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    TObjectPtr<USoundBase> VoiceClip;
+    TSoftObjectPtr<USoundBase> VoiceClip;
 };
 
 USTRUCT(BlueprintType)
@@ -370,6 +372,28 @@ enum class ENazareneVFXType : uint8
     AmbientCrowdDust = 22 UMETA(DisplayName = "Crowd Dust")
 };
 
+UENUM(BlueprintType)
+enum class ENazareneMusicState : uint8
+{
+    Peace = 0,
+    Tension = 1,
+    Combat = 2,
+    Boss = 3,
+    Victory = 4
+};
+
+UENUM(BlueprintType)
+enum class ENazareneCombatAudioCategory : uint8
+{
+    Attack = 0,
+    Movement = 1,
+    Impact = 2,
+    Hurt = 3,
+    Guard = 4,
+    Redeem = 5,
+    Miracle = 6
+};
+
 /** Atmosphere preset for Dark Souls-quality per-region lighting and post-processing. */
 USTRUCT(BlueprintType)
 struct FNazareneAtmospherePreset
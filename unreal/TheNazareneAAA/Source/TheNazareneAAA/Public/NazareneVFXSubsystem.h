@@ -5,15 +5,31 @@
 #include "NazareneTypes.h"
 #include "NazareneVFXSubsystem.generated.h"
 
+class UNiagaraComponent;
 class UNiagaraSystem;
 
+/** One placed ambient system. Spawned inactive; the camera pass decides whether it simulates. */
+USTRUCT()
+struct FNazareneAmbientVFXAnchor
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TObjectPtr<UNiagaraComponent> Component;
+
+    ENazareneVFXType Type = ENazareneVFXType::AmbientDustMotes;
+};
+
 UCLASS()
-class THENAZARENEAAA_API UNazareneVFXSubsystem : public UWorldSubsystem
+class THENAZARENEAAA_API UNazareneVFXSubsystem : public UTickableWorldSubsystem
 {
     GENERATED_BODY()
 
 public:
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+    virtual bool IsTickable() const override { return AmbientAnchors.Num() > 0; }
 
     UFUNCTION(BlueprintCallable, Category = "VFX")
     void SpawnEffectAtLocation(ENazareneVFXType Type, const FVector& Location, const FRotator& Rotation = FRotator::ZeroRotator);
@@ -29,8 +45,31 @@ public:
     UFUNCTION(BlueprintCallable, Category = "VFX|Atmosphere")
     void ClearAmbientVFX();
 
+    /** Most anchors of one ambient type allowed to run at once; set by the frame-budget governor. */
+    void SetAmbientInstanceBudget(int32 InstancesPerType);
+
+    /** Most ambient systems simulating at once across every type. */
+    UPROPERTY(EditAnywhere, Category = "VFX|Atmosphere")
+    int32 MaxActiveAmbientSystems = 8;
+
+    /** Anchors further than this from the camera are deactivated. */
+    UPROPERTY(EditAnywhere, Category = "VFX|Atmosphere")
+    float AmbientActivationDistance = 4200.0f;
+
+    /** Extra distance an active anchor is allowed before it is switched off, so edge anchors do not flicker. */
+    UPROPERTY(EditAnywhere, Category = "VFX|Atmosphere")
+    float AmbientDeactivationMargin = 600.0f;
+
+    /** Approximate extent of one ambient system; the camera inside this radius always counts as seeing it. */
+    UPROPERTY(EditAnywhere, Category = "VFX|Atmosphere")
+    float AmbientAnchorRadius = 1100.0f;
+
+    UPROPERTY(EditAnywhere, Category = "VFX|Atmosphere")
+    float AmbientRefreshSeconds = 0.2f;
+
 private:
     UNiagaraSystem* ResolveSystem(ENazareneVFXType Type) const;
+    void RefreshAmbientAnchors();
 
 private:
     // Combat VFX systems
@@ -104,7 +143,10 @@ private:
     UPROPERTY()
     TObjectPtr<UNiagaraSystem> AmbientCrowdDustSystem;
 
-    /** Active ambient VFX component handles for cleanup on region transition. */
+    /** Every ambient system placed for the current region, active or not; cleared on region transition. */
     UPROPERTY()
-    TArray<TObjectPtr<USceneComponent>> ActiveAmbientComponents;
+    TArray<FNazareneAmbientVFXAnchor> AmbientAnchors;
+
+    int32 AmbientInstancesPerType = 5;
+    float AmbientRefreshTimer = 0.0f;
 };
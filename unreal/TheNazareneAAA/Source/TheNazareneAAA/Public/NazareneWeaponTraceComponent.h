@@ -0,0 +1,112 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "WorldCollision.h"
+#include "NazareneWeaponTraceComponent.generated.h"
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FNazareneWeaponHitSignature, AActor* /*HitActor*/, const FHitResult& /*Hit*/);
+
+/** Shape and payload limits for one swing; the owner decides what a hit means. */
+USTRUCT(BlueprintType)
+struct FNazareneWeaponSwingProfile
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+    float Reach = 260.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+    float ArcDegrees = 80.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+    float Duration = 0.2f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+    float Radius = 28.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+    int32 MaxTargets = 1;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+    TSubclassOf<AActor> TargetClass;
+};
+
+/**
+ * Weapon hit detection through sub-stepped async sweeps.
+ * Sweeps requested this frame are batched by the world's async trace pass and their
+ * results arrive at the start of the next frame; hits are deduplicated per swing.
+ * Owners with authored attack montages mark the live frames with
+ * UNazareneAnimNotifyState_WeaponTrace and sweep from mesh sockets; a swing whose
+ * window has not opened is a procedural arc in front of the owner over the profile duration.
+ */
+UCLASS(ClassGroup = (Nazarene), meta = (BlueprintSpawnableComponent))
+class THENAZARENEAAA_API UNazareneWeaponTraceComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UNazareneWeaponTraceComponent();
+
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+    /** Open a new swing; previous swing results still in flight are dropped. */
+    void BeginSwing(const FNazareneWeaponSwingProfile& Profile);
+
+    /** Interrupt the current swing and discard its in-flight results. */
+    void EndSwing();
+
+    /** Called by the anim notify state around the live frames of an authored attack. */
+    void SetNotifyWindowActive(bool bActive);
+
+    /** Count Actor as hit by the current swing without a sweep; ignored if already hit or the swing is full. */
+    void ReportHit(AActor* Actor);
+
+    bool IsSwingActive() const { return bSwingActive; }
+
+    FNazareneWeaponHitSignature OnWeaponHit;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Trace")
+    FName WeaponBaseSocket = TEXT("hand_r");
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Trace")
+    FName WeaponTipSocket = TEXT("weapon_tip");
+
+    /** Height above the actor origin the procedural arc sweeps at. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Trace")
+    float ProceduralSweepHeight = 20.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Trace")
+    float MaxSubstepDegrees = 12.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Trace")
+    float MaxSubstepDistance = 30.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Trace")
+    int32 MaxSubstepsPerFrame = 6;
+
+private:
+    void SweepSocketPath(const FVector& SocketBase, const FVector& SocketTip);
+    void SweepArcPath(float Progress);
+    bool SampleSocketSegment(FVector& OutBase, FVector& OutTip) const;
+    void SampleArcSegment(float Progress, FVector& OutBase, FVector& OutTip) const;
+    void RequestSweep(const FVector& Base, const FVector& Tip);
+    void HandleTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum);
+    void FinishSwing();
+
+    FNazareneWeaponSwingProfile ActiveProfile;
+    FTraceDelegate TraceDelegate;
+    TSet<TWeakObjectPtr<AActor>> SwingHitActors;
+
+    uint32 SwingId = 0;
+    uint32 AcceptingSwingId = 0;
+    float SwingElapsed = 0.0f;
+    float LastSampledProgress = -1.0f;
+    FVector LastSocketBase = FVector::ZeroVector;
+    FVector LastSocketTip = FVector::ZeroVector;
+    bool bHasSocketSample = false;
+    bool bSwingActive = false;
+    /** Set per swing: the swing started inside a notify window, or one opened during it. */
+    bool bAnimationDriven = false;
+    bool bNotifyWindowOpen = false;
+};
@@ -16,9 +16,11 @@ public class TheNazareneAAA : ModuleRules
                 "EnhancedInput",
                 "UMG",
                 "AIModule",
+                "AnimationSharing",
                 "GameplayAbilities",
                 "GameplayTags",
                 "GameplayTasks",
+                "NavigationSystem",
                 "Niagara"
             }
         );
@@ -26,6 +28,7 @@ public class TheNazareneAAA : ModuleRules
         PrivateDependencyModuleNames.AddRange(
             new string[]
             {
+                "RenderCore",
                 "Slate",
                 "SlateCore"
             }
@@ -0,0 +1,90 @@
+"""Shared launch-and-parse helpers for the log-driven benchmark scripts in Tools/.
+
+Each benchmark boots the game with one flag, waits for "<Tag>: key=value ..." lines in a named log and
+quits. LogBenchmark launches those runs (or parses existing logs) and collect_samples() handles the
+--editor/--runs/--log arguments every script shares. Plain Python 3; not meant to be run directly.
+"""
+
+from __future__ import annotations
+
+import argparse
+import re
+import statistics
+import subprocess
+import sys
+from dataclasses import dataclass
+from pathlib import Path
+
+PROJECT_ROOT = Path(__file__).resolve().parent.parent
+PROJECT_FILE = PROJECT_ROOT / "TheNazareneAAA.uproject"
+RUN_TIMEOUT_SECONDS = 300
+
+Sample = dict[str, float]
+
+
+@dataclass(frozen=True)
+class LogBenchmark:
+    tag: str
+    log_name: str
+    launch_args: tuple[str, ...]
+
+    def parse_log(self, path: Path) -> list[Sample]:
+        pattern = re.compile(rf"{re.escape(self.tag)}: (.+)$")
+        samples = []
+        for line in path.read_text(encoding="utf-8", errors="replace").splitlines():
+            match = pattern.search(line)
+            if match is None:
+                continue
+            fields = {}
+            for pair in match.group(1).split():
+                key, _, value = pair.partition("=")
+                fields[key] = float(value)
+            samples.append(fields)
+        return samples
+
+    def run_once(self, editor: str, extra_args: list[str]) -> list[Sample]:
+        log_path = PROJECT_ROOT / "Saved" / "Logs" / self.log_name
+        if log_path.exists():
+            log_path.unlink()
+
+        command = [editor, str(PROJECT_FILE), "-game", *self.launch_args, "-NoNazareneTelemetry",
+                   "-unattended", "-nosplash", f"-log={self.log_name}", *extra_args]
+        try:
+            subprocess.run(command, timeout=RUN_TIMEOUT_SECONDS, check=False)
+        except subprocess.TimeoutExpired:
+            # subprocess.run kills the game on timeout; whatever reached the log is still usable.
+            print(f"Run timed out after {RUN_TIMEOUT_SECONDS} s; game killed.", file=sys.stderr)
+        return self.parse_log(log_path) if log_path.exists() else []
+
+
+def add_launch_arguments(parser: argparse.ArgumentParser, runs_help: str = "Number of launches (default 5)") -> None:
+    parser.add_argument("--editor", help="UnrealEditor executable used to launch -game runs")
+    parser.add_argument("--runs", type=int, default=5, help=runs_help)
+    parser.add_argument("--log", action="append", default=[], help="Parse an existing log instead of launching")
+    parser.add_argument("extra", nargs="*", help="Extra command-line arguments passed to the game")
+
+
+def collect_samples(benchmark: LogBenchmark, args: argparse.Namespace,
+                    variants: list[list[str]] | None = None) -> list[Sample]:
+    """Parses every --log, then launches --runs times per variant (default: just args.extra) when --editor is set."""
+    samples: list[Sample] = []
+    for log in args.log:
+        samples.extend(benchmark.parse_log(Path(log)))
+
+    if args.editor:
+        for run in range(max(1, args.runs)):
+            for extra in variants or [args.extra]:
+                run_samples = benchmark.run_once(args.editor, extra)
+                if not run_samples:
+                    label = f" ({' '.join(extra)})" if extra else ""
+                    print(f"Run {run + 1}{label}: no {benchmark.tag} line found.", file=sys.stderr)
+                samples.extend(run_samples)
+
+    if not samples:
+        print(f"No {benchmark.tag} samples collected.", file=sys.stderr)
+    return samples
+
+
+def summarize(samples: list[Sample], exclude: frozenset[str] = frozenset()) -> Sample:
+    keys = sorted({key for sample in samples for key in sample} - exclude)
+    return {key: statistics.median(sample[key] for sample in samples if key in sample) for key in keys}
@@ -0,0 +1,39 @@
+"""Measure HUD startup cost by launching the game with -NazareneHUDBenchmark.
+
+Each run boots to the start menu, logs one HUDBenchmark line from UNazareneHUDWidget
+and quits. The script reports the median of every field across runs.
+
+Usage:
+  python Tools/benchmark_hud_startup.py --editor "C:/UE_5.4/Engine/Binaries/Win64/UnrealEditor.exe" --runs 5
+  python Tools/benchmark_hud_startup.py --log Saved/Logs/HUDBenchmark.log
+
+Plain Python 3; the first form needs a built editor, the second only parses an existing log.
+"""
+
+from __future__ import annotations
+
+import argparse
+import sys
+
+from benchmark_common import LogBenchmark, add_launch_arguments, collect_samples, summarize
+
+BENCHMARK = LogBenchmark("HUDBenchmark", "HUDBenchmark.log", ("-NazareneHUDBenchmark",))
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    add_launch_arguments(parser)
+    args = parser.parse_args()
+
+    samples = collect_samples(BENCHMARK, args)
+    if not samples:
+        return 1
+
+    print(f"{len(samples)} sample(s), medians:")
+    for key, value in summarize(samples).items():
+        print(f"  {key:16} {value:10.3f}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,53 @@
+"""Measure player spawn cost by launching the game with -NazareneSpawnBenchmark.
+
+Each run boots the campaign, logs one SpawnBenchmark line from ANazareneCampaignGameMode once the
+first player's presentation bundle is applied and a second (warm) player has spawned, and quits.
+With --compare every run is repeated with -NazareneSyncPlayerPresentation, the old blocking load,
+so the medians of both paths print side by side.
+
+Usage:
+  python Tools/benchmark_player_spawn.py --editor "C:/UE_5.4/Engine/Binaries/Win64/UnrealEditor.exe" --runs 5 --compare
+  python Tools/benchmark_player_spawn.py --log Saved/Logs/SpawnBenchmark.log
+
+Plain Python 3; the first form needs a built editor, the second only parses an existing log.
+"""
+
+from __future__ import annotations
+
+import argparse
+import sys
+
+from benchmark_common import LogBenchmark, add_launch_arguments, collect_samples, summarize
+
+SYNC_FLAG = "-NazareneSyncPlayerPresentation"
+
+BENCHMARK = LogBenchmark("SpawnBenchmark", "SpawnBenchmark.log", ("-NazareneSpawnBenchmark", "-NoNazareneLatencyProbes"))
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    add_launch_arguments(parser, runs_help="Number of launches per path (default 5)")
+    parser.add_argument("--compare", action="store_true", help=f"Also launch every run with {SYNC_FLAG}")
+    args = parser.parse_args()
+
+    variants = [args.extra, [*args.extra, SYNC_FLAG]] if args.compare else [args.extra]
+    samples = collect_samples(BENCHMARK, args, variants)
+    if not samples:
+        return 1
+
+    groups = {
+        "async": [sample for sample in samples if sample.get("sync", 0.0) == 0.0],
+        "sync": [sample for sample in samples if sample.get("sync", 0.0) != 0.0],
+    }
+    summaries = {name: summarize(group, exclude=frozenset({"sync"})) for name, group in groups.items() if group}
+    keys = sorted({key for summary in summaries.values() for key in summary})
+
+    print(f"{len(samples)} sample(s), medians:")
+    print(f"  {'':20}" + "".join(f"{name:>12}" for name in summaries))
+    for key in keys:
+        print(f"  {key:20}" + "".join(f"{summary.get(key, float('nan')):12.3f}" for summary in summaries.values()))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
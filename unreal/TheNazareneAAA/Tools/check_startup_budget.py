@@ -0,0 +1,64 @@
+"""Fail when boot-to-menu startup regresses past its budget.
+
+Each run boots to the start menu with -NazareneStartupQuit, so the startup profiler logs its
+StartupReport line at the first interactive menu frame and the game exits. The medians across
+runs are compared with the budgets; the exit code is 1 if any is exceeded, for use as a CI gate.
+
+Usage:
+  python Tools/check_startup_budget.py --editor "C:/UE_5.4/Engine/Binaries/Win64/UnrealEditor.exe" --runs 5
+  python Tools/check_startup_budget.py --log Saved/Logs/StartupBenchmark.log --max-game-ms 1500
+
+Plain Python 3; the first form needs a built editor, the second only parses an existing log.
+"""
+
+from __future__ import annotations
+
+import argparse
+import sys
+
+from benchmark_common import LogBenchmark, add_launch_arguments, collect_samples, summarize
+
+BENCHMARK = LogBenchmark("StartupReport", "StartupBenchmark.log", ("-NazareneStartupQuit",))
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    add_launch_arguments(parser)
+    parser.add_argument("--max-interactive-ms", type=float, default=20000.0,
+                        help="Budget for engine launch to first menu frame (default 20000)")
+    parser.add_argument("--max-game-ms", type=float, default=2500.0,
+                        help="Budget for the first game phase to first menu frame (default 2500)")
+    parser.add_argument("--max-sync-loads", type=float, default=150.0,
+                        help="Budget for synchronous package loads inside startup phases (default 150)")
+    args = parser.parse_args()
+
+    samples = collect_samples(BENCHMARK, args)
+    if not samples:
+        return 1
+
+    budgets = {
+        "interactive_ms": args.max_interactive_ms,
+        "game_ms": args.max_game_ms,
+        "sync_loads": args.max_sync_loads,
+    }
+
+    medians = summarize(samples)
+    failed = False
+    print(f"{len(samples)} sample(s), medians:")
+    for key, value in medians.items():
+        budget = budgets.get(key)
+        if budget is None:
+            print(f"  {key:20} {value:10.3f}")
+            continue
+        over = value > budget
+        failed |= over
+        print(f"  {key:20} {value:10.3f}  budget {budget:10.3f}  {'OVER' if over else 'ok'}")
+
+    if failed:
+        print("Startup budget exceeded.", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
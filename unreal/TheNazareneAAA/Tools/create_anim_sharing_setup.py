@@ -0,0 +1,91 @@
+"""Create the AnimationSharing setup used by enemy crowds.
+
+States map 1:1 onto ENazareneEnemyState (see UNazareneEnemyAnimSharingProcessor). Looping
+locomotion states share a small pool of master pose instances; telegraphed states
+(Windup, Casting, Parried) are on-demand so each enemy starts its tell from frame zero.
+
+Run:
+  UnrealEditor-Cmd.exe TheNazareneAAA.uproject -run=pythonscript -script=Tools/create_anim_sharing_setup.py -unattended -nop4
+"""
+
+from __future__ import annotations
+
+import unreal
+
+SETUP_PATH = "/Game/Art/Animation/AS_BiblicalEnemyCrowd"
+SKELETON_PATH = "/Game/Art/Characters/Common/SKEL_BiblicalHumanoid.SKEL_BiblicalHumanoid"
+MESH_PATH = "/Game/Art/Characters/Enemies/SK_BiblicalLegionary.SK_BiblicalLegionary"
+IDLE_ANIM = "/Game/Art/Animation/A_Biblical_Idle.A_Biblical_Idle"
+WALK_ANIM = "/Game/Art/Animation/A_Biblical_WalkFwd.A_Biblical_WalkFwd"
+
+# (state value, animation, randomized instances, on demand)
+ENEMY_STATES = [
+    (0, IDLE_ANIM, 3, False),   # Idle
+    (1, WALK_ANIM, 3, False),   # Chase
+    (2, WALK_ANIM, 2, False),   # Retreat
+    (3, WALK_ANIM, 2, False),   # Strafe
+    (4, IDLE_ANIM, 1, True),    # Windup
+    (5, IDLE_ANIM, 1, True),    # Casting
+    (6, IDLE_ANIM, 1, False),   # Blocking
+    (7, IDLE_ANIM, 2, False),   # Recover
+    (8, IDLE_ANIM, 2, False),   # Staggered
+    (9, IDLE_ANIM, 1, True),    # Parried
+]
+
+
+def _set(obj, name: str, value) -> None:
+    try:
+        obj.set_editor_property(name, value)
+    except Exception:
+        unreal.log_warning(f"Could not set {name} on {obj}; continuing.")
+
+
+def _make_state(state: int, anim_path: str, instances: int, on_demand: bool):
+    anim = unreal.load_asset(anim_path)
+    setup = unreal.AnimationSetup()
+    _set(setup, "animation_sequence", anim)
+    _set(setup, "num_randomized_instances", unreal.PerPlatformInt(instances) if hasattr(unreal, "PerPlatformInt") else instances)
+
+    entry = unreal.AnimationStateEntry()
+    _set(entry, "state", state)
+    _set(entry, "animation_setups", [setup])
+    _set(entry, "on_demand", on_demand)
+    _set(entry, "return_to_previous_state", on_demand)
+    _set(entry, "blend_time", 0.2)
+    return entry
+
+
+def main() -> None:
+    skeleton = unreal.load_asset(SKELETON_PATH)
+    mesh = unreal.load_asset(MESH_PATH)
+    if skeleton is None or mesh is None:
+        unreal.log_error("Enemy skeleton/mesh missing; run create_biblical_art_pack.py first.")
+        return
+
+    if unreal.EditorAssetLibrary.does_asset_exist(SETUP_PATH):
+        setup = unreal.load_asset(SETUP_PATH)
+        unreal.log(f"Already exists: {SETUP_PATH}; refreshing state table.")
+    else:
+        package_path, asset_name = SETUP_PATH.rsplit("/", 1)
+        setup = unreal.AssetToolsHelpers.get_asset_tools().create_asset(asset_name, package_path, unreal.AnimationSharingSetup, None)
+        if setup is None:
+            unreal.log_error(f"Failed to create animation sharing setup: {SETUP_PATH}")
+            return
+
+    processor = unreal.load_class(None, "/Script/TheNazareneAAA.NazareneEnemyAnimSharingProcessor")
+
+    per_skeleton = unreal.PerSkeletonAnimationSharingSetup()
+    _set(per_skeleton, "skeleton", skeleton)
+    _set(per_skeleton, "skeletal_mesh", mesh)
+    _set(per_skeleton, "state_processor_class", processor)
+    _set(per_skeleton, "enable_blending", True)
+    _set(per_skeleton, "animation_states", [_make_state(*state) for state in ENEMY_STATES])
+
+    _set(setup, "skeleton_setups", [per_skeleton])
+
+    unreal.EditorAssetLibrary.save_loaded_asset(setup)
+    unreal.log("Enemy animation sharing setup complete.")
+
+
+if __name__ == "__main__":
+    main()
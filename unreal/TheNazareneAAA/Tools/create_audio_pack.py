@@ -56,6 +56,20 @@ def _duplicate_with_fallback(destination: str, candidates: list[str]) -> None:
         unreal.log_error(f"Failed duplicate: {source} -> {destination}")
 
 
+def _keep_music_playing_when_silent(directory: str) -> None:
+    # Region music layers start together and are mixed by volume; a virtualized muted stem would
+    # restart from the top when it fades back in, so music is authored PlayWhenSilent.
+    for path in unreal.EditorAssetLibrary.list_assets(directory, recursive=True, include_folder=False):
+        asset = unreal.EditorAssetLibrary.load_asset(path)
+        if not isinstance(asset, unreal.SoundBase):
+            continue
+        if asset.get_editor_property("virtualization_mode") == unreal.VirtualizationMode.PLAY_WHEN_SILENT:
+            continue
+        asset.set_editor_property("virtualization_mode", unreal.VirtualizationMode.PLAY_WHEN_SILENT)
+        unreal.EditorAssetLibrary.save_loaded_asset(asset)
+        unreal.log(f"Set PlayWhenSilent: {path}")
+
+
 def main() -> None:
     _ensure_dir("/Game/Audio")
     _ensure_dir("/Game/Audio/SFX")
@@ -79,6 +93,7 @@ def main() -> None:
     _duplicate_with_fallback("/Game/Audio/Music/S_Music_Decapolis", sfx_sources)
     _duplicate_with_fallback("/Game/Audio/Music/S_Music_Wilderness", sfx_sources)
     _duplicate_with_fallback("/Game/Audio/Music/S_Music_Jerusalem", sfx_sources)
+    _keep_music_playing_when_silent("/Game/Audio/Music")
 
     unreal.EditorLoadingAndSavingUtils.save_dirty_packages(True, True)
     unreal.log("Audio pack generation complete.")
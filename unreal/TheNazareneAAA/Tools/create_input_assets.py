@@ -0,0 +1,114 @@
+"""Create the cooked Enhanced Input assets the player character prefers over its runtime defaults.
+
+Writes one input action per gameplay action under /Game/Input/Actions and /Game/Input/IMC_Nazarene with
+the same keys and scales ANazarenePlayerCharacter builds at runtime. Action names carry the tokens the
+character looks mappings up by (IA_MoveForward, IA_LightAttack, ...).
+
+Run:
+  UnrealEditor-Cmd.exe TheNazareneAAA.uproject -run=pythonscript -script=Tools/create_input_assets.py -unattended -nop4
+"""
+
+from __future__ import annotations
+
+import unreal
+
+CONTEXT_PATH = "/Game/Input/IMC_Nazarene"
+ACTIONS_DIR = "/Game/Input/Actions"
+
+AXIS = "axis"
+BUTTON = "button"
+
+# (token, value type, [(key, scale), ...]) in the order the character resolves them.
+ACTIONS = [
+    ("MoveForward", AXIS, [("W", 1.0), ("S", -1.0), ("Up", 1.0), ("Down", -1.0), ("Gamepad_LeftY", 1.0)]),
+    ("MoveRight", AXIS, [("D", 1.0), ("A", -1.0), ("Right", 1.0), ("Left", -1.0), ("Gamepad_LeftX", 1.0)]),
+    ("Turn", AXIS, [("MouseX", 1.0), ("Gamepad_RightX", 1.8)]),
+    ("LookUp", AXIS, [("MouseY", -1.0), ("Gamepad_RightY", -1.6)]),
+    ("Interact", BUTTON, [("E", 1.0), ("Gamepad_FaceButton_Bottom", 1.0)]),
+    ("LockOn", BUTTON, [("Q", 1.0), ("Gamepad_RightThumbstick", 1.0)]),
+    ("Pause", BUTTON, [("Escape", 1.0), ("Gamepad_Special_Right", 1.0)]),
+    ("ToggleMouseCapture", BUTTON, [("Tab", 1.0)]),
+    ("Block", BUTTON, [("LeftShift", 1.0), ("Gamepad_LeftTriggerAxis", 1.0)]),
+    ("LightAttack", BUTTON, [("LeftMouseButton", 1.0), ("Gamepad_FaceButton_Left", 1.0)]),
+    ("HeavyAttack", BUTTON, [("RightMouseButton", 1.0), ("Gamepad_RightTriggerAxis", 1.0)]),
+    ("Dodge", BUTTON, [("SpaceBar", 1.0), ("Gamepad_FaceButton_Right", 1.0)]),
+    ("Parry", BUTTON, [("F", 1.0), ("Gamepad_RightShoulder", 1.0)]),
+    ("MiracleHeal", BUTTON, [("R", 1.0), ("Gamepad_LeftShoulder", 1.0)]),
+    ("MiracleBlessing", BUTTON, [("One", 1.0), ("Gamepad_DPad_Up", 1.0)]),
+    ("MiracleRadiance", BUTTON, [("Two", 1.0), ("Gamepad_FaceButton_Top", 1.0)]),
+    ("SaveSlot1", BUTTON, [("F1", 1.0)]),
+    ("SaveSlot2", BUTTON, [("F2", 1.0)]),
+    ("SaveSlot3", BUTTON, [("F3", 1.0)]),
+    ("LoadSlot1", BUTTON, [("F5", 1.0)]),
+    ("LoadSlot2", BUTTON, [("F6", 1.0)]),
+    ("LoadSlot3", BUTTON, [("F7", 1.0)]),
+    ("SkillTree", BUTTON, [("T", 1.0), ("Gamepad_DPad_Left", 1.0)]),
+]
+
+
+def _ensure_dir(path: str) -> None:
+    if not unreal.EditorAssetLibrary.does_directory_exist(path):
+        unreal.EditorAssetLibrary.make_directory(path)
+
+
+def _create_or_load(destination: str, asset_class, factory):
+    if unreal.EditorAssetLibrary.does_asset_exist(destination):
+        unreal.log(f"Already exists: {destination}")
+        return unreal.load_asset(destination)
+
+    asset_tools = unreal.AssetToolsHelpers.get_asset_tools()
+    package_path, asset_name = destination.rsplit("/", 1)
+    asset = asset_tools.create_asset(asset_name, package_path, asset_class, factory)
+    if asset:
+        unreal.log(f"Created: {destination}")
+    else:
+        unreal.log_error(f"Failed to create: {destination}")
+    return asset
+
+
+def _make_key(name: str) -> unreal.Key:
+    key = unreal.Key()
+    key.set_editor_property("key_name", name)
+    return key
+
+
+def _map_key(context: unreal.InputMappingContext, action: unreal.InputAction, key_name: str, scale: float) -> None:
+    context.map_key(action, _make_key(key_name))
+    if abs(scale - 1.0) < 1e-4:
+        return
+
+    # map_key hands back a copy, so the scale modifier is written through the mapping list.
+    try:
+        mappings = list(context.get_editor_property("mappings"))
+        modifier = unreal.new_object(unreal.InputModifierScalar, outer=context)
+        modifier.set_editor_property("scalar", unreal.Vector(scale, scale, scale))
+        mappings[-1].set_editor_property("modifiers", [modifier])
+        context.set_editor_property("mappings", mappings)
+    except Exception as error:
+        unreal.log_warning(f"Could not scale {key_name} on {action.get_name()}: {error}")
+
+
+def main() -> None:
+    _ensure_dir("/Game/Input")
+    _ensure_dir(ACTIONS_DIR)
+
+    context = _create_or_load(CONTEXT_PATH, unreal.InputMappingContext, unreal.InputMappingContext_Factory())
+    if not context:
+        return
+    context.unmap_all()
+
+    for token, value_kind, keys in ACTIONS:
+        action = _create_or_load(f"{ACTIONS_DIR}/IA_{token}", unreal.InputAction, unreal.InputAction_Factory())
+        if not action:
+            continue
+        value_type = unreal.InputActionValueType.AXIS1D if value_kind == AXIS else unreal.InputActionValueType.BOOLEAN
+        action.set_editor_property("value_type", value_type)
+        for key_name, scale in keys:
+            _map_key(context, action, key_name, scale)
+
+    unreal.EditorLoadingAndSavingUtils.save_dirty_packages(True, True)
+    unreal.log("Input asset generation complete.")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,162 @@
+"""Bake the title-screen tomb diorama into a streaming sublevel.
+
+ANazareneCampaignGameMode streams /Game/Maps/Menu/L_MenuSetpiece as a level instance at the menu stage
+center (override key MenuSetpieceLevel) and only spawns the diorama actor by actor when the level is
+missing. Actors here are placed relative to that center and lit and graded exactly like the runtime fallback
+(ANazareneCampaignGameMode::BuildMenuSetpieceActors); keep the two in step.
+
+Run:
+  UnrealEditor-Cmd.exe TheNazareneAAA.uproject -run=pythonscript -script=Tools/create_menu_setpiece_level.py -unattended -nop4
+"""
+
+from __future__ import annotations
+
+import unreal
+
+LEVEL_PATH = "/Game/Maps/Menu/L_MenuSetpiece"
+TAG = "MenuSetpiece"
+
+BLOCK_CANDIDATES = ["/Game/Art/Environment/Meshes/SM_BiblicalBlock.SM_BiblicalBlock", "/Engine/BasicShapes/Cube.Cube"]
+COLUMN_CANDIDATES = ["/Game/Art/Environment/Meshes/SM_BiblicalColumn.SM_BiblicalColumn", "/Engine/BasicShapes/Cylinder.Cylinder"]
+STONE_CANDIDATES = ["/Game/Art/Materials/MI_Env_Stone.MI_Env_Stone", "/Engine/BasicShapes/BasicShapeMaterial.BasicShapeMaterial"]
+
+# Tomb base sits 430 units in front of the stage center.
+TOMB_X = 430.0
+
+# (mesh kind, offset from tomb base, scale, rotation pitch/yaw/roll)
+PIECES = [
+    ("block", (0.0, 0.0, -70.0), (6.4, 4.2, 0.35), (0.0, 0.0, 0.0)),
+    ("block", (-360.0, 0.0, 145.0), (0.35, 4.0, 2.5), (0.0, 0.0, 0.0)),
+    ("block", (80.0, -300.0, 130.0), (4.3, 0.35, 2.2), (0.0, 0.0, 0.0)),
+    ("block", (80.0, 300.0, 130.0), (4.3, 0.35, 2.2), (0.0, 0.0, 0.0)),
+    ("block", (110.0, 0.0, 285.0), (4.2, 1.6, 0.28), (0.0, 0.0, 0.0)),
+    ("column", (390.0, 180.0, 76.0), (1.45, 1.45, 0.62), (90.0, 8.0, 0.0)),
+    ("block", (760.0, 0.0, -80.0), (4.6, 2.6, 0.25), (0.0, 0.0, 0.0)),
+]
+
+# (offset from tomb base, color, intensity, attenuation radius)
+POINT_LIGHTS = [
+    ((330.0, -35.0, 160.0), (1.0, 0.92, 0.75), 6800.0, 2200.0),
+    ((-250.0, 180.0, 210.0), (0.82, 0.90, 1.0), 3600.0, 2000.0),
+]
+
+
+def _ensure_directory(path: str) -> None:
+    if not unreal.EditorAssetLibrary.does_directory_exist(path):
+        unreal.EditorAssetLibrary.make_directory(path)
+
+
+def _load_first(candidates: list[str]):
+    for path in candidates:
+        if unreal.EditorAssetLibrary.does_asset_exist(path):
+            asset = unreal.EditorAssetLibrary.load_asset(path)
+            if asset:
+                return asset
+    return None
+
+
+def _tomb(offset: tuple[float, float, float]) -> unreal.Vector:
+    return unreal.Vector(TOMB_X + offset[0], offset[1], offset[2])
+
+
+def _tag(actor: unreal.Actor) -> None:
+    actor.tags = list(actor.tags) + [TAG]
+
+
+def _clear_previous_bake() -> None:
+    for actor in unreal.EditorLevelLibrary.get_all_level_actors():
+        if actor and TAG in [str(tag) for tag in actor.tags]:
+            unreal.EditorLevelLibrary.destroy_actor(actor)
+
+
+def _bake() -> None:
+    meshes = {"block": _load_first(BLOCK_CANDIDATES), "column": _load_first(COLUMN_CANDIDATES)}
+    stone = _load_first(STONE_CANDIDATES)
+
+    for kind, offset, scale, rotation in PIECES:
+        mesh = meshes.get(kind)
+        if not mesh:
+            unreal.log_warning(f"No {kind} mesh available for the menu setpiece.")
+            continue
+        actor = unreal.EditorLevelLibrary.spawn_actor_from_class(unreal.StaticMeshActor, _tomb(offset), unreal.Rotator(rotation[2], rotation[0], rotation[1]))
+        if not actor:
+            continue
+        component = actor.get_component_by_class(unreal.StaticMeshComponent)
+        component.set_editor_property("mobility", unreal.ComponentMobility.MOVABLE)
+        component.set_static_mesh(mesh)
+        component.set_collision_enabled(unreal.CollisionEnabled.NO_COLLISION)
+        component.set_editor_property("cast_shadow", True)
+        if stone:
+            component.set_material(0, stone)
+        actor.set_actor_scale3d(unreal.Vector(*scale))
+        _tag(actor)
+
+    for offset, color, intensity, radius in POINT_LIGHTS:
+        light = unreal.EditorLevelLibrary.spawn_actor_from_class(unreal.PointLight, _tomb(offset), unreal.Rotator(0.0, 0.0, 0.0))
+        if not light:
+            continue
+        component = light.get_editor_property("point_light_component")
+        component.set_editor_property("mobility", unreal.ComponentMobility.MOVABLE)
+        component.set_editor_property("intensity", intensity)
+        component.set_light_color(unreal.LinearColor(*color, 1.0))
+        component.set_editor_property("attenuation_radius", radius)
+        component.set_editor_property("source_radius", 64.0)
+        component.set_editor_property("soft_source_radius", 96.0)
+        _tag(light)
+
+    sun = unreal.EditorLevelLibrary.spawn_actor_from_class(unreal.DirectionalLight, _tomb((0.0, 0.0, 1400.0)), unreal.Rotator(0.0, -30.0, -20.0))
+    if sun:
+        component = sun.get_editor_property("directional_light_component")
+        component.set_editor_property("mobility", unreal.ComponentMobility.MOVABLE)
+        component.set_editor_property("intensity", 18000.0)
+        component.set_editor_property("temperature", 5700.0)
+        component.set_light_color(unreal.LinearColor(1.0, 0.93, 0.80, 1.0))
+        _tag(sun)
+
+    sky = unreal.EditorLevelLibrary.spawn_actor_from_class(unreal.SkyLight, _tomb((0.0, 0.0, 0.0)), unreal.Rotator(0.0, 0.0, 0.0))
+    if sky:
+        component = sky.get_editor_property("light_component")
+        component.set_editor_property("mobility", unreal.ComponentMobility.MOVABLE)
+        component.set_editor_property("intensity", 1.2)
+        component.set_light_color(unreal.LinearColor(0.88, 0.92, 1.0, 1.0))
+        component.set_editor_property("real_time_capture", True)
+        component.recapture_sky()
+        _tag(sky)
+
+    volume = unreal.EditorLevelLibrary.spawn_actor_from_class(unreal.PostProcessVolume, _tomb((0.0, 0.0, 0.0)), unreal.Rotator(0.0, 0.0, 0.0))
+    if volume:
+        volume.set_editor_property("unbound", True)
+        volume.set_editor_property("blend_weight", 1.0)
+        settings = volume.get_editor_property("settings")
+        for name, value in [
+            ("auto_exposure_method", unreal.AutoExposureMethod.AEM_HISTOGRAM),
+            ("auto_exposure_min_brightness", 0.35),
+            ("auto_exposure_max_brightness", 1.8),
+            ("auto_exposure_bias", -0.2),
+            ("vignette_intensity", 0.35),
+            ("color_contrast", unreal.Vector4(1.03, 1.03, 1.03, 1.0)),
+        ]:
+            settings.set_editor_property(f"override_{name}", True)
+            settings.set_editor_property(name, value)
+        volume.set_editor_property("settings", settings)
+        _tag(volume)
+
+
+def main() -> None:
+    _ensure_directory("/Game/Maps")
+    _ensure_directory("/Game/Maps/Menu")
+
+    if unreal.EditorAssetLibrary.does_asset_exist(LEVEL_PATH):
+        unreal.EditorLoadingAndSavingUtils.load_map(LEVEL_PATH)
+        unreal.log(f"Loaded existing menu setpiece level: {LEVEL_PATH}")
+    elif not unreal.EditorLevelLibrary.new_level(LEVEL_PATH):
+        raise RuntimeError(f"Failed to create level: {LEVEL_PATH}")
+
+    _clear_previous_bake()
+    _bake()
+    unreal.EditorAssetLibrary.save_asset(LEVEL_PATH, only_if_is_dirty=False)
+    unreal.log("Menu setpiece level bake complete.")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,205 @@
+"""Aggregate combat telemetry ring files written by UNazareneTelemetrySubsystem.
+
+Usage:
+  python Tools/read_combat_telemetry.py Saved/Telemetry
+  python Tools/read_combat_telemetry.py Saved/Telemetry/Combat_20260101_120000.nztl --json
+
+Plain Python 3; does not need the editor.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import struct
+import sys
+from collections import defaultdict
+from pathlib import Path
+
+MAGIC = 0x4C545A4E  # "NZTL"
+SUPPORTED_VERSION = 1
+
+# Mirrors FTelemetryFileHeader / FNazareneTelemetryRecord in NazareneTelemetrySubsystem.
+HEADER = struct.Struct("<IHHIiQQq24x")
+RECORD = struct.Struct("<dIHhffII")
+
+RECORD_TYPES = {
+    1: "SessionStart",
+    2: "FrameSample",
+    3: "EnemyHit",
+    4: "PlayerHit",
+    5: "Block",
+    6: "Parry",
+    7: "PoiseBreak",
+    8: "EnemyRedeemed",
+    9: "PlayerDeath",
+    10: "Retry",
+    11: "RegionEnter",
+    12: "RegionComplete",
+    13: "BossPhase",
+}
+
+ARCHETYPES = {0: "MeleeShield", 1: "Spear", 2: "Ranged", 3: "Demon", 4: "Boss", 0xFF: "None"}
+
+
+def read_records(path: Path) -> tuple[dict, list[tuple]]:
+    data = path.read_bytes()
+    if len(data) < HEADER.size:
+        raise ValueError(f"{path}: too small for a telemetry header")
+
+    magic, version, record_size, capacity, seed, total, dropped, start_unix = HEADER.unpack_from(data, 0)
+    if magic != MAGIC:
+        raise ValueError(f"{path}: not a telemetry file")
+    if version != SUPPORTED_VERSION or record_size != RECORD.size:
+        raise ValueError(f"{path}: unsupported version {version} / record size {record_size}")
+
+    header = {
+        "file": str(path),
+        "seed": seed,
+        "records_written": total,
+        "records_dropped": dropped,
+        "records_overwritten": max(0, total - capacity),
+        "start_unix": start_unix,
+    }
+
+    # Once the ring wraps, the oldest surviving record sits at the write position.
+    count = min(total, capacity)
+    first = total % capacity if total > capacity else 0
+    records = []
+    for index in range(count):
+        slot = (first + index) % capacity
+        records.append(RECORD.unpack_from(data, HEADER.size + slot * RECORD.size))
+    return header, records
+
+
+def percentile(values: list[float], fraction: float) -> float:
+    if not values:
+        return 0.0
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(round(fraction * (len(ordered) - 1))))]
+
+
+def new_region() -> dict:
+    return {
+        "entries": 0,
+        "completions": 0,
+        "completion_seconds": [],
+        "deaths": 0,
+        "max_retry": 0,
+        "deaths_by_archetype": defaultdict(int),
+        "damage_dealt_by_archetype": defaultdict(float),
+        "hits_by_archetype": defaultdict(int),
+        "damage_taken_by_archetype": defaultdict(float),
+        "blocks_by_player": 0,
+        "blocks_by_enemies": 0,
+        "parries": 0,
+        "poise_breaks": 0,
+        "redeemed_by_archetype": defaultdict(int),
+        "frame_ms": [],
+        "worst_frame_ms": 0.0,
+    }
+
+
+def aggregate(files: list[Path]) -> dict:
+    sessions = []
+    regions: dict[int, dict] = defaultdict(new_region)
+
+    for path in files:
+        header, records = read_records(path)
+        sessions.append(header)
+        for _time, _frame, type_id, region_index, value, aux, subject, flags in records:
+            kind = RECORD_TYPES.get(type_id)
+            region = regions[region_index]
+            archetype = ARCHETYPES.get(subject, str(subject))
+            count = max(1, int(aux))
+
+            if kind == "FrameSample":
+                region["frame_ms"].append(value)
+                region["worst_frame_ms"] = max(region["worst_frame_ms"], aux)
+            elif kind == "EnemyHit":
+                region["hits_by_archetype"][archetype] += count
+                region["damage_dealt_by_archetype"][archetype] += value
+            elif kind == "PlayerHit":
+                region["damage_taken_by_archetype"][archetype] += value
+            elif kind == "Block":
+                key = "blocks_by_player" if flags & 1 else "blocks_by_enemies"
+                region[key] += count
+            elif kind == "Parry":
+                region["parries"] += count
+            elif kind == "PoiseBreak":
+                region["poise_breaks"] += count
+            elif kind == "EnemyRedeemed":
+                region["redeemed_by_archetype"][archetype] += count
+            elif kind == "PlayerDeath":
+                region["deaths"] += 1
+                region["deaths_by_archetype"][archetype] += 1
+            elif kind == "Retry":
+                region["max_retry"] = max(region["max_retry"], int(value))
+            elif kind == "RegionEnter":
+                region["entries"] += 1
+            elif kind == "RegionComplete":
+                region["completions"] += 1
+                region["completion_seconds"].append(value)
+
+    summary = {}
+    for region_index in sorted(regions):
+        region = regions[region_index]
+        frames = region.pop("frame_ms")
+        completion = region.pop("completion_seconds")
+        region["frame_ms_avg"] = sum(frames) / len(frames) if frames else 0.0
+        region["frame_ms_p95"] = percentile(frames, 0.95)
+        region["completion_seconds_avg"] = sum(completion) / len(completion) if completion else 0.0
+        summary[str(region_index)] = {key: dict(value) if isinstance(value, defaultdict) else value for key, value in region.items()}
+
+    return {"sessions": sessions, "regions": summary}
+
+
+def collect_files(paths: list[str]) -> list[Path]:
+    files: list[Path] = []
+    for raw in paths:
+        path = Path(raw)
+        if path.is_dir():
+            files.extend(sorted(path.glob("*.nztl")))
+        elif path.is_file():
+            files.append(path)
+    return files
+
+
+def print_report(report: dict) -> None:
+    for session in report["sessions"]:
+        print(f"{session['file']}: seed {session['seed']}, {session['records_written']} records, "
+              f"{session['records_dropped']} dropped, {session['records_overwritten']} overwritten")
+
+    for region_index, region in report["regions"].items():
+        print(f"\nRegion {region_index}")
+        print(f"  entries {region['entries']}, completions {region['completions']}, "
+              f"avg clear {region['completion_seconds_avg']:.1f}s")
+        print(f"  deaths {region['deaths']} (max retry {region['max_retry']}), by archetype {region['deaths_by_archetype']}")
+        print(f"  damage dealt {region['damage_dealt_by_archetype']}")
+        print(f"  damage taken {region['damage_taken_by_archetype']}")
+        print(f"  parries {region['parries']}, poise breaks {region['poise_breaks']}, "
+              f"blocks player/enemy {region['blocks_by_player']}/{region['blocks_by_enemies']}")
+        print(f"  frame ms avg {region['frame_ms_avg']:.2f}, p95 {region['frame_ms_p95']:.2f}, worst {region['worst_frame_ms']:.2f}")
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("paths", nargs="+", help="Telemetry files or directories containing *.nztl files")
+    parser.add_argument("--json", action="store_true", help="Print the aggregate as JSON")
+    args = parser.parse_args()
+
+    files = collect_files(args.paths)
+    if not files:
+        print("No telemetry files found.", file=sys.stderr)
+        return 1
+
+    report = aggregate(files)
+    if args.json:
+        print(json.dumps(report, indent=2))
+    else:
+        print_report(report)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
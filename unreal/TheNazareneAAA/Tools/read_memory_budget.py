@@ -0,0 +1,72 @@
+"""Summarize per-region memory budget reports written by UNazareneMemoryReportSubsystem.
+
+Prints the latest capture of every region as a region x system table with budgets, and with
+--baseline the change against an earlier report. Exits with 1 when any system is over budget.
+
+Usage:
+  python Tools/read_memory_budget.py Saved/Profiling/MemoryBudget_20260101_120000.csv
+  python Tools/read_memory_budget.py After.csv --baseline Before.csv
+
+Plain Python 3; does not need the editor.
+"""
+
+from __future__ import annotations
+
+import argparse
+import csv
+import sys
+from pathlib import Path
+
+
+def read_report(path: Path) -> dict[str, dict[str, tuple[float, float]]]:
+    """Region -> system -> (MB, budget MB), keeping each region's latest capture."""
+    latest_capture: dict[str, int] = {}
+    regions: dict[str, dict[str, tuple[float, float]]] = {}
+    with path.open(newline="", encoding="utf-8") as handle:
+        for row in csv.DictReader(handle):
+            region = row["Region"]
+            capture = int(row["Capture"])
+            if capture > latest_capture.get(region, -1):
+                latest_capture[region] = capture
+                regions[region] = {}
+            if capture == latest_capture[region]:
+                regions[region][row["System"]] = (float(row["MB"]), float(row["BudgetMB"]))
+    return regions
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("report", help="MemoryBudget_*.csv written by the game")
+    parser.add_argument("--baseline", help="Earlier report to compare against")
+    args = parser.parse_args()
+
+    report = Path(args.report)
+    if not report.exists():
+        print(f"No such report: {report}", file=sys.stderr)
+        return 1
+
+    regions = read_report(report)
+    baseline = read_report(Path(args.baseline)) if args.baseline else {}
+
+    over_budget = 0
+    for region, systems in regions.items():
+        print(region)
+        for system, (megabytes, budget) in systems.items():
+            line = f"  {system:10} {megabytes:9.1f} MB"
+            line += f"  budget {budget:9.1f} MB" if budget > 0 else "  budget         -   "
+            if budget > 0 and megabytes > budget:
+                over_budget += 1
+                line += "  OVER"
+            before = baseline.get(region, {}).get(system)
+            if before is not None:
+                line += f"  {megabytes - before[0]:+8.1f} MB vs baseline"
+            print(line)
+
+    if over_budget:
+        print(f"{over_budget} system(s) over budget.", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,91 @@
+"""Summarize UObject churn and GC reports written by UNazareneObjectChurnSubsystem.
+
+Ranks classes by constructions plus destructions per second and summarizes GC pauses from the
+matching _GC.csv. --baseline compares against an earlier report, e.g. before and after pooling.
+
+Usage:
+  python Tools/read_object_churn.py Saved/Profiling/ObjectChurn_20260101_120000.csv
+  python Tools/read_object_churn.py After.csv --baseline Before.csv --top 20
+
+Plain Python 3; does not need the editor.
+"""
+
+from __future__ import annotations
+
+import argparse
+import csv
+import statistics
+import sys
+from collections import defaultdict
+from pathlib import Path
+
+
+def read_churn(path: Path) -> tuple[dict[str, tuple[int, int]], float]:
+    totals: dict[str, list[int]] = defaultdict(lambda: [0, 0])
+    duration = 0.0
+    with path.open(newline="", encoding="utf-8") as handle:
+        for row in csv.DictReader(handle):
+            entry = totals[row["Class"]]
+            entry[0] += int(row["Created"])
+            entry[1] += int(row["Destroyed"])
+            duration = max(duration, float(row["TimeSec"]))
+    return {name: (values[0], values[1]) for name, values in totals.items()}, max(duration, 0.001)
+
+
+def read_gc(path: Path) -> list[dict[str, float]]:
+    gc_path = path.with_name(f"{path.stem}_GC.csv")
+    if not gc_path.exists():
+        return []
+    with gc_path.open(newline="", encoding="utf-8") as handle:
+        return [{key: float(value) for key, value in row.items()} for row in csv.DictReader(handle)]
+
+
+def print_gc(label: str, samples: list[dict[str, float]]) -> None:
+    if not samples:
+        print(f"{label}: no garbage collections recorded")
+        return
+    pauses = [sample["PauseMs"] for sample in samples]
+    reachability = [sample["ReachabilityMs"] for sample in samples]
+    print(f"{label}: {len(samples)} GCs, pause median {statistics.median(pauses):.2f} ms max {max(pauses):.2f} ms, "
+          f"reachability median {statistics.median(reachability):.2f} ms")
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("report", help="ObjectChurn_*.csv written by the tracker")
+    parser.add_argument("--baseline", help="Earlier report to compare against")
+    parser.add_argument("--top", type=int, default=15, help="Classes to list (default 15)")
+    args = parser.parse_args()
+
+    report = Path(args.report)
+    if not report.exists():
+        print(f"No such report: {report}", file=sys.stderr)
+        return 1
+
+    churn, seconds = read_churn(report)
+    baseline: dict[str, tuple[int, int]] = {}
+    baseline_seconds = 1.0
+    if args.baseline:
+        baseline, baseline_seconds = read_churn(Path(args.baseline))
+
+    ranked = sorted(churn.items(), key=lambda item: item[1][0] + item[1][1], reverse=True)
+    print(f"{report.name}: {seconds:.1f} s, {len(churn)} classes")
+    header = f"  {'class':48} {'created/s':>10} {'destroyed/s':>12}"
+    print(header + (f" {'baseline/s':>11} {'change':>8}" if baseline else ""))
+    for name, (created, destroyed) in ranked[:max(1, args.top)]:
+        line = f"  {name:48} {created / seconds:10.1f} {destroyed / seconds:12.1f}"
+        if baseline:
+            rate = sum(churn[name]) / seconds
+            before = sum(baseline.get(name, (0, 0))) / baseline_seconds
+            change = f"{(rate - before) / before * 100.0:+7.1f}%" if before > 0 else "    new"
+            line += f" {before:11.1f} {change:>8}"
+        print(line)
+
+    if args.baseline:
+        print_gc("baseline", read_gc(Path(args.baseline)))
+    print_gc("report", read_gc(report))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())